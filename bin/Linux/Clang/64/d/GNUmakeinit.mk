@@ -7,6 +7,6 @@
 # Variables
 CXXFLAGS := -pipe -std=c++11 -pedantic -Wall -Wextra -Wno-unused-parameter -Wno-unused-variable -Wno-unused-label -Wno-unused-function -Wno-unknown-pragmas -ffor-scope -m64 -march=native -fno-omit-frame-pointer -pthread -O0 -ggdb
 CFLAGS := -pipe -std=c99 -pedantic -Wall -Wextra -Wno-unused-parameter -Wno-unused-variable -Wno-unused-label -Wno-unused-function -Wno-unknown-pragmas -Wno-sign-compare -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast -m64 -march=native -fno-omit-frame-pointer -pthread -O0 -ggdb
-LDFLAGS := -pipe -Wall -ggdb
+LDFLAGS := -pipe -Wall -pthread -ggdb
 
 include $(QSS_bin)/../GNUmakeinit.mk
@@ -0,0 +1,302 @@
+// Asynchronous Binary Trajectory Output Writer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/BinaryOutput.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace QSS {
+
+namespace { // Internal
+
+// File format constants: Native byte order
+char const header_magic[ 8 ] = { 'Q', 'S', 'S', 'B', 'I', 'N', '\0', '\0' };
+char const end_magic[ 8 ] = { 'Q', 'S', 'S', 'B', 'E', 'N', 'D', '\0' };
+std::uint32_t const version( 1u );
+std::uint32_t const record_size( sizeof( BinaryOutput::Record ) );
+std::streamoff const header_size( 16 );
+std::streamoff const trailer_size( 16 );
+
+} // Internal
+
+// Static Data Definitions
+std::atomic< std::uint64_t > BinaryOutput::serials_{ 0u };
+thread_local BinaryOutput::Cache BinaryOutput::cache_{ 0u, nullptr };
+
+// Open File and Start Writer: Per-Thread Capacity Rounded Up to a Power of 2
+bool
+BinaryOutput::
+open( std::string const & name, size_type const capacity )
+{
+	close();
+	stream_.open( name, std::ios_base::binary | std::ios_base::out );
+	if ( ! stream_ ) {
+		std::cerr << "Error: Binary output file open failed: " << name << std::endl;
+		return false;
+	}
+	size_type n( 2u );
+	while ( n < capacity ) n <<= 1;
+	capacity_ = n;
+	buffers_.clear();
+	names_.clear();
+	serial_ = ++serials_;
+	written_.store( 0u );
+	done_.store( false );
+	stream_.write( header_magic, sizeof( header_magic ) );
+	stream_.write( reinterpret_cast< char const * >( &version ), sizeof( version ) );
+	stream_.write( reinterpret_cast< char const * >( &record_size ), sizeof( record_size ) );
+	writer_ = std::thread( &BinaryOutput::run, this );
+	return true;
+}
+
+// Flush, Write Footer, and Close
+void
+BinaryOutput::
+close()
+{
+	if ( ! writer_.joinable() ) return;
+	{
+		std::lock_guard< std::mutex > lock( mutex_ );
+		done_.store( true, std::memory_order_release );
+	}
+	cv_.notify_one();
+	writer_.join();
+	std::uint64_t const footer( static_cast< std::uint64_t >( stream_.tellp() ) );
+	std::uint64_t const n( names_.size() );
+	stream_.write( reinterpret_cast< char const * >( &n ), sizeof( n ) );
+	for ( std::string const & name : names_ ) {
+		std::uint32_t const l( static_cast< std::uint32_t >( name.length() ) );
+		stream_.write( reinterpret_cast< char const * >( &l ), sizeof( l ) );
+		stream_.write( name.data(), l );
+	}
+	stream_.write( reinterpret_cast< char const * >( &footer ), sizeof( footer ) );
+	stream_.write( end_magic, sizeof( end_magic ) );
+	if ( ! stream_ ) std::cerr << "Error: Binary output file write failed" << std::endl;
+	stream_.close();
+	serial_ = 0u; // Invalidate thread buffer caches
+}
+
+// Add a Channel Named by its Text Output File Name
+BinaryOutput::Channel
+BinaryOutput::
+add( std::string const & name )
+{
+	std::lock_guard< std::mutex > lock( mutex_ );
+	names_.push_back( name );
+	return static_cast< Channel >( names_.size() - 1u );
+}
+
+// Add a Buffer for the Calling Thread
+BinaryOutput::Buffer &
+BinaryOutput::
+add_buffer()
+{
+	assert( is_open() );
+	std::unique_ptr< Buffer > b( new Buffer );
+	b->ring.assign( capacity_, Record() );
+	b->mask = capacity_ - 1u;
+	Buffer * const p( b.get() );
+	{
+		std::lock_guard< std::mutex > lock( mutex_ );
+		buffers_.push_back( std::move( b ) );
+	}
+	cache_ = Cache{ serial_, p };
+	return *p;
+}
+
+// Push a Record into a Buffer
+void
+BinaryOutput::
+push( Buffer & b, Record const & record )
+{
+	size_type const h( b.head.load( std::memory_order_relaxed ) );
+	size_type const n( b.ring.size() );
+	while ( h - b.tail.load( std::memory_order_acquire ) >= n ) { // Full: Wait for writer
+		cv_.notify_one();
+		std::this_thread::yield();
+	}
+	b.ring[ h & b.mask ] = record;
+	b.head.store( h + 1u, std::memory_order_release );
+	if ( ( ( h + 1u ) & ( ( n >> 1 ) - 1u ) ) == 0u ) cv_.notify_one(); // Wake writer every half ring
+}
+
+// Writer Thread Loop
+void
+BinaryOutput::
+run()
+{
+	while ( true ) {
+		{
+			std::unique_lock< std::mutex > lock( mutex_ );
+			cv_.wait_for( lock, std::chrono::milliseconds( 50 ), [this]{
+				if ( done_.load( std::memory_order_acquire ) ) return true;
+				for ( auto const & b : buffers_ ) {
+					if ( b->head.load( std::memory_order_acquire ) - b->tail.load( std::memory_order_relaxed ) >= ( b->ring.size() >> 1 ) ) return true;
+				}
+				return false;
+			} );
+		}
+		drain();
+		if ( done_.load( std::memory_order_acquire ) ) break;
+	}
+	while ( drain() ) {} // Records pushed before the stop request
+}
+
+// Write Pending Records: Returns Whether Any Were Written
+bool
+BinaryOutput::
+drain()
+{
+	std::vector< Buffer * > buffers;
+	{
+		std::lock_guard< std::mutex > lock( mutex_ );
+		buffers.reserve( buffers_.size() );
+		for ( auto const & b : buffers_ ) buffers.push_back( b.get() );
+	}
+	bool any( false );
+	for ( Buffer * b : buffers ) {
+		size_type t( b->tail.load( std::memory_order_relaxed ) );
+		size_type const h( b->head.load( std::memory_order_acquire ) );
+		while ( t != h ) { // Contiguous ring spans
+			size_type const i( t & b->mask );
+			size_type const m( std::min( h - t, b->ring.size() - i ) );
+			stream_.write( reinterpret_cast< char const * >( &b->ring[ i ] ), static_cast< std::streamsize >( m * sizeof( Record ) ) );
+			t += m;
+			b->tail.store( t, std::memory_order_release );
+			written_.fetch_add( m, std::memory_order_release );
+			any = true;
+		}
+	}
+	return any;
+}
+
+// Convert a Binary Output File to Text Output Files
+bool
+BinaryOutput::
+convert( std::string const & name )
+{
+	std::ifstream stream( name, std::ios_base::binary | std::ios_base::in );
+	if ( ! stream ) {
+		std::cerr << "Error: Binary output file open failed: " << name << std::endl;
+		return false;
+	}
+
+	// Header and trailer
+	char magic[ 8 ];
+	std::uint32_t file_version( 0u ), file_record_size( 0u );
+	stream.read( magic, sizeof( magic ) );
+	stream.read( reinterpret_cast< char * >( &file_version ), sizeof( file_version ) );
+	stream.read( reinterpret_cast< char * >( &file_record_size ), sizeof( file_record_size ) );
+	if ( ( ! stream ) || ( std::memcmp( magic, header_magic, sizeof( magic ) ) != 0 ) || ( file_version != version ) || ( file_record_size != record_size ) ) {
+		std::cerr << "Error: Not a QSS binary output file or unsupported version: " << name << std::endl;
+		return false;
+	}
+	stream.seekg( 0, std::ios_base::end );
+	std::streamoff const size( stream.tellg() );
+	std::uint64_t footer( 0u );
+	stream.seekg( size - trailer_size );
+	stream.read( reinterpret_cast< char * >( &footer ), sizeof( footer ) );
+	stream.read( magic, sizeof( magic ) );
+	if ( ( ! stream ) || ( std::memcmp( magic, end_magic, sizeof( magic ) ) != 0 ) || ( std::streamoff( footer ) < header_size ) || ( ( std::streamoff( footer ) - header_size ) % record_size != 0 ) ) {
+		std::cerr << "Error: Binary output file is truncated or corrupt: " << name << std::endl;
+		return false;
+	}
+
+	// Channel names
+	std::uint64_t n_channels( 0u );
+	stream.seekg( std::streamoff( footer ) );
+	stream.read( reinterpret_cast< char * >( &n_channels ), sizeof( n_channels ) );
+	std::vector< std::string > names;
+	for ( std::uint64_t c = 0; ( c < n_channels ) && stream; ++c ) {
+		std::uint32_t l( 0u );
+		stream.read( reinterpret_cast< char * >( &l ), sizeof( l ) );
+		std::string channel_name( l, ' ' );
+		if ( l > 0u ) stream.read( &channel_name[ 0 ], l );
+		names.push_back( channel_name );
+	}
+	if ( ! stream ) {
+		std::cerr << "Error: Binary output file channel names are corrupt: " << name << std::endl;
+		return false;
+	}
+
+	// Records grouped by channel: Stable to keep each channel's push order
+	size_type const n_records( static_cast< size_type >( ( std::streamoff( footer ) - header_size ) / record_size ) );
+	std::vector< Record > records( n_records );
+	stream.seekg( header_size );
+	if ( n_records > 0u ) stream.read( reinterpret_cast< char * >( records.data() ), static_cast< std::streamsize >( n_records * sizeof( Record ) ) );
+	if ( ! stream ) {
+		std::cerr << "Error: Binary output file records read failed: " << name << std::endl;
+		return false;
+	}
+	std::vector< size_type > offsets( names.size() + 1u, 0u );
+	for ( Record const & r : records ) {
+		if ( r.c >= names.size() ) {
+			std::cerr << "Error: Binary output file record channel out of range: " << name << std::endl;
+			return false;
+		}
+		++offsets[ r.c + 1u ];
+	}
+	for ( size_type c = 0; c < names.size(); ++c ) offsets[ c + 1u ] += offsets[ c ];
+	std::vector< size_type > order( n_records );
+	{
+		std::vector< size_type > next( offsets.begin(), offsets.end() - 1 );
+		for ( size_type i = 0; i < n_records; ++i ) order[ next[ records[ i ].c ]++ ] = i;
+	}
+
+	// Text output files: One open at a time
+	for ( size_type c = 0; c < names.size(); ++c ) {
+		std::ofstream out( names[ c ], std::ios_base::binary | std::ios_base::out );
+		if ( ! out ) {
+			std::cerr << "Error: Output file open failed: " << names[ c ] << std::endl;
+			return false;
+		}
+		out << std::setprecision( 16 );
+		for ( size_type k = offsets[ c ], e = offsets[ c + 1u ]; k < e; ++k ) {
+			Record const & r( records[ order[ k ] ] );
+			out << r.t << '\t' << r.v << '\n';
+		}
+	}
+	std::cout << "Converted " << n_records << " records in " << names.size() << " channels from " << name << std::endl;
+	return true;
+}
+
+} // QSS
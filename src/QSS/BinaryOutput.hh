@@ -0,0 +1,215 @@
+// Asynchronous Binary Trajectory Output Writer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_BinaryOutput_hh_INCLUDED
+#define QSS_BinaryOutput_hh_INCLUDED
+
+// C++ Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace QSS {
+
+// Asynchronous Binary Trajectory Output Writer
+//
+// Fixed-size (t, value, channel) records are pushed into per-thread single-producer ring buffers
+// that a writer thread drains to one file with large sequential writes
+// Each producer thread's records are written in push order: Channels should be fed by one thread
+// File layout: Header, records, channel name footer, footer offset and end magic
+class BinaryOutput
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Real = double;
+	using Channel = std::uint32_t;
+
+	// Output Record
+	struct Record
+	{
+		Time t; // Time
+		Real v; // Value
+		Channel c; // Channel index
+		std::uint32_t reserved; // Padding: Zero
+	};
+
+private: // Types
+
+	// Single-Producer Ring Buffer
+	struct Buffer
+	{
+		std::vector< Record > ring; // Ring buffer
+		size_type mask{ 0u }; // Ring index mask
+		std::atomic< size_type > head{ 0u }; // Records pushed
+		std::atomic< size_type > tail{ 0u }; // Records written
+	};
+
+public: // Creation
+
+	// Default Constructor
+	BinaryOutput() = default;
+
+	// Destructor
+	~BinaryOutput()
+	{
+		close();
+	}
+
+	// Copy Constructor
+	BinaryOutput( BinaryOutput const & ) = delete;
+
+	// Copy Assignment
+	BinaryOutput &
+	operator =( BinaryOutput const & ) = delete;
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return writer_.joinable();
+	}
+
+public: // Properties
+
+	// Channel Count
+	size_type
+	n_channels() const
+	{
+		return names_.size();
+	}
+
+	// Records Written
+	size_type
+	written() const
+	{
+		return written_.load( std::memory_order_acquire );
+	}
+
+public: // Methods
+
+	// Open File and Start Writer: Per-Thread Capacity Rounded Up to a Power of 2
+	bool
+	open( std::string const & name, size_type const capacity = 65536u );
+
+	// Flush, Write Footer, and Close
+	void
+	close();
+
+	// Add a Channel Named by its Text Output File Name
+	Channel
+	add( std::string const & name );
+
+	// Push a Record from the Calling Thread
+	void
+	push( Channel const c, Time const t, Real const v )
+	{
+		push( buffer(), Record{ t, v, c, 0u } );
+	}
+
+public: // Static Methods
+
+	// Convert a Binary Output File to Text Output Files
+	static
+	bool
+	convert( std::string const & name );
+
+private: // Methods
+
+	// Calling Thread's Buffer
+	Buffer &
+	buffer()
+	{
+		if ( ( cache_.serial == serial_ ) && ( cache_.buffer != nullptr ) ) return *cache_.buffer;
+		return add_buffer();
+	}
+
+	// Add a Buffer for the Calling Thread
+	Buffer &
+	add_buffer();
+
+	// Push a Record into a Buffer
+	void
+	push( Buffer & b, Record const & record );
+
+	// Writer Thread Loop
+	void
+	run();
+
+	// Write Pending Records: Returns Whether Any Were Written
+	bool
+	drain();
+
+private: // Static Data
+
+	// Calling Thread's Buffer Cache
+	struct Cache
+	{
+		std::uint64_t serial; // Writer open serial number
+		Buffer * buffer; // Buffer
+	};
+
+	static std::atomic< std::uint64_t > serials_; // Open serial number source
+	static thread_local Cache cache_; // Calling thread's buffer
+
+private: // Data
+
+	std::vector< std::unique_ptr< Buffer > > buffers_; // Per-thread buffers
+	std::vector< std::string > names_; // Channel names
+	size_type capacity_{ 0u }; // Per-thread ring capacity
+	std::uint64_t serial_{ 0u }; // Open serial number
+	std::atomic< size_type > written_{ 0u }; // Records written
+	std::atomic< bool > done_{ false }; // Writer stop request
+	std::mutex mutex_; // Buffer and channel registry and writer wakeup lock
+	std::condition_variable cv_;
+	std::thread writer_;
+	std::ofstream stream_;
+
+};
+
+} // QSS
+
+#endif
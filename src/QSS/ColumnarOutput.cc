@@ -0,0 +1,223 @@
+// Columnar Trajectory Output File Writer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/ColumnarOutput.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace QSS {
+
+namespace { // Internal
+
+// File format constants: Native byte order
+char const header_magic[ 8 ] = { 'Q', 'S', 'S', 'C', 'O', 'L', '\0', '\0' };
+char const end_magic[ 8 ] = { 'Q', 'S', 'S', 'C', 'E', 'N', 'D', '\0' };
+std::uint32_t const version( 1u );
+std::uint32_t const chunk_size( sizeof( ColumnarOutput::Chunk ) );
+double const nan( std::numeric_limits< double >::quiet_NaN() ); // Missing dense value
+
+} // Internal
+
+// Static Data Definitions
+ColumnarOutput::size_type const ColumnarOutput::npos;
+
+// Open File
+bool
+ColumnarOutput::
+open( std::string const & name, size_type const sparse_capacity, size_type const stage_capacity )
+{
+	close();
+	stream_.open( name, std::ios_base::binary | std::ios_base::out );
+	if ( ! stream_ ) {
+		std::cerr << "Error: Columnar output file open failed: " << name << std::endl;
+		return false;
+	}
+	names_.clear();
+	points_.clear();
+	sparse_capacity_ = std::max( sparse_capacity, size_type( 1u ) );
+	columns_.clear();
+	column_of_.clear();
+	row_open_ = false;
+	row_.clear();
+	block_t_.clear();
+	block_v_.clear();
+	chunks_.clear();
+	stage_.clear();
+	stage_capacity_ = std::max( stage_capacity, size_type( 4096u ) );
+	stage_.reserve( stage_capacity_ );
+	offset_ = 0u;
+	stage( header_magic, sizeof( header_magic ) );
+	stage( &version, sizeof( version ) );
+	stage( &chunk_size, sizeof( chunk_size ) );
+	return true;
+}
+
+// Flush, Write Index Footer, and Close
+void
+ColumnarOutput::
+close()
+{
+	if ( ! stream_.is_open() ) return;
+	if ( row_open_ ) commit_row();
+	flush_dense();
+	for ( Channel c = 0; c < points_.size(); ++c ) flush_sparse( c );
+	std::uint64_t const footer( offset_ );
+	std::uint64_t const n_names( names_.size() );
+	stage( &n_names, sizeof( n_names ) );
+	for ( std::string const & name : names_ ) {
+		std::uint32_t const l( static_cast< std::uint32_t >( name.length() ) );
+		stage( &l, sizeof( l ) );
+		stage( name.data(), l );
+	}
+	std::uint64_t const n_columns( columns_.size() );
+	stage( &n_columns, sizeof( n_columns ) );
+	if ( n_columns > 0u ) stage( columns_.data(), columns_.size() * sizeof( Channel ) );
+	std::uint64_t const n_chunks( chunks_.size() );
+	stage( &n_chunks, sizeof( n_chunks ) );
+	if ( n_chunks > 0u ) stage( chunks_.data(), chunks_.size() * sizeof( Chunk ) );
+	stage( &footer, sizeof( footer ) );
+	stage( end_magic, sizeof( end_magic ) );
+	write_stage();
+	if ( ! stream_ ) std::cerr << "Error: Columnar output file write failed" << std::endl;
+	stream_.close();
+}
+
+// Add a Channel Named by its Text Output File Name
+ColumnarOutput::Channel
+ColumnarOutput::
+add( std::string const & name )
+{
+	names_.push_back( name );
+	points_.emplace_back();
+	points_.back().t.reserve( sparse_capacity_ );
+	points_.back().v.reserve( sparse_capacity_ );
+	column_of_.push_back( npos );
+	return static_cast< Channel >( names_.size() - 1u );
+}
+
+// Append a Sampled Point: Samples at Equal Times Form a Row
+void
+ColumnarOutput::
+sample( Channel const c, Time const t, Real const v )
+{
+	if ( row_open_ && ( t != row_t_ ) ) commit_row();
+	if ( ! row_open_ ) {
+		row_open_ = true;
+		row_t_ = t;
+		row_.assign( columns_.size(), nan );
+	}
+	size_type col( column_of_[ c ] );
+	if ( col == npos ) { // New column: Missing in earlier rows of the block
+		col = column_of_[ c ] = columns_.size();
+		columns_.push_back( c );
+		row_.push_back( nan );
+		block_v_.emplace_back( block_t_.size(), nan );
+	}
+	row_[ col ] = v;
+}
+
+// Stage a Channel's Sparse Points
+void
+ColumnarOutput::
+flush_sparse( Channel const c )
+{
+	Points & p( points_[ c ] );
+	size_type const n( p.t.size() );
+	if ( n == 0u ) return;
+	chunks_.push_back( Chunk{ offset_, n, Kind::sparse, c, p.t.front(), p.t.back() } );
+	stage( p.t.data(), n * sizeof( Time ) );
+	stage( p.v.data(), n * sizeof( Real ) );
+	p.t.clear();
+	p.v.clear();
+}
+
+// Commit the Current Row to the Dense Block
+void
+ColumnarOutput::
+commit_row()
+{
+	block_t_.push_back( row_t_ );
+	for ( size_type col = 0, e = columns_.size(); col < e; ++col ) block_v_[ col ].push_back( row_[ col ] );
+	row_open_ = false;
+	size_type const block_rows( std::max( stage_capacity_ / ( sizeof( Real ) * ( columns_.size() + 1u ) ), size_type( 16u ) ) );
+	if ( block_t_.size() >= block_rows ) flush_dense();
+}
+
+// Stage the Dense Block
+void
+ColumnarOutput::
+flush_dense()
+{
+	size_type const n( block_t_.size() );
+	if ( n == 0u ) return;
+	chunks_.push_back( Chunk{ offset_, n, Kind::dense, static_cast< std::uint32_t >( columns_.size() ), block_t_.front(), block_t_.back() } );
+	stage( block_t_.data(), n * sizeof( Time ) );
+	for ( auto & v : block_v_ ) {
+		stage( v.data(), n * sizeof( Real ) );
+		v.clear();
+	}
+	block_t_.clear();
+}
+
+// Stage Bytes
+void
+ColumnarOutput::
+stage( void const * data, size_type const n )
+{
+	if ( stage_.size() + n > stage_capacity_ ) write_stage();
+	char const * const bytes( static_cast< char const * >( data ) );
+	if ( n >= stage_capacity_ ) { // Large: Write directly
+		stream_.write( bytes, static_cast< std::streamsize >( n ) );
+	} else {
+		stage_.insert( stage_.end(), bytes, bytes + n );
+	}
+	offset_ += n;
+}
+
+// Write Staged Bytes
+void
+ColumnarOutput::
+write_stage()
+{
+	if ( stage_.empty() ) return;
+	stream_.write( stage_.data(), static_cast< std::streamsize >( stage_.size() ) );
+	stage_.clear();
+}
+
+} // QSS
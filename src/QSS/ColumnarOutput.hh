@@ -0,0 +1,210 @@
+// Columnar Trajectory Output File Writer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_ColumnarOutput_hh_INCLUDED
+#define QSS_ColumnarOutput_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace QSS {
+
+// Columnar Trajectory Output File Writer
+//
+// One file holds all channels as chunks staged into large sequential writes:
+//  Sampled output is collected into rows of equal time and written as dense time x column blocks
+//  Event-driven output is written as sparse per-channel blocks of times then values
+// An index footer lists the channel names, dense columns, and chunks: See ColumnarReader
+// Not thread-safe: Channels are fed by the simulation thread
+class ColumnarOutput
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Real = double;
+	using Channel = std::uint32_t;
+
+	static size_type const npos = static_cast< size_type >( -1 );
+
+	// Chunk Kind
+	enum class Kind : std::uint32_t {
+	 sparse, // One channel: Times then values
+	 dense // Rows: Times then one value block per column
+	};
+
+	// Chunk Index Entry
+	struct Chunk
+	{
+		std::uint64_t offset; // File offset
+		std::uint64_t n; // Points (sparse) or rows (dense)
+		Kind kind; // Chunk kind
+		std::uint32_t channel; // Channel (sparse) or column count (dense)
+		Time t_begin; // First time
+		Time t_end; // Last time
+	};
+
+private: // Types
+
+	// Sparse Channel Buffer
+	struct Points
+	{
+		std::vector< Time > t;
+		std::vector< Real > v;
+	};
+
+public: // Creation
+
+	// Default Constructor
+	ColumnarOutput() = default;
+
+	// Destructor
+	~ColumnarOutput()
+	{
+		close();
+	}
+
+	// Copy Constructor
+	ColumnarOutput( ColumnarOutput const & ) = delete;
+
+	// Copy Assignment
+	ColumnarOutput &
+	operator =( ColumnarOutput const & ) = delete;
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return stream_.is_open();
+	}
+
+public: // Properties
+
+	// Channel Count
+	size_type
+	n_channels() const
+	{
+		return names_.size();
+	}
+
+	// Chunks Written
+	size_type
+	n_chunks() const
+	{
+		return chunks_.size();
+	}
+
+public: // Methods
+
+	// Open File
+	bool
+	open( std::string const & name, size_type const sparse_capacity = 256u, size_type const stage_capacity = 1u << 20 );
+
+	// Flush, Write Index Footer, and Close
+	void
+	close();
+
+	// Add a Channel Named by its Text Output File Name
+	Channel
+	add( std::string const & name );
+
+	// Append an Event-Driven Point
+	void
+	append( Channel const c, Time const t, Real const v )
+	{
+		Points & p( points_[ c ] );
+		p.t.push_back( t );
+		p.v.push_back( v );
+		if ( p.t.size() >= sparse_capacity_ ) flush_sparse( c );
+	}
+
+	// Append a Sampled Point: Samples at Equal Times Form a Row
+	void
+	sample( Channel const c, Time const t, Real const v );
+
+private: // Methods
+
+	// Stage a Channel's Sparse Points
+	void
+	flush_sparse( Channel const c );
+
+	// Commit the Current Row to the Dense Block
+	void
+	commit_row();
+
+	// Stage the Dense Block
+	void
+	flush_dense();
+
+	// Stage Bytes
+	void
+	stage( void const * data, size_type const n );
+
+	// Write Staged Bytes
+	void
+	write_stage();
+
+private: // Data
+
+	std::vector< std::string > names_; // Channel names
+	std::vector< Points > points_; // Sparse channel buffers
+	size_type sparse_capacity_{ 256u }; // Sparse chunk capacity
+
+	std::vector< Channel > columns_; // Dense column channels
+	std::vector< size_type > column_of_; // Dense column of each channel (or npos)
+	bool row_open_{ false }; // Row being collected?
+	Time row_t_{ 0.0 }; // Row time
+	std::vector< Real > row_; // Row values
+	std::vector< Time > block_t_; // Dense block times
+	std::vector< std::vector< Real > > block_v_; // Dense block column values
+
+	std::vector< Chunk > chunks_; // Chunk index
+	std::vector< char > stage_; // Staged bytes
+	size_type stage_capacity_{ 1u << 20 }; // Staging capacity
+	std::uint64_t offset_{ 0u }; // File offset of the stage end
+	std::ofstream stream_;
+
+};
+
+} // QSS
+
+#endif
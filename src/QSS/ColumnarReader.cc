@@ -0,0 +1,355 @@
+// Columnar Trajectory Output File Reader
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/ColumnarReader.hh>
+
+// C++ Headers
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define QSS_ColumnarReader_mmap
+#endif
+
+namespace QSS {
+
+namespace { // Internal
+
+// File format constants: Native byte order
+char const header_magic[ 8 ] = { 'Q', 'S', 'S', 'C', 'O', 'L', '\0', '\0' };
+char const end_magic[ 8 ] = { 'Q', 'S', 'S', 'C', 'E', 'N', 'D', '\0' };
+std::uint32_t const version( 1u );
+std::size_t const header_size( 16u );
+std::size_t const trailer_size( 16u );
+
+// Sequential Footer Field Reader
+class FieldReader
+{
+
+public: // Creation
+
+	FieldReader( char const * data, std::size_t const pos, std::size_t const end ) :
+	 data_( data ),
+	 pos_( pos ),
+	 end_( end )
+	{}
+
+public: // Methods
+
+	// Read Bytes: Returns Success
+	bool
+	read( void * p, std::size_t const n )
+	{
+		if ( ( ! ok_ ) || ( end_ - pos_ < n ) ) return ok_ = false;
+		std::memcpy( p, data_ + pos_, n );
+		pos_ += n;
+		return true;
+	}
+
+	// OK?
+	bool
+	ok() const
+	{
+		return ok_;
+	}
+
+private: // Data
+
+	char const * data_;
+	std::size_t pos_;
+	std::size_t end_;
+	bool ok_{ true };
+
+};
+
+} // Internal
+
+// Static Data Definitions
+ColumnarReader::size_type const ColumnarReader::npos;
+
+// Columnar Output File?
+bool
+ColumnarReader::
+is_columnar( std::string const & name )
+{
+	std::ifstream stream( name, std::ios_base::binary | std::ios_base::in );
+	char magic[ 8 ];
+	stream.read( magic, sizeof( magic ) );
+	return stream && ( std::memcmp( magic, header_magic, sizeof( magic ) ) == 0 );
+}
+
+// Open and Map a File
+bool
+ColumnarReader::
+open( std::string const & name )
+{
+	close();
+#ifdef QSS_ColumnarReader_mmap
+	int const fd( ::open( name.c_str(), O_RDONLY ) );
+	if ( fd < 0 ) {
+		std::cerr << "Error: Columnar output file open failed: " << name << std::endl;
+		return false;
+	}
+	struct stat st;
+	if ( ( ::fstat( fd, &st ) == 0 ) && ( st.st_size > 0 ) ) {
+		void * const p( ::mmap( nullptr, static_cast< std::size_t >( st.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 ) );
+		if ( p != MAP_FAILED ) {
+			data_ = static_cast< char const * >( p );
+			size_ = static_cast< size_type >( st.st_size );
+			mapped_ = true;
+		}
+	}
+	::close( fd ); // Mapping stays valid
+#endif
+	if ( ! mapped_ ) { // Read into memory
+		std::ifstream stream( name, std::ios_base::binary | std::ios_base::in );
+		if ( ! stream ) {
+			std::cerr << "Error: Columnar output file open failed: " << name << std::endl;
+			return false;
+		}
+		stream.seekg( 0, std::ios_base::end );
+		buffer_.resize( static_cast< size_type >( stream.tellg() ) );
+		stream.seekg( 0 );
+		if ( ! buffer_.empty() ) stream.read( buffer_.data(), static_cast< std::streamsize >( buffer_.size() ) );
+		data_ = buffer_.data();
+		size_ = buffer_.size();
+	}
+	if ( ! read_index( name ) ) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+// Unmap and Close
+void
+ColumnarReader::
+close()
+{
+#ifdef QSS_ColumnarReader_mmap
+	if ( mapped_ ) ::munmap( const_cast< char * >( data_ ), size_ );
+#endif
+	data_ = nullptr;
+	size_ = 0u;
+	mapped_ = false;
+	buffer_.clear();
+	buffer_.shrink_to_fit();
+	names_.clear();
+	channel_of_.clear();
+	columns_.clear();
+	column_of_.clear();
+	chunks_.clear();
+	sparse_of_.clear();
+	dense_.clear();
+	n_rows_ = 0u;
+}
+
+// Index Footer Read
+bool
+ColumnarReader::
+read_index( std::string const & name )
+{
+	// Header and trailer
+	std::uint32_t file_version( 0u ), file_chunk_size( 0u );
+	if ( ( size_ < header_size + trailer_size ) || ( std::memcmp( data_, header_magic, sizeof( header_magic ) ) != 0 ) ) {
+		std::cerr << "Error: Not a QSS columnar output file: " << name << std::endl;
+		return false;
+	}
+	std::memcpy( &file_version, data_ + 8u, sizeof( file_version ) );
+	std::memcpy( &file_chunk_size, data_ + 12u, sizeof( file_chunk_size ) );
+	if ( ( file_version != version ) || ( file_chunk_size != sizeof( Chunk ) ) ) {
+		std::cerr << "Error: Unsupported QSS columnar output file version: " << name << std::endl;
+		return false;
+	}
+	std::uint64_t footer( 0u );
+	std::memcpy( &footer, data_ + size_ - trailer_size, sizeof( footer ) );
+	if ( ( std::memcmp( data_ + size_ - sizeof( end_magic ), end_magic, sizeof( end_magic ) ) != 0 ) || ( footer < header_size ) || ( footer > size_ - trailer_size ) ) {
+		std::cerr << "Error: Columnar output file is truncated or corrupt: " << name << std::endl;
+		return false;
+	}
+
+	// Index footer
+	FieldReader reader( data_, static_cast< std::size_t >( footer ), size_ - trailer_size );
+	std::uint64_t n_names( 0u );
+	reader.read( &n_names, sizeof( n_names ) );
+	for ( std::uint64_t c = 0; ( c < n_names ) && reader.ok(); ++c ) {
+		std::uint32_t l( 0u );
+		reader.read( &l, sizeof( l ) );
+		std::string channel_name( l, ' ' );
+		if ( l > 0u ) reader.read( &channel_name[ 0 ], l );
+		channel_of_[ channel_name ] = names_.size();
+		names_.push_back( channel_name );
+	}
+	std::uint64_t n_columns( 0u );
+	reader.read( &n_columns, sizeof( n_columns ) );
+	if ( reader.ok() && ( n_columns <= n_names ) ) {
+		columns_.resize( static_cast< size_type >( n_columns ) );
+		if ( n_columns > 0u ) reader.read( columns_.data(), columns_.size() * sizeof( Channel ) );
+	}
+	std::uint64_t n_chunks( 0u );
+	reader.read( &n_chunks, sizeof( n_chunks ) );
+	if ( reader.ok() && ( n_chunks <= size_ / sizeof( Chunk ) ) ) {
+		chunks_.resize( static_cast< size_type >( n_chunks ) );
+		if ( n_chunks > 0u ) reader.read( chunks_.data(), chunks_.size() * sizeof( Chunk ) );
+	}
+	if ( ( ! reader.ok() ) || ( columns_.size() != n_columns ) || ( chunks_.size() != n_chunks ) ) {
+		std::cerr << "Error: Columnar output file index is corrupt: " << name << std::endl;
+		return false;
+	}
+
+	// Channel lookups with chunk bounds checks
+	column_of_.assign( names_.size(), npos );
+	for ( size_type j = 0; j < columns_.size(); ++j ) {
+		if ( columns_[ j ] >= names_.size() ) {
+			std::cerr << "Error: Columnar output file column channel out of range: " << name << std::endl;
+			return false;
+		}
+		column_of_[ columns_[ j ] ] = j;
+	}
+	sparse_of_.assign( names_.size(), std::vector< size_type >() );
+	for ( size_type k = 0; k < chunks_.size(); ++k ) {
+		Chunk const & chunk( chunks_[ k ] );
+		bool const sparse( chunk.kind == Kind::sparse );
+		std::uint64_t const n_arrays( sparse ? 2u : 1u + chunk.channel );
+		bool const ok( ( sparse ? chunk.channel < names_.size() : ( ( chunk.kind == Kind::dense ) && ( chunk.channel <= columns_.size() ) ) ) &&
+		 ( chunk.offset % sizeof( Time ) == 0u ) && ( chunk.offset >= header_size ) && ( chunk.offset <= footer ) &&
+		 ( chunk.n <= ( footer - chunk.offset ) / ( n_arrays * sizeof( Real ) ) ) );
+		if ( ! ok ) {
+			std::cerr << "Error: Columnar output file chunk out of range: " << name << std::endl;
+			return false;
+		}
+		if ( sparse ) {
+			sparse_of_[ chunk.channel ].push_back( k );
+		} else {
+			dense_.push_back( k );
+			n_rows_ += static_cast< size_type >( chunk.n );
+		}
+	}
+	return true;
+}
+
+// Event-Driven Points of a Channel
+ColumnarReader::Points
+ColumnarReader::
+events( Channel const c ) const
+{
+	Points points;
+	for ( size_type k : sparse_of_[ c ] ) {
+		Chunk const & chunk( chunks_[ k ] );
+		size_type const n( static_cast< size_type >( chunk.n ) );
+		Time const * t( times( chunk ) );
+		Real const * v( t + n );
+		for ( size_type i = 0; i < n; ++i ) points.push_back( Point{ t[ i ], v[ i ] } );
+	}
+	return points;
+}
+
+// Sampled Points of a Channel: Rows Missing the Channel are Skipped
+ColumnarReader::Points
+ColumnarReader::
+samples( Channel const c ) const
+{
+	Points points;
+	size_type const j( column_of_[ c ] );
+	if ( j == npos ) return points;
+	for ( size_type k : dense_ ) {
+		Chunk const & chunk( chunks_[ k ] );
+		if ( j >= chunk.channel ) continue; // Column added after this chunk
+		size_type const n( static_cast< size_type >( chunk.n ) );
+		Time const * t( times( chunk ) );
+		Real const * v( t + ( j + 1u ) * n );
+		for ( size_type i = 0; i < n; ++i ) {
+			if ( ! std::isnan( v[ i ] ) ) points.push_back( Point{ t[ i ], v[ i ] } );
+		}
+	}
+	return points;
+}
+
+// All Points of a Channel in Time Order: Events Before Samples at Equal Times
+ColumnarReader::Points
+ColumnarReader::
+points( Channel const c ) const
+{
+	Points const e( events( c ) );
+	Points const s( samples( c ) );
+	if ( s.empty() ) return e;
+	Points points;
+	points.reserve( e.size() + s.size() );
+	size_type i( 0u ), j( 0u );
+	while ( ( i < e.size() ) && ( j < s.size() ) ) {
+		if ( e[ i ].t <= s[ j ].t ) {
+			points.push_back( e[ i++ ] );
+		} else {
+			points.push_back( s[ j++ ] );
+		}
+	}
+	points.insert( points.end(), e.begin() + i, e.end() );
+	points.insert( points.end(), s.begin() + j, s.end() );
+	return points;
+}
+
+// Convert a Columnar Output File to Text Output Files
+bool
+ColumnarReader::
+convert( std::string const & name )
+{
+	ColumnarReader reader;
+	if ( ! reader.open( name ) ) return false;
+	size_type n_points( 0u );
+	for ( Channel c = 0; c < reader.n_channels(); ++c ) { // One text file open at a time
+		std::ofstream out( reader.name( c ), std::ios_base::binary | std::ios_base::out );
+		if ( ! out ) {
+			std::cerr << "Error: Output file open failed: " << reader.name( c ) << std::endl;
+			return false;
+		}
+		out << std::setprecision( 16 );
+		for ( Point const & p : reader.points( c ) ) {
+			out << p.t << '\t' << p.v << '\n';
+			++n_points;
+		}
+	}
+	std::cout << "Converted " << n_points << " points in " << reader.n_channels() << " channels from " << name << std::endl;
+	return true;
+}
+
+} // QSS
@@ -0,0 +1,222 @@
+// Columnar Trajectory Output File Reader
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_ColumnarReader_hh_INCLUDED
+#define QSS_ColumnarReader_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/ColumnarOutput.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+
+// Columnar Trajectory Output File Reader
+//
+// The file is memory mapped (read into memory where mmap is unavailable)
+// and chunk data is read in place: Only the index footer is copied
+class ColumnarReader
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = ColumnarOutput::Time;
+	using Real = ColumnarOutput::Real;
+	using Channel = ColumnarOutput::Channel;
+	using Chunk = ColumnarOutput::Chunk;
+	using Kind = ColumnarOutput::Kind;
+
+	static size_type const npos = static_cast< size_type >( -1 );
+
+	// Trajectory Point
+	struct Point
+	{
+		Time t;
+		Real v;
+	};
+
+	using Points = std::vector< Point >;
+
+public: // Creation
+
+	// Default Constructor
+	ColumnarReader() = default;
+
+	// Name Constructor
+	explicit
+	ColumnarReader( std::string const & name )
+	{
+		open( name );
+	}
+
+	// Destructor
+	~ColumnarReader()
+	{
+		close();
+	}
+
+	// Copy Constructor
+	ColumnarReader( ColumnarReader const & ) = delete;
+
+	// Copy Assignment
+	ColumnarReader &
+	operator =( ColumnarReader const & ) = delete;
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return data_ != nullptr;
+	}
+
+	// Columnar Output File?
+	static
+	bool
+	is_columnar( std::string const & name );
+
+public: // Properties
+
+	// Channel Count
+	size_type
+	n_channels() const
+	{
+		return names_.size();
+	}
+
+	// Channel Name
+	std::string const &
+	name( Channel const c ) const
+	{
+		return names_[ c ];
+	}
+
+	// Channel of a Name (or npos)
+	size_type
+	channel( std::string const & name ) const
+	{
+		auto const i( channel_of_.find( name ) );
+		return i == channel_of_.end() ? npos : i->second;
+	}
+
+	// Dense Column Count
+	size_type
+	n_columns() const
+	{
+		return columns_.size();
+	}
+
+	// Dense Row Count
+	size_type
+	n_rows() const
+	{
+		return n_rows_;
+	}
+
+	// Chunk Index
+	std::vector< Chunk > const &
+	chunks() const
+	{
+		return chunks_;
+	}
+
+public: // Methods
+
+	// Open and Map a File
+	bool
+	open( std::string const & name );
+
+	// Unmap and Close
+	void
+	close();
+
+	// Event-Driven Points of a Channel
+	Points
+	events( Channel const c ) const;
+
+	// Sampled Points of a Channel: Rows Missing the Channel are Skipped
+	Points
+	samples( Channel const c ) const;
+
+	// All Points of a Channel in Time Order: Events Before Samples at Equal Times
+	Points
+	points( Channel const c ) const;
+
+public: // Static Methods
+
+	// Convert a Columnar Output File to Text Output Files
+	static
+	bool
+	convert( std::string const & name );
+
+private: // Methods
+
+	// Time Array of a Chunk
+	Time const *
+	times( Chunk const & chunk ) const
+	{
+		return reinterpret_cast< Time const * >( data_ + chunk.offset );
+	}
+
+	// Index Footer Read
+	bool
+	read_index( std::string const & name );
+
+private: // Data
+
+	char const * data_{ nullptr }; // File bytes
+	size_type size_{ 0u }; // File size
+	bool mapped_{ false }; // Memory mapped?
+	std::vector< char > buffer_; // File bytes if not mapped
+	std::vector< std::string > names_; // Channel names
+	std::unordered_map< std::string, size_type > channel_of_; // Channel of name
+	std::vector< Channel > columns_; // Dense column channels
+	std::vector< size_type > column_of_; // Dense column of each channel (or npos)
+	std::vector< Chunk > chunks_; // Chunk index
+	std::vector< std::vector< size_type > > sparse_of_; // Sparse chunks of each channel
+	std::vector< size_type > dense_; // Dense chunks
+	size_type n_rows_{ 0u }; // Dense row count
+
+};
+
+} // QSS
+
+#endif
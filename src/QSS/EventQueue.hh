@@ -43,14 +43,18 @@
 
 // QSS Headers
 #include <QSS/Event.hh>
+#include <QSS/Instrument.hh>
 #include <QSS/math.hh>
 #include <QSS/SuperdenseTime.hh>
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace QSS {
@@ -79,6 +83,16 @@ public: // Types
 	using const_reference = typename EventMap::const_reference;
 	using reference = typename EventMap::reference;
 
+	// QSS Event Shift Record for Undo
+	struct Shift
+	{
+		Var * var; // Variable
+		SuperdenseTime s; // Superdense time before the shift
+		size_type rank; // Position among the events at that superdense time before the shift
+	};
+
+	using Journal = std::vector< Shift >;
+
 	// SuperdenseTime Index Offsets
 	struct Off {
 		static SuperdenseTime::Index const Discrete{ 0 };
@@ -343,6 +357,7 @@ public: // Methods
 	Variables
 	top_vars()
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		Variables vars;
 		if ( ! m_.empty() ) {
 			iterator i( m_.begin() );
@@ -360,6 +375,7 @@ public: // Methods
 	Events
 	top_events()
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		Events tops;
 		if ( ! m_.empty() ) {
 			iterator i( m_.begin() );
@@ -381,6 +397,14 @@ public: // Methods
 		t_ = s_.t;
 	}
 
+	// Set Active Time to a Superdense Time: Worker Threads Mirror Another Queue's Active Time
+	void
+	set_active_time( SuperdenseTime const & s )
+	{
+		s_ = s;
+		t_ = s_.t;
+	}
+
 	// Clear
 	void
 	clear()
@@ -388,6 +412,23 @@ public: // Methods
 		m_.clear();
 	}
 
+	// Swap: Event Iterators Held by Variables Stay Valid and Follow Their Events
+	void
+	swap( EventQueue & other )
+	{
+		m_.swap( other.m_ );
+		std::swap( s_, other.s_ );
+		std::swap( t_, other.t_ );
+		std::swap( journal_, other.journal_ );
+	}
+
+	// Set the Journal that Records QSS Event Shifts: Nullptr for Off
+	void
+	journal( Journal * journal )
+	{
+		journal_ = journal;
+	}
+
 public: // Discrete Event Methods
 
 	// Add Discrete Event
@@ -397,6 +438,7 @@ public: // Discrete Event Methods
 	 Var * var
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		return m_.emplace( SuperdenseTime( t, Off::Discrete ), Event< V >( Event< V >::Discrete, var ) );
 	}
 
@@ -407,6 +449,7 @@ public: // Discrete Event Methods
 	 iterator const i
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		Index const idx( t == t_ ? next_index() + Off::Discrete : Off::Discrete );
 		Var * var( i->second.var() );
 		m_.erase( i );
@@ -422,6 +465,7 @@ public: // Handler Event Methods
 	 Var * var
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		return m_.emplace( SuperdenseTime( t, Off::Handler ), Event< V >( Event< V >::Handler, var ) );
 	}
 
@@ -429,6 +473,7 @@ public: // Handler Event Methods
 	iterator
 	add_handler( Var * var )
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		return m_.emplace( SuperdenseTime( infinity, Off::Handler ), Event< V >( Event< V >::Handler, var ) );
 	}
 
@@ -440,6 +485,7 @@ public: // Handler Event Methods
 	 iterator const i
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		assert( t == t_ );
 		Index const idx( next_index() + Off::Handler );
 		Var * var( i->second.var() );
@@ -459,6 +505,7 @@ public: // Handler Event Methods
 	 iterator const i
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		assert( t == t_ );
 		Index const idx( next_index() + Off::Handler );
 		Var * var( i->second.var() );
@@ -471,6 +518,7 @@ public: // Handler Event Methods
 	iterator
 	shift_handler( iterator const i )
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		Var * var( i->second.var() );
 		m_.erase( i );
 		return m_.emplace( SuperdenseTime( infinity, Off::Handler ), Event< V >( Event< V >::Handler, var ) );
@@ -485,6 +533,7 @@ public: // Zero-Crossing Event Methods
 	 Var * var
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		return m_.emplace( SuperdenseTime( t, Off::ZC ), Event< V >( Event< V >::ZC, var ) );
 	}
 
@@ -495,6 +544,7 @@ public: // Zero-Crossing Event Methods
 	 iterator const i
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		Index const idx( t == t_ ? next_index() + Off::ZC : Off::ZC );
 		Var * var( i->second.var() );
 		m_.erase( i );
@@ -510,9 +560,22 @@ public: // QSS Event Methods
 	 Var * var
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		return m_.emplace( SuperdenseTime( t, Off::QSS ), Event< V >( Event< V >::QSS, var ) );
 	}
 
+	// Add QSS Events at the Variables' tE as a Sorted Bulk Build: Same Order as Successive add_QSS Calls
+	void
+	add_QSS( std::vector< Var * > const & vars )
+	{
+		QSS_INSTRUMENT_PHASE( queue );
+		std::vector< Var * > sorted( vars );
+		std::stable_sort( sorted.begin(), sorted.end(), []( Var const * v1, Var const * v2 ){ return v1->tE < v2->tE; } );
+		for ( Var * var : sorted ) { // End hints make ordered insertions amortized constant time and put ties after queued events like emplace
+			var->event( m_.emplace_hint( m_.end(), SuperdenseTime( var->tE, Off::QSS ), Event< V >( Event< V >::QSS, var ) ) );
+		}
+	}
+
 	// Shift QSS Event
 	iterator
 	shift_QSS(
@@ -520,12 +583,31 @@ public: // QSS Event Methods
 	 iterator const i
 	)
 	{
+		QSS_INSTRUMENT_PHASE( queue );
 		Index const idx( t == t_ ? next_index() + Off::QSS : Off::QSS );
 		Var * var( i->second.var() );
+		if ( journal_ != nullptr ) journal_->push_back( Shift{ var, i->first, static_cast< size_type >( std::distance( m_.lower_bound( i->first ), i ) ) } );
 		m_.erase( i );
 		return m_.emplace( SuperdenseTime( t, idx ), Event< V >( Event< V >::QSS, var ) );
 	}
 
+	// Undo a Journaled QSS Event Shift: Undone in Reverse Order the Queue Returns to its Prior State
+	iterator
+	unshift_QSS(
+	 Shift const & shift,
+	 iterator const i
+	)
+	{
+		assert( i->second.var() == shift.var );
+		m_.erase( i );
+		iterator h( m_.lower_bound( shift.s ) );
+		for ( size_type r = 0; r < shift.rank; ++r ) {
+			assert( ( h != m_.end() ) && ( h->first == shift.s ) );
+			++h;
+		}
+		return m_.emplace_hint( h, shift.s, Event< V >( Event< V >::QSS, shift.var ) ); // Inserted before the hint
+	}
+
 private: // Static Data
 
 	static SuperdenseTime const sZero_; // Zero superdense time
@@ -535,6 +617,7 @@ private: // Data
 	EventMap m_;
 	SuperdenseTime s_; // Active event superdense time
 	Time t_{ 0.0 }; // Active event time
+	Journal * journal_{ nullptr }; // QSS event shift journal
 
 };
 
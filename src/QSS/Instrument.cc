@@ -0,0 +1,128 @@
+// Phase Timing and Call Count Instrumentation
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/Instrument.hh>
+
+#ifdef QSS_INSTRUMENT
+
+// C++ Headers
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace QSS {
+namespace instrument {
+
+namespace { // Internal
+
+char const * const phase_names[] = { "set_time", "set_real", "get_real", "get_derivatives", "get_event_indicators", "event_iteration", "queue", "output" };
+char const * const event_names[] = { "other", "discrete", "QSS", "ZC", "handler" };
+
+// Seconds per Tick Calibrated Against the Steady Clock Since Startup
+double
+seconds_per_tick()
+{
+	Counters const & c( counters() );
+	std::uint64_t const dt( ticks() - c.ticks0 );
+	double const s( std::chrono::duration< double >( std::chrono::steady_clock::now() - c.time0 ).count() );
+	return ( dt > 0u ? s / dt : 0.0 );
+}
+
+} // Internal
+
+// Thread's Accumulators: Concurrent Simulations Don't Share Scope State
+Counters &
+counters()
+{
+	static thread_local Counters c;
+	return c;
+}
+
+// Report Breakdown
+void
+report( std::ostream & stream )
+{
+	Counters const & c( counters() );
+	double const spt( seconds_per_tick() );
+	std::size_t const n_events( std::size_t( Event::n ) ), n_phases( std::size_t( Phase::n ) );
+	stream << "\nInstrumentation =====" << std::endl;
+	std::ios_base::fmtflags const flags( stream.flags() );
+	std::streamsize const precision( stream.precision() );
+	stream << std::fixed << std::setprecision( 6 );
+	for ( std::size_t e = 0; e < n_events; ++e ) {
+		std::uint64_t phase_total( 0u );
+		for ( std::size_t p = 0; p < n_phases; ++p ) phase_total += c.phase_ticks[ e ][ p ];
+		if ( ( c.event_count[ e ] == 0u ) && ( phase_total == 0u ) ) continue;
+		stream << event_names[ e ];
+		if ( c.event_count[ e ] > 0u ) stream << ": " << c.event_count[ e ] << " events, " << c.event_ticks[ e ] * spt << " s";
+		stream << std::endl;
+		for ( std::size_t p = 0; p < n_phases; ++p ) {
+			if ( c.phase_calls[ e ][ p ] == 0u ) continue;
+			stream << "  " << std::left << std::setw( 22 ) << phase_names[ p ] << std::right << std::setw( 14 ) << c.phase_calls[ e ][ p ] << " calls " << std::setw( 14 ) << c.phase_ticks[ e ][ p ] * spt << " s" << std::endl;
+		}
+		if ( ( c.event_count[ e ] > 0u ) && ( c.event_ticks[ e ] >= phase_total ) ) {
+			stream << "  " << std::left << std::setw( 22 ) << "solver" << std::right << std::setw( 14 ) << "" << "       " << std::setw( 14 ) << ( c.event_ticks[ e ] - phase_total ) * spt << " s" << std::endl;
+		}
+	}
+	stream.flags( flags );
+	stream.precision( precision );
+}
+
+// Write Breakdown CSV
+void
+write( std::string const & name )
+{
+	std::ofstream csv( name, std::ios_base::binary | std::ios_base::out );
+	if ( ! csv ) {
+		std::cerr << "Error: Instrumentation file open failed: " << name << std::endl;
+		return;
+	}
+	Counters const & c( counters() );
+	double const spt( seconds_per_tick() );
+	csv << std::setprecision( 16 );
+	csv << "event,phase,calls,seconds\n";
+	for ( std::size_t e = 0, n_events = std::size_t( Event::n ); e < n_events; ++e ) {
+		if ( c.event_count[ e ] > 0u ) csv << event_names[ e ] << ",event," << c.event_count[ e ] << ',' << c.event_ticks[ e ] * spt << '\n';
+		for ( std::size_t p = 0, n_phases = std::size_t( Phase::n ); p < n_phases; ++p ) {
+			if ( c.phase_calls[ e ][ p ] > 0u ) csv << event_names[ e ] << ',' << phase_names[ p ] << ',' << c.phase_calls[ e ][ p ] << ',' << c.phase_ticks[ e ][ p ] * spt << '\n';
+		}
+	}
+}
+
+} // instrument
+} // QSS
+
+#endif
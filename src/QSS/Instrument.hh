@@ -0,0 +1,204 @@
+// Phase Timing and Call Count Instrumentation
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_Instrument_hh_INCLUDED
+#define QSS_Instrument_hh_INCLUDED
+
+// Compiled out unless built with -DQSS_INSTRUMENT
+//
+// Phases (FMI calls, queue operations, output) are timed with the TSC and aggregated by the
+// type of the event being processed. Only the outermost active phase is charged so nested
+// phases are not double counted. Event time not spent in a phase is reported as solver time.
+
+#ifdef QSS_INSTRUMENT
+
+// C++ Headers
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#include <x86intrin.h>
+#define QSS_INSTRUMENT_TSC
+#endif
+
+namespace QSS {
+namespace instrument {
+
+// Timed Phases
+enum class Phase : std::size_t {
+ set_time,
+ set_real,
+ get_real,
+ get_derivatives,
+ get_event_indicators,
+ event_iteration,
+ queue,
+ output,
+ n // Count
+};
+
+// Event Types
+enum class Event : std::size_t {
+ other, // Outside events: Setup, initialization, and cleanup
+ discrete,
+ QSS,
+ ZC,
+ handler,
+ n // Count
+};
+
+// Tick Count
+inline
+std::uint64_t
+ticks()
+{
+#ifdef QSS_INSTRUMENT_TSC
+	return __rdtsc();
+#else
+	return static_cast< std::uint64_t >( std::chrono::steady_clock::now().time_since_epoch().count() );
+#endif
+}
+
+// Accumulators
+struct Counters
+{
+	std::uint64_t phase_ticks[ std::size_t( Event::n ) ][ std::size_t( Phase::n ) ] = {};
+	std::uint64_t phase_calls[ std::size_t( Event::n ) ][ std::size_t( Phase::n ) ] = {};
+	std::uint64_t event_ticks[ std::size_t( Event::n ) ] = {};
+	std::uint64_t event_count[ std::size_t( Event::n ) ] = {};
+	Event event{ Event::other }; // Active event type
+	int depth{ 0 }; // Active phase nesting depth
+	std::uint64_t ticks0{ ticks() }; // Start ticks for calibration
+	std::chrono::steady_clock::time_point time0{ std::chrono::steady_clock::now() }; // Start time for calibration
+};
+
+// Thread's Accumulators
+Counters &
+counters();
+
+// Phase Scope Timer
+class Phase_scope
+{
+
+public: // Creation
+
+	// Phase Constructor
+	explicit
+	Phase_scope( Phase const phase ) :
+	 phase_( phase ),
+	 outer_( counters().depth++ == 0 ),
+	 t_( outer_ ? ticks() : 0u )
+	{}
+
+	// Destructor
+	~Phase_scope()
+	{
+		Counters & c( counters() );
+		--c.depth;
+		if ( outer_ ) {
+			std::size_t const e( static_cast< std::size_t >( c.event ) ), p( static_cast< std::size_t >( phase_ ) );
+			c.phase_ticks[ e ][ p ] += ticks() - t_;
+			++c.phase_calls[ e ][ p ];
+		}
+	}
+
+private: // Data
+
+	Phase const phase_;
+	bool const outer_;
+	std::uint64_t const t_;
+
+};
+
+// Event Scope Timer
+class Event_scope
+{
+
+public: // Creation
+
+	// Event Constructor
+	explicit
+	Event_scope( Event const event ) :
+	 event_( event ),
+	 event_outer_( counters().event ),
+	 t_( ticks() )
+	{
+		counters().event = event_;
+	}
+
+	// Destructor
+	~Event_scope()
+	{
+		Counters & c( counters() );
+		c.event_ticks[ static_cast< std::size_t >( event_ ) ] += ticks() - t_;
+		++c.event_count[ static_cast< std::size_t >( event_ ) ];
+		c.event = event_outer_;
+	}
+
+private: // Data
+
+	Event const event_;
+	Event const event_outer_;
+	std::uint64_t const t_;
+
+};
+
+// Report Breakdown
+void
+report( std::ostream & stream );
+
+// Write Breakdown CSV
+void
+write( std::string const & name );
+
+} // instrument
+} // QSS
+
+#define QSS_INSTRUMENT_PHASE(phase) QSS::instrument::Phase_scope const QSS_instrument_phase_scope_( QSS::instrument::Phase::phase )
+#define QSS_INSTRUMENT_EVENT(event) QSS::instrument::Event_scope const QSS_instrument_event_scope_( QSS::instrument::Event::event )
+#define QSS_INSTRUMENT_REPORT(name) QSS::instrument::report( std::cout ); QSS::instrument::write( name )
+
+#else
+
+#define QSS_INSTRUMENT_PHASE(phase)
+#define QSS_INSTRUMENT_EVENT(event)
+#define QSS_INSTRUMENT_REPORT(name)
+
+#endif
+
+#endif
@@ -0,0 +1,461 @@
+// QSS::Jet Truncated Taylor Series Forward-Mode Differentiation
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_Jet_hh_INCLUDED
+#define QSS_Jet_hh_INCLUDED
+
+// C++ Headers
+#include <cassert>
+#include <cmath>
+
+namespace QSS {
+
+// Truncated Taylor Series of Order N
+//
+// Holds the Taylor coefficients c_k = f^(k)/k! of a function about a point so
+// that one evaluation of an expression on Jets gives its value and first N
+// derivatives: Use for higher derivatives of nonlinear derivative functions
+template< int N >
+class Jet
+{
+
+	static_assert( N >= 0, "Jet order must be non-negative" );
+
+public: // Types
+
+	using Value = double;
+
+public: // Creation
+
+	// Default Constructor
+	Jet()
+	{
+		for ( int k = 0; k <= N; ++k ) c_[ k ] = 0.0;
+	}
+
+	// Constant Constructor
+	Jet( Value const v )
+	{
+		c_[ 0 ] = v;
+		for ( int k = 1; k <= N; ++k ) c_[ k ] = 0.0;
+	}
+
+	// Independent Variable Jet at Value v
+	static
+	Jet
+	variable( Value const v )
+	{
+		Jet j( v );
+		if ( N >= 1 ) j.c_[ 1 ] = 1.0;
+		return j;
+	}
+
+	// Jet from Value and Derivatives
+	static
+	Jet
+	derivatives( Value const v, Value const d1 = 0.0, Value const d2 = 0.0, Value const d3 = 0.0 )
+	{
+		Jet j( v );
+		if ( N >= 1 ) j.c_[ 1 ] = d1;
+		if ( N >= 2 ) j.c_[ 2 ] = 0.5 * d2;
+		if ( N >= 3 ) j.c_[ 3 ] = d3 / 6.0;
+		return j;
+	}
+
+public: // Properties
+
+	// Taylor Coefficient k
+	Value
+	operator []( int const k ) const
+	{
+		assert( ( 0 <= k ) && ( k <= N ) );
+		return c_[ k ];
+	}
+
+	// Taylor Coefficient k
+	Value &
+	operator []( int const k )
+	{
+		assert( ( 0 <= k ) && ( k <= N ) );
+		return c_[ k ];
+	}
+
+	// Value
+	Value
+	v() const
+	{
+		return c_[ 0 ];
+	}
+
+	// Derivative k
+	Value
+	d( int const k ) const
+	{
+		assert( ( 0 <= k ) && ( k <= N ) );
+		Value f( 1.0 );
+		for ( int i = 2; i <= k; ++i ) f *= i;
+		return f * c_[ k ];
+	}
+
+	// First Derivative
+	Value
+	d1() const
+	{
+		return d( 1 );
+	}
+
+	// Second Derivative
+	Value
+	d2() const
+	{
+		return d( 2 );
+	}
+
+	// Third Derivative
+	Value
+	d3() const
+	{
+		return d( 3 );
+	}
+
+public: // Operators
+
+	// Jet += Jet
+	Jet &
+	operator +=( Jet const & a )
+	{
+		for ( int k = 0; k <= N; ++k ) c_[ k ] += a.c_[ k ];
+		return *this;
+	}
+
+	// Jet -= Jet
+	Jet &
+	operator -=( Jet const & a )
+	{
+		for ( int k = 0; k <= N; ++k ) c_[ k ] -= a.c_[ k ];
+		return *this;
+	}
+
+	// Jet *= Jet
+	Jet &
+	operator *=( Jet const & a )
+	{
+		return *this = *this * a;
+	}
+
+	// Jet /= Jet
+	Jet &
+	operator /=( Jet const & a )
+	{
+		return *this = *this / a;
+	}
+
+	// Jet += Value
+	Jet &
+	operator +=( Value const v )
+	{
+		c_[ 0 ] += v;
+		return *this;
+	}
+
+	// Jet -= Value
+	Jet &
+	operator -=( Value const v )
+	{
+		c_[ 0 ] -= v;
+		return *this;
+	}
+
+	// Jet *= Value
+	Jet &
+	operator *=( Value const v )
+	{
+		for ( int k = 0; k <= N; ++k ) c_[ k ] *= v;
+		return *this;
+	}
+
+	// Jet /= Value
+	Jet &
+	operator /=( Value const v )
+	{
+		assert( v != 0.0 );
+		for ( int k = 0; k <= N; ++k ) c_[ k ] /= v;
+		return *this;
+	}
+
+public: // Friends
+
+	// -Jet
+	friend
+	Jet
+	operator -( Jet const & a )
+	{
+		Jet r;
+		for ( int k = 0; k <= N; ++k ) r.c_[ k ] = -a.c_[ k ];
+		return r;
+	}
+
+	// Jet + Jet
+	friend
+	Jet
+	operator +( Jet const & a, Jet const & b )
+	{
+		Jet r( a );
+		return r += b;
+	}
+
+	// Jet - Jet
+	friend
+	Jet
+	operator -( Jet const & a, Jet const & b )
+	{
+		Jet r( a );
+		return r -= b;
+	}
+
+	// Jet * Jet
+	friend
+	Jet
+	operator *( Jet const & a, Jet const & b )
+	{
+		Jet r;
+		for ( int k = 0; k <= N; ++k ) {
+			Value s( 0.0 );
+			for ( int i = 0; i <= k; ++i ) s += a.c_[ i ] * b.c_[ k - i ];
+			r.c_[ k ] = s;
+		}
+		return r;
+	}
+
+	// Jet / Jet
+	friend
+	Jet
+	operator /( Jet const & a, Jet const & b )
+	{
+		assert( b.c_[ 0 ] != 0.0 );
+		Value const b_0_inv( 1.0 / b.c_[ 0 ] );
+		Jet r;
+		for ( int k = 0; k <= N; ++k ) {
+			Value s( a.c_[ k ] );
+			for ( int i = 1; i <= k; ++i ) s -= b.c_[ i ] * r.c_[ k - i ];
+			r.c_[ k ] = s * b_0_inv;
+		}
+		return r;
+	}
+
+	// Jet + Value
+	friend
+	Jet
+	operator +( Jet const & a, Value const v )
+	{
+		Jet r( a );
+		return r += v;
+	}
+
+	// Value + Jet
+	friend
+	Jet
+	operator +( Value const v, Jet const & a )
+	{
+		Jet r( a );
+		return r += v;
+	}
+
+	// Jet - Value
+	friend
+	Jet
+	operator -( Jet const & a, Value const v )
+	{
+		Jet r( a );
+		return r -= v;
+	}
+
+	// Value - Jet
+	friend
+	Jet
+	operator -( Value const v, Jet const & a )
+	{
+		Jet r( -a );
+		return r += v;
+	}
+
+	// Jet * Value
+	friend
+	Jet
+	operator *( Jet const & a, Value const v )
+	{
+		Jet r( a );
+		return r *= v;
+	}
+
+	// Value * Jet
+	friend
+	Jet
+	operator *( Value const v, Jet const & a )
+	{
+		Jet r( a );
+		return r *= v;
+	}
+
+	// Jet / Value
+	friend
+	Jet
+	operator /( Jet const & a, Value const v )
+	{
+		Jet r( a );
+		return r /= v;
+	}
+
+	// Value / Jet
+	friend
+	Jet
+	operator /( Value const v, Jet const & a )
+	{
+		return Jet( v ) / a;
+	}
+
+	// Square Root of Jet
+	friend
+	Jet
+	sqrt( Jet const & a )
+	{
+		Jet r;
+		r.c_[ 0 ] = std::sqrt( a.c_[ 0 ] );
+		if ( N >= 1 ) assert( r.c_[ 0 ] != 0.0 );
+		for ( int k = 1; k <= N; ++k ) {
+			Value s( a.c_[ k ] );
+			for ( int i = 1; i < k; ++i ) s -= r.c_[ i ] * r.c_[ k - i ];
+			r.c_[ k ] = s / ( 2.0 * r.c_[ 0 ] );
+		}
+		return r;
+	}
+
+	// Exponential of Jet
+	friend
+	Jet
+	exp( Jet const & a )
+	{
+		Jet r;
+		r.c_[ 0 ] = std::exp( a.c_[ 0 ] );
+		for ( int k = 1; k <= N; ++k ) {
+			Value s( 0.0 );
+			for ( int i = 1; i <= k; ++i ) s += i * a.c_[ i ] * r.c_[ k - i ];
+			r.c_[ k ] = s / k;
+		}
+		return r;
+	}
+
+	// Natural Logarithm of Jet
+	friend
+	Jet
+	log( Jet const & a )
+	{
+		assert( a.c_[ 0 ] > 0.0 );
+		Jet r;
+		r.c_[ 0 ] = std::log( a.c_[ 0 ] );
+		for ( int k = 1; k <= N; ++k ) {
+			Value s( 0.0 );
+			for ( int i = 1; i < k; ++i ) s += i * r.c_[ i ] * a.c_[ k - i ];
+			r.c_[ k ] = ( a.c_[ k ] - ( s / k ) ) / a.c_[ 0 ];
+		}
+		return r;
+	}
+
+	// Jet Raised to a Value Power
+	friend
+	Jet
+	pow( Jet const & a, Value const p )
+	{
+		Jet r;
+		r.c_[ 0 ] = std::pow( a.c_[ 0 ], p );
+		if ( N >= 1 ) assert( a.c_[ 0 ] != 0.0 );
+		for ( int k = 1; k <= N; ++k ) {
+			Value s( 0.0 );
+			for ( int i = 1; i <= k; ++i ) s += ( ( ( p + 1.0 ) * i ) - k ) * a.c_[ i ] * r.c_[ k - i ];
+			r.c_[ k ] = s / ( k * a.c_[ 0 ] );
+		}
+		return r;
+	}
+
+	// Sine of Jet
+	friend
+	Jet
+	sin( Jet const & a )
+	{
+		Jet s, c;
+		sin_cos( a, s, c );
+		return s;
+	}
+
+	// Cosine of Jet
+	friend
+	Jet
+	cos( Jet const & a )
+	{
+		Jet s, c;
+		sin_cos( a, s, c );
+		return c;
+	}
+
+private: // Static Methods
+
+	// Sine and Cosine of Jet
+	static
+	void
+	sin_cos( Jet const & a, Jet & s, Jet & c )
+	{
+		s.c_[ 0 ] = std::sin( a.c_[ 0 ] );
+		c.c_[ 0 ] = std::cos( a.c_[ 0 ] );
+		for ( int k = 1; k <= N; ++k ) {
+			Value ss( 0.0 ), cs( 0.0 );
+			for ( int i = 1; i <= k; ++i ) {
+				Value const ia( i * a.c_[ i ] );
+				ss += ia * c.c_[ k - i ];
+				cs -= ia * s.c_[ k - i ];
+			}
+			s.c_[ k ] = ss / k;
+			c.c_[ k ] = cs / k;
+		}
+	}
+
+private: // Data
+
+	Value c_[ N + 1 ]; // Taylor coefficients
+
+};
+
+} // QSS
+
+#endif
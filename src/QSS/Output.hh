@@ -0,0 +1,123 @@
+// Trajectory Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_Output_hh_INCLUDED
+#define QSS_Output_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/BinaryOutput.hh>
+#include <QSS/ColumnarOutput.hh>
+
+// C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+namespace QSS {
+
+// Trajectory Output File: Text File or Binary or Columnar Output Channel
+class Output
+{
+
+public: // Types
+
+	using Time = double;
+	using Real = double;
+	using Channel = std::uint32_t;
+
+public: // Creation
+
+	// Name Constructor: Text File or Channel of an Open Binary or Columnar Output
+	explicit
+	Output( std::string const & name, BinaryOutput * binary = nullptr, ColumnarOutput * columnar = nullptr ) :
+	 binary_( binary && binary->is_open() ? binary : nullptr ),
+	 columnar_( ( ! binary_ ) && columnar && columnar->is_open() ? columnar : nullptr )
+	{
+		if ( binary_ ) {
+			channel_ = binary_->add( name );
+		} else if ( columnar_ ) {
+			channel_ = columnar_->add( name );
+		} else {
+			stream_.open( name, std::ios_base::binary | std::ios_base::out );
+			stream_ << std::setprecision( 16 );
+		}
+	}
+
+public: // Methods
+
+	// Append an Event-Driven Time and Value
+	void
+	append( Time const t, Real const v )
+	{
+		if ( binary_ ) {
+			binary_->push( channel_, t, v );
+		} else if ( columnar_ ) {
+			columnar_->append( channel_, t, v );
+		} else {
+			stream_ << t << '\t' << v << '\n';
+		}
+	}
+
+	// Append a Sampled Time and Value
+	void
+	sample( Time const t, Real const v )
+	{
+		if ( columnar_ ) {
+			columnar_->sample( channel_, t, v );
+		} else {
+			append( t, v );
+		}
+	}
+
+	// Close
+	void
+	close()
+	{
+		if ( ( ! binary_ ) && ( ! columnar_ ) ) stream_.close();
+	}
+
+private: // Data
+
+	BinaryOutput * binary_{ nullptr }; // Binary output
+	ColumnarOutput * columnar_{ nullptr }; // Columnar output (text if both null)
+	Channel channel_{ 0u }; // Binary output channel
+	std::ofstream stream_; // Text output stream
+
+};
+
+} // QSS
+
+#endif
@@ -0,0 +1,145 @@
+// Output Variable Selection Filter
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/OutputFilter.hh>
+
+namespace QSS {
+
+// Patterns Constructor
+OutputFilter::
+OutputFilter( std::vector< std::string > const & includes, std::vector< std::string > const & excludes )
+{
+	for ( std::string const & s : includes ) includes_.push_back( pattern( s ) );
+	for ( std::string const & s : excludes ) excludes_.push_back( pattern( s ) );
+}
+
+// Valid Pattern?
+bool
+OutputFilter::
+is_valid( std::string const & pattern )
+{
+	if ( pattern.compare( 0u, 3u, "re:" ) != 0 ) return ! pattern.empty();
+	try {
+		std::regex const regex( pattern.substr( 3u ) );
+		return true;
+	} catch ( std::regex_error const & ) {
+		return false;
+	}
+}
+
+// Glob Pattern Matches Whole Name?
+bool
+OutputFilter::
+glob_match( char const * pattern, char const * name )
+{
+	char const * star_p( nullptr ); // Pattern position after last *
+	char const * star_n( nullptr ); // Name position the last * resumes from
+	while ( *name != '\0' ) {
+		bool matched( false );
+		if ( *pattern == '*' ) { // Record backtrack point
+			star_p = ++pattern;
+			star_n = name;
+			continue;
+		} else if ( *pattern == '?' ) {
+			matched = true;
+			++pattern;
+		} else if ( *pattern == '[' ) { // Set
+			char const * p( pattern + 1 );
+			bool const negate( ( *p == '!' ) || ( *p == '^' ) );
+			if ( negate ) ++p;
+			bool in( false );
+			bool first( true );
+			while ( ( *p != '\0' ) && ( first || ( *p != ']' ) ) ) {
+				if ( ( p[ 1 ] == '-' ) && ( p[ 2 ] != '\0' ) && ( p[ 2 ] != ']' ) ) { // Range
+					if ( ( p[ 0 ] <= *name ) && ( *name <= p[ 2 ] ) ) in = true;
+					p += 3;
+				} else {
+					if ( *p == *name ) in = true;
+					++p;
+				}
+				first = false;
+			}
+			if ( *p == ']' ) { // Well-formed set
+				matched = ( in != negate );
+				pattern = p + 1;
+			} else { // Unterminated: Literal [
+				matched = ( *name == '[' );
+				++pattern;
+			}
+		} else if ( ( *pattern != '\0' ) && ( *pattern == *name ) ) {
+			matched = true;
+			++pattern;
+		}
+		if ( matched ) {
+			++name;
+		} else if ( star_p != nullptr ) { // Backtrack: Last * absorbs one more char
+			pattern = star_p;
+			name = ++star_n;
+		} else {
+			return false;
+		}
+	}
+	while ( *pattern == '*' ) ++pattern;
+	return *pattern == '\0';
+}
+
+// Pattern from String
+OutputFilter::Pattern
+OutputFilter::
+pattern( std::string const & s )
+{
+	Pattern p;
+	if ( s.compare( 0u, 3u, "re:" ) == 0 ) {
+		p.is_regex = true;
+		p.regex = std::regex( s.substr( 3u ) ); // Validated by options processing
+	} else {
+		p.glob = s;
+	}
+	return p;
+}
+
+// Any Pattern Matches Name?
+bool
+OutputFilter::
+matches( Patterns const & patterns, std::string const & name )
+{
+	for ( Pattern const & p : patterns ) {
+		if ( p.is_regex ? std::regex_search( name, p.regex ) : glob_match( p.glob.c_str(), name.c_str() ) ) return true;
+	}
+	return false;
+}
+
+} // QSS
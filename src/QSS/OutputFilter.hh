@@ -0,0 +1,125 @@
+// Output Variable Selection Filter
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_OutputFilter_hh_INCLUDED
+#define QSS_OutputFilter_hh_INCLUDED
+
+// C++ Headers
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace QSS {
+
+// Output Variable Selection Filter
+//
+// A name is selected if it matches any include pattern (or there are none) and no exclude pattern
+// Patterns are globs (* ? [set] [!set]) matching the whole name or, with an re: prefix,
+// ECMAScript regular expressions matching anywhere in the name
+class OutputFilter
+{
+
+private: // Types
+
+	// Name Pattern
+	struct Pattern
+	{
+		std::string glob; // Glob pattern
+		bool is_regex{ false }; // Regular expression?
+		std::regex regex; // Regular expression
+	};
+
+	using Patterns = std::vector< Pattern >;
+
+public: // Creation
+
+	// Default Constructor: Selects All
+	OutputFilter() = default;
+
+	// Patterns Constructor
+	OutputFilter( std::vector< std::string > const & includes, std::vector< std::string > const & excludes );
+
+public: // Predicates
+
+	// Any Patterns?
+	bool
+	is_active() const
+	{
+		return ! ( includes_.empty() && excludes_.empty() );
+	}
+
+	// Valid Pattern?
+	static
+	bool
+	is_valid( std::string const & pattern );
+
+public: // Operators
+
+	// Name Selected?
+	bool
+	operator ()( std::string const & name ) const
+	{
+		return ( includes_.empty() || matches( includes_, name ) ) && ( ! matches( excludes_, name ) );
+	}
+
+public: // Static Methods
+
+	// Glob Pattern Matches Whole Name?
+	static
+	bool
+	glob_match( char const * pattern, char const * name );
+
+private: // Static Methods
+
+	// Pattern from String
+	static
+	Pattern
+	pattern( std::string const & s );
+
+	// Any Pattern Matches Name?
+	static
+	bool
+	matches( Patterns const & patterns, std::string const & name );
+
+private: // Data
+
+	Patterns includes_; // Include patterns
+	Patterns excludes_; // Exclude patterns
+
+};
+
+} // QSS
+
+#endif
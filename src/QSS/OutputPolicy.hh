@@ -0,0 +1,72 @@
+// Output Policy Types for Event Loop Instantiations
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_OutputPolicy_hh_INCLUDED
+#define QSS_OutputPolicy_hh_INCLUDED
+
+namespace QSS {
+
+// Output Policy: Compile-Time Output Flags of a Simulation Loop Instantiation
+//
+// A false flag removes that output's branches from the instantiation
+// A true flag defers to the run-time options
+template< bool S, bool T, bool R, bool D >
+struct OutputPolicy
+{
+
+	static constexpr bool s = S; // Sampled outputs?
+	static constexpr bool t = T; // Time event outputs?
+	static constexpr bool r = R; // Requantization outputs?
+	static constexpr bool d = D; // Diagnostic output?
+
+	// Covers Run-Time Output Flags?
+	static
+	bool
+	covers( bool const s_, bool const t_, bool const r_, bool const d_ )
+	{
+		return ( S || ! s_ ) && ( T || ! t_ ) && ( R || ! r_ ) && ( D || ! d_ );
+	}
+
+};
+
+// Common Output Policies: Simulations use the first that covers their run-time options
+using OutputPolicy_None = OutputPolicy< false, false, false, false >; // No outputs
+using OutputPolicy_Sampled = OutputPolicy< true, false, false, false >; // Sampled outputs
+using OutputPolicy_Events = OutputPolicy< true, true, true, false >; // Sampled and event outputs
+using OutputPolicy_Diagnostic = OutputPolicy< true, true, true, true >; // All outputs and diagnostics
+
+} // QSS
+
+#endif
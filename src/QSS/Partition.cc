@@ -0,0 +1,364 @@
+// Multilevel Graph Partitioner
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// QSS Headers
+#include <QSS/Partition.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+namespace QSS {
+
+namespace { // Internal
+
+using size_type = Partition::size_type;
+
+// Weighted Graph
+struct Graph
+{
+	using Edge = std::pair< size_type, size_type >; // Neighbor and edge weight
+	using Edges = std::vector< Edge >;
+
+	// Vertices
+	size_type
+	size() const
+	{
+		return w.size();
+	}
+
+	std::vector< size_type > w; // Vertex weights
+	std::vector< Edges > adj; // Vertex edges
+};
+
+// Coarsen by Heavy-Edge Matching: Returns the Fine to Coarse Vertex Map
+std::vector< size_type >
+coarsen( Graph const & g, size_type const w_max, Graph & c )
+{
+	size_type const n( g.size() );
+	size_type const none( n );
+
+	// Match each vertex with its unmatched neighbor over the heaviest edge or with itself
+	std::vector< size_type > match( n, none );
+	for ( size_type v = 0; v < n; ++v ) {
+		if ( match[ v ] != none ) continue;
+		size_type m( v );
+		size_type ew_max( 0u );
+		for ( Graph::Edge const & e : g.adj[ v ] ) {
+			size_type const u( e.first );
+			if ( ( match[ u ] == none ) && ( e.second > ew_max ) && ( g.w[ v ] + g.w[ u ] <= w_max ) ) {
+				m = u;
+				ew_max = e.second;
+			}
+		}
+		match[ v ] = m;
+		match[ m ] = v;
+	}
+
+	// Coarse vertices numbered in order of their first fine vertex
+	std::vector< size_type > map( n, none );
+	size_type nc( 0u );
+	for ( size_type v = 0; v < n; ++v ) {
+		if ( map[ v ] == none ) map[ v ] = map[ match[ v ] ] = nc++;
+	}
+	c.w.assign( nc, 0u );
+	c.adj.assign( nc, Graph::Edges() );
+	for ( size_type v = 0; v < n; ++v ) {
+		c.w[ map[ v ] ] += g.w[ v ];
+	}
+
+	// Coarse edges: Parallel edges merged with summed weights
+	std::vector< size_type > pos( nc, none ); // Position of each coarse neighbor in the edge list being built
+	for ( size_type v = 0; v < n; ++v ) {
+		size_type const u( match[ v ] );
+		if ( u < v ) continue; // Pair built from its first vertex
+		size_type const cv( map[ v ] );
+		Graph::Edges & edges( c.adj[ cv ] );
+		for ( size_type const f : { v, u } ) {
+			for ( Graph::Edge const & e : g.adj[ f ] ) {
+				size_type const cu( map[ e.first ] );
+				if ( cu == cv ) continue;
+				if ( pos[ cu ] == none ) {
+					pos[ cu ] = edges.size();
+					edges.emplace_back( cu, e.second );
+				} else {
+					edges[ pos[ cu ] ].second += e.second;
+				}
+			}
+			if ( u == v ) break; // Unmatched
+		}
+		for ( Graph::Edge const & e : edges ) pos[ e.first ] = none;
+	}
+	return map;
+}
+
+// Pseudo-Peripheral Vertex of a Subset's Component: Last Reached by Breadth-First Searches
+size_type
+peripheral( Graph const & g, std::vector< size_type > const & label, size_type const s )
+{
+	size_type const l( label[ s ] );
+	std::vector< size_type > order;
+	std::vector< char > seen( g.size(), 0 );
+	size_type p( s );
+	for ( int pass = 0; pass < 2; ++pass ) {
+		order.assign( 1u, p );
+		seen[ p ] = 1;
+		for ( size_type i = 0; i < order.size(); ++i ) {
+			for ( Graph::Edge const & e : g.adj[ order[ i ] ] ) {
+				if ( ( label[ e.first ] == l ) && ( ! seen[ e.first ] ) ) {
+					seen[ e.first ] = 1;
+					order.push_back( e.first );
+				}
+			}
+		}
+		for ( size_type const v : order ) seen[ v ] = 0;
+		p = order.back();
+	}
+	return p;
+}
+
+// Greedy Graph Growing Bisection of a Subset: Grows the Region from a Seed by Max Gain
+//
+// Returns the region vertices with about w_tar weight and sets the cut edge weight
+std::vector< size_type >
+grow( Graph const & g, std::vector< size_type > const & label, std::vector< size_type > const & sub, size_type const seed, size_type const w_tar, size_type & cut )
+{
+	size_type const l( label[ seed ] );
+	std::vector< long > gain( g.size(), 0 ); // Edge weight into the region minus out of it
+	std::vector< char > in( g.size(), 0 );
+	for ( size_type const v : sub ) {
+		for ( Graph::Edge const & e : g.adj[ v ] ) {
+			if ( label[ e.first ] == l ) gain[ v ] -= long( e.second );
+		}
+	}
+	using Entry = std::pair< long, size_type >; // Gain and negated index for deterministic ties
+	std::priority_queue< Entry > heap;
+	std::vector< size_type > region;
+	size_type w( 0u );
+	long c( 0 ); // Cut weight
+	size_type next( 0u ); // Next subset vertex to seed a disconnected remainder
+	heap.emplace( gain[ seed ], ~seed );
+	while ( w < w_tar ) {
+		size_type v( g.size() );
+		while ( ! heap.empty() ) {
+			Entry const top( heap.top() );
+			heap.pop();
+			size_type const u( ~top.second );
+			if ( ( ! in[ u ] ) && ( top.first == gain[ u ] ) ) {
+				v = u;
+				break;
+			}
+		}
+		if ( v == g.size() ) { // Region's component exhausted
+			while ( in[ sub[ next ] ] ) ++next;
+			v = sub[ next ];
+		}
+		if ( ( w > 0u ) && ( 2u * ( w_tar - w ) < g.w[ v ] ) ) break; // Closer to the target without it
+		in[ v ] = 1;
+		region.push_back( v );
+		w += g.w[ v ];
+		c -= gain[ v ]; // Edges to outside become cut and edges from the region stop being cut
+		for ( Graph::Edge const & e : g.adj[ v ] ) {
+			size_type const u( e.first );
+			if ( ( label[ u ] == l ) && ( ! in[ u ] ) ) {
+				gain[ u ] += 2 * long( e.second );
+				heap.emplace( gain[ u ], ~u );
+			}
+		}
+	}
+	cut = size_type( std::max( c, 0L ) );
+	return region;
+}
+
+// Recursive Bisection of a Subset into Parts [p,p+k)
+void
+bisect( Graph const & g, std::vector< size_type > & label, size_type & n_labels, std::vector< size_type > const & sub, size_type const p, size_type const k, std::vector< size_type > & part )
+{
+	if ( k == 1u ) {
+		for ( size_type const v : sub ) part[ v ] = p;
+		return;
+	}
+	size_type const k1( k / 2u );
+	size_type w_sub( 0u );
+	for ( size_type const v : sub ) w_sub += g.w[ v ];
+	size_type const w_tar( ( w_sub * k1 ) / k );
+
+	// Best of several seeds: A pseudo-peripheral vertex and spread subset vertices
+	std::vector< size_type > best;
+	size_type best_cut( 0u );
+	size_type const n_seeds( std::min( sub.size(), size_type( 4u ) ) );
+	for ( size_type i = 0; i < n_seeds; ++i ) {
+		size_type const seed( i == 0u ? peripheral( g, label, sub[ 0 ] ) : sub[ ( i * sub.size() ) / n_seeds ] );
+		size_type cut( 0u );
+		std::vector< size_type > region( grow( g, label, sub, seed, w_tar, cut ) );
+		if ( ( i == 0u ) || ( cut < best_cut ) ) {
+			best.swap( region );
+			best_cut = cut;
+		}
+	}
+
+	// Split and recurse
+	size_type const l1( n_labels++ ); // Labels unique to each subset
+	size_type const l2( n_labels++ );
+	for ( size_type const v : sub ) label[ v ] = l2;
+	for ( size_type const v : best ) label[ v ] = l1;
+	std::vector< size_type > sub1;
+	std::vector< size_type > sub2;
+	for ( size_type const v : sub ) ( label[ v ] == l1 ? sub1 : sub2 ).push_back( v );
+	bisect( g, label, n_labels, sub1, p, k1, part );
+	bisect( g, label, n_labels, sub2, p + k1, k - k1, part );
+}
+
+// Greedy Boundary Refinement: Moves that Cut Fewer Edges, Even the Weights at Equal Cut, or Unload Overweight Parts
+void
+refine( Graph const & g, size_type const k, size_type const w_lim, std::vector< size_type > & part )
+{
+	size_type const n( g.size() );
+	std::vector< size_type > pw( k, 0u ); // Part weights
+	for ( size_type v = 0; v < n; ++v ) pw[ part[ v ] ] += g.w[ v ];
+	std::vector< size_type > conn( k, 0u ); // Edge weight from the vertex to each part
+	std::vector< size_type > touched; // Parts with connections
+	for ( int pass = 0; pass < 8; ++pass ) {
+		bool moved( false );
+		for ( size_type v = 0; v < n; ++v ) {
+			size_type const p( part[ v ] );
+			size_type const w( g.w[ v ] );
+			for ( Graph::Edge const & e : g.adj[ v ] ) {
+				size_type const q( part[ e.first ] );
+				if ( conn[ q ] == 0u ) touched.push_back( q );
+				conn[ q ] += e.second;
+			}
+			size_type b( p ); // Best other part
+			for ( size_type const q : touched ) {
+				if ( ( q != p ) && ( ( b == p ) || ( conn[ q ] > conn[ b ] ) ) ) b = q;
+			}
+			if ( ( b != p ) && ( pw[ p ] > w ) && ( pw[ b ] + w <= w_lim ) ) {
+				if ( ( conn[ b ] > conn[ p ] ) || ( ( conn[ b ] == conn[ p ] ) && ( pw[ b ] + w < pw[ p ] ) ) || ( pw[ p ] > w_lim ) ) {
+					part[ v ] = b;
+					pw[ p ] -= w;
+					pw[ b ] += w;
+					moved = true;
+				}
+			}
+			for ( size_type const q : touched ) conn[ q ] = 0u;
+			touched.clear();
+		}
+		if ( ! moved ) break;
+	}
+}
+
+} // Internal
+
+// Adjacency + Parts Constructor: Parts Are Clipped to [1,Vertices]
+Partition::
+Partition(
+ Adjacency const & adjacency,
+ size_type const n_parts
+) :
+ n_parts_( std::max( std::min( n_parts, adjacency.size() ), size_type( 1u ) ) ),
+ part_( adjacency.size(), 0u )
+{
+	size_type const n( adjacency.size() );
+	size_type const k( n_parts_ );
+	if ( k == 1u ) return;
+
+	// Finest graph: Symmetric unit edges
+	std::vector< Graph > levels( 1u );
+	levels[ 0 ].w.assign( n, 1u );
+	levels[ 0 ].adj.resize( n );
+	for ( size_type i = 0; i < n; ++i ) {
+		for ( size_type const j : adjacency[ i ] ) {
+			assert( j < n );
+			if ( j != i ) {
+				levels[ 0 ].adj[ i ].emplace_back( j, 1u );
+				levels[ 0 ].adj[ j ].emplace_back( i, 1u );
+			}
+		}
+	}
+	for ( Graph::Edges & edges : levels[ 0 ].adj ) {
+		std::sort( edges.begin(), edges.end() );
+		edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
+	}
+
+	// Coarsening until a few vertices per part or little reduction
+	size_type const w_max( std::max( n / ( 8u * k ), size_type( 2u ) ) ); // Coarse vertex weight max
+	std::vector< std::vector< size_type > > maps; // Fine to coarse vertex maps
+	while ( levels.back().size() > 16u * k ) {
+		Graph c;
+		std::vector< size_type > map( coarsen( levels.back(), w_max, c ) );
+		if ( 20u * c.size() > 19u * levels.back().size() ) break;
+		levels.push_back( std::move( c ) );
+		maps.push_back( std::move( map ) );
+	}
+
+	// Initial partition: Recursive bisection of the coarsest graph
+	size_type const w_lim( std::max( ( 103u * n ) / ( 100u * k ), ( n + k - 1u ) / k ) ); // Part weight limit: 3% imbalance
+	Graph const & coarsest( levels.back() );
+	std::vector< size_type > part( coarsest.size() );
+	std::vector< size_type > label( coarsest.size(), 0u ); // Subset labels
+	std::vector< size_type > all( coarsest.size() );
+	for ( size_type v = 0; v < all.size(); ++v ) all[ v ] = v;
+	size_type n_labels( 1u );
+	bisect( coarsest, label, n_labels, all, 0u, k, part );
+	refine( coarsest, k, w_lim, part );
+
+	// Uncoarsening with refinement at each level
+	for ( size_type l = maps.size(); l-- > 0u; ) {
+		std::vector< size_type > fine( levels[ l ].size() );
+		for ( size_type v = 0, e = fine.size(); v < e; ++v ) fine[ v ] = part[ maps[ l ][ v ] ];
+		part.swap( fine );
+		refine( levels[ l ], k, w_lim, part );
+	}
+	part_ = std::move( part );
+
+	// Cut edges
+	for ( size_type v = 0; v < n; ++v ) {
+		for ( Graph::Edge const & e : levels[ 0 ].adj[ v ] ) {
+			if ( ( v < e.first ) && ( part_[ v ] != part_[ e.first ] ) ) ++cut_;
+		}
+	}
+}
+
+// Vertices in Part p
+Partition::size_type
+Partition::
+count( size_type const p ) const
+{
+	return static_cast< size_type >( std::count( part_.begin(), part_.end(), p ) );
+}
+
+} // QSS
@@ -0,0 +1,123 @@
+// Multilevel Graph Partitioner
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_Partition_hh_INCLUDED
+#define QSS_Partition_hh_INCLUDED
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace QSS {
+
+// Multilevel Graph Partitioner
+//
+// Splits the vertices of an undirected graph into balanced parts with few cut edges: The graph
+// is coarsened by heavy-edge matching, the coarsest graph is split into contiguous runs of a
+// breadth-first ordering, and the split is projected back with greedy boundary refinement
+// at each level
+//
+// Deterministic: The parts depend only on the adjacency and the number of parts
+class Partition
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Adjacency = std::vector< std::vector< size_type > >; // Neighbor lists: Duplicates and self loops are ignored
+
+public: // Creation
+
+	// Adjacency + Parts Constructor: Parts Are Clipped to [1,Vertices]
+	Partition(
+	 Adjacency const & adjacency,
+	 size_type const n_parts
+	);
+
+public: // Properties
+
+	// Vertices
+	size_type
+	size() const
+	{
+		return part_.size();
+	}
+
+	// Parts
+	size_type
+	n_parts() const
+	{
+		return n_parts_;
+	}
+
+	// Part of Vertex i
+	size_type
+	operator []( size_type const i ) const
+	{
+		assert( i < part_.size() );
+		return part_[ i ];
+	}
+
+	// Parts of the Vertices
+	std::vector< size_type > const &
+	parts() const
+	{
+		return part_;
+	}
+
+	// Vertices in Part p
+	size_type
+	count( size_type const p ) const;
+
+	// Cut Edges
+	size_type
+	cut() const
+	{
+		return cut_;
+	}
+
+private: // Data
+
+	size_type n_parts_{ 1u }; // Parts
+	std::vector< size_type > part_; // Part of each vertex
+	size_type cut_{ 0u }; // Cut edges
+
+};
+
+} // QSS
+
+#endif
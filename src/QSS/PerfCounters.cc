@@ -0,0 +1,193 @@
+// Hardware Performance Counters
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/PerfCounters.hh>
+
+// C++ Headers
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+// Linux Headers
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace QSS {
+
+namespace { // Internal
+
+char const * const counter_names[] = { "cycles", "instructions", "LLC_misses", "branch_misses" };
+char const * const event_names[] = { "discrete", "QSS", "ZC", "handler", "other" };
+
+#ifdef __linux__
+
+// Open a Counter in a Group
+int
+perf_open( std::uint32_t const type, std::uint64_t const config, int const group_fd )
+{
+	perf_event_attr attr;
+	std::memset( &attr, 0, sizeof( attr ) );
+	attr.size = sizeof( attr );
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = ( group_fd == -1 ? 1 : 0 ); // Leader starts disabled
+	attr.exclude_kernel = 1; // User space only: Works at perf_event_paranoid 2
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return static_cast< int >( syscall( __NR_perf_event_open, &attr, 0, -1, group_fd, 0 ) );
+}
+
+#endif
+
+} // Internal
+
+// Current Counter Values: Scaled if Multiplexed
+PerfCounters::Values
+PerfCounters::
+read() const
+{
+	Values values;
+#ifdef __linux__
+	if ( ! is_open() ) return values;
+	std::uint64_t buf[ 3 + 2 * n_counters ]; // nr, time_enabled, time_running, { value, id }...
+	if ( ::read( fd_[ 0 ], buf, sizeof( buf ) ) <= 0 ) return values;
+	std::uint64_t const nr( buf[ 0 ] ), enabled( buf[ 1 ] ), running( buf[ 2 ] );
+	double const scale( ( running > 0u ) && ( running < enabled ) ? double( enabled ) / running : 1.0 );
+	for ( size_type i = 0, k = 0; ( i < n_counters ) && ( k < nr ); ++i ) {
+		if ( has_[ i ] ) values.v[ i ] = static_cast< Count >( buf[ 3 + 2 * k++ ] * scale );
+	}
+#endif
+	return values;
+}
+
+// Counter Name
+char const *
+PerfCounters::
+name( Counter const counter )
+{
+	return counter_names[ counter ];
+}
+
+// Open Counter Group on the Calling Thread
+bool
+PerfCounters::
+open()
+{
+	close();
+#ifdef __linux__
+	std::uint32_t const types[ n_counters ] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE };
+	std::uint64_t const configs[ n_counters ] = {
+	 PERF_COUNT_HW_CPU_CYCLES,
+	 PERF_COUNT_HW_INSTRUCTIONS,
+	 PERF_COUNT_HW_CACHE_LL | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ),
+	 PERF_COUNT_HW_BRANCH_MISSES
+	};
+	fd_[ 0 ] = perf_open( types[ 0 ], configs[ 0 ], -1 );
+	if ( fd_[ 0 ] < 0 ) {
+		std::cerr << "Error: Hardware performance counters unavailable: " << std::strerror( errno ) << std::endl;
+		return false;
+	}
+	has_[ 0 ] = true;
+	for ( size_type i = 1; i < n_counters; ++i ) { // Some PMUs lack a counter: Skip it
+		fd_[ i ] = perf_open( types[ i ], configs[ i ], fd_[ 0 ] );
+		has_[ i ] = ( fd_[ i ] >= 0 );
+		if ( ! has_[ i ] ) std::cerr << "Error: Hardware performance counter unavailable: " << counter_names[ i ] << std::endl;
+	}
+	ioctl( fd_[ 0 ], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+	ioctl( fd_[ 0 ], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+	open_ = read();
+	return true;
+#else
+	std::cerr << "Error: Hardware performance counters are only supported on Linux" << std::endl;
+	return false;
+#endif
+}
+
+// Close
+void
+PerfCounters::
+close()
+{
+#ifdef __linux__
+	for ( size_type i = n_counters; i-- > 0; ) {
+		if ( fd_[ i ] >= 0 ) ::close( fd_[ i ] );
+		fd_[ i ] = -1;
+		has_[ i ] = false;
+	}
+#endif
+}
+
+// Report Counts by Event Type and Total Since Open
+void
+PerfCounters::
+report( std::ostream & stream ) const
+{
+	if ( ! is_open() ) return;
+	Values const now( read() );
+	std::ios_base::fmtflags const flags( stream.flags() );
+	std::streamsize const precision( stream.precision() );
+	stream << "\nPerformance Counters =====" << std::endl;
+	stream << std::left << std::setw( 10 ) << "" << std::right << std::setw( 12 ) << "passes";
+	for ( size_type i = 0; i < n_counters; ++i ) {
+		if ( has_[ i ] ) stream << std::setw( 16 ) << counter_names[ i ];
+	}
+	stream << std::setw( 8 ) << "IPC" << std::endl;
+	auto row = [&]( char const * const label, Count const passes, Values const & c ) {
+		stream << std::left << std::setw( 10 ) << label << std::right << std::setw( 12 ) << passes;
+		for ( size_type i = 0; i < n_counters; ++i ) {
+			if ( has_[ i ] ) stream << std::setw( 16 ) << c[ i ];
+		}
+		stream << std::fixed << std::setprecision( 2 ) << std::setw( 8 ) << ( c[ cycles ] > 0u ? double( c[ instructions ] ) / c[ cycles ] : 0.0 ) << std::endl;
+		stream.flags( flags );
+	};
+	for ( size_type e = 0; e < n_events; ++e ) {
+		if ( passes_[ e ] > 0u ) row( event_names[ e ], passes_[ e ], counts_[ e ] );
+	}
+	Values total;
+	for ( size_type i = 0; i < n_counters; ++i ) total.v[ i ] = now.v[ i ] - open_.v[ i ];
+	Count total_passes( 0u );
+	for ( size_type e = 0; e < n_events; ++e ) total_passes += passes_[ e ];
+	row( "total", total_passes, total ); // Includes work outside event passes
+	stream.flags( flags );
+	stream.precision( precision );
+}
+
+} // QSS
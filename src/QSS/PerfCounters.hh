@@ -0,0 +1,190 @@
+// Hardware Performance Counters
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_PerfCounters_hh_INCLUDED
+#define QSS_PerfCounters_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace QSS {
+
+// Hardware Performance Counters
+//
+// Cycles, instructions, last-level cache misses, and branch misses of the calling thread
+// counted in user space as one perf_event_open group so a single read samples all of them
+// Counts are accumulated per event pass type between begin and end calls
+// Only available on Linux: open fails elsewhere or where the kernel denies access
+class PerfCounters
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Count = std::uint64_t;
+
+	// Counters
+	enum Counter : size_type {
+	 cycles,
+	 instructions,
+	 LLC_misses,
+	 branch_misses,
+	 n_counters
+	};
+
+	// Event Pass Types
+	enum Event : size_type {
+	 discrete,
+	 QSS,
+	 ZC,
+	 handler,
+	 other, // Caller-defined section
+	 n_events
+	};
+
+	// Counter Values
+	struct Values
+	{
+		Count v[ n_counters ] = {};
+
+		// Value of a Counter
+		Count
+		operator []( size_type const i ) const
+		{
+			return v[ i ];
+		}
+	};
+
+public: // Creation
+
+	// Default Constructor
+	PerfCounters() = default;
+
+	// Destructor
+	~PerfCounters()
+	{
+		close();
+	}
+
+	// Copy Constructor
+	PerfCounters( PerfCounters const & ) = delete;
+
+	// Copy Assignment
+	PerfCounters &
+	operator =( PerfCounters const & ) = delete;
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return fd_[ 0 ] >= 0;
+	}
+
+public: // Properties
+
+	// Current Counter Values: Scaled if Multiplexed
+	Values
+	read() const;
+
+	// Accumulated Counts of an Event Type
+	Values const &
+	counts( Event const event ) const
+	{
+		return counts_[ event ];
+	}
+
+	// Accumulated Passes of an Event Type
+	Count
+	passes( Event const event ) const
+	{
+		return passes_[ event ];
+	}
+
+	// Counter Name
+	static
+	char const *
+	name( Counter const counter );
+
+public: // Methods
+
+	// Open Counter Group on the Calling Thread
+	bool
+	open();
+
+	// Close
+	void
+	close();
+
+	// Begin Counting an Event Pass
+	void
+	begin( Event const event )
+	{
+		event_ = event;
+		begin_ = read();
+	}
+
+	// End Counting the Event Pass Begun Last
+	void
+	end()
+	{
+		Values const e( read() );
+		Values & c( counts_[ event_ ] );
+		for ( size_type i = 0; i < n_counters; ++i ) c.v[ i ] += e.v[ i ] - begin_.v[ i ];
+		++passes_[ event_ ];
+	}
+
+	// Report Counts by Event Type and Total Since Open
+	void
+	report( std::ostream & stream ) const;
+
+private: // Data
+
+	int fd_[ n_counters ] = { -1, -1, -1, -1 }; // Counter file descriptors: Leader first
+	bool has_[ n_counters ] = {}; // Counter opened?
+	Values open_; // Values at open
+	Values begin_; // Values at active begin
+	Event event_{ other }; // Active event type
+	Values counts_[ n_events ]; // Counts by event type
+	Count passes_[ n_events ] = {}; // Passes by event type
+
+};
+
+} // QSS
+
+#endif
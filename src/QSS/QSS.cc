@@ -34,6 +34,10 @@
 // ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // QSS Headers
+#include <QSS/BinaryOutput.hh>
+#include <QSS/ColumnarReader.hh>
+#include <QSS/SegmentReader.hh>
+#include <QSS/dfn/Ensemble.hh>
 #include <QSS/dfn/simulate_dfn.hh>
 #include <QSS/fmu/simulate_fmu.hh>
 #include <QSS/options.hh>
@@ -51,12 +55,28 @@ main( int argc, char * argv[] )
 	// Process command line arguments
 	options::process_args( argc, argv );
 
-	// Run FMU or example model simulation
-	if ( options::model.empty() ) {
+	// Convert binary output or run FMU or example model simulation
+	if ( ! options::convert.empty() ) { // Binary, columnar, or segment output conversion
+		bool converted( false );
+		if ( ColumnarReader::is_columnar( options::convert ) ) {
+			converted = ColumnarReader::convert( options::convert );
+		} else if ( SegmentReader::is_segment( options::convert ) ) {
+			converted = SegmentReader::convert( options::convert, options::dtOut );
+		} else {
+			converted = BinaryOutput::convert( options::convert );
+		}
+		if ( ! converted ) std::exit( EXIT_FAILURE );
+	} else if ( options::model.empty() ) {
 		std::cerr << "Error: No model name or FMU file specified" << std::endl;
 		std::exit( EXIT_FAILURE );
 	} else if ( ( options::model.length() >= 5 ) && ( options::model.rfind( ".fmu" ) == options::model.length() - 4u ) ) { // FMU
-		fmu::simulate_fmu();
+		if ( ! options::ensemble.empty() ) { // FMU ensemble
+			fmu::simulate_ensemble();
+		} else {
+			fmu::simulate_fmu();
+		}
+	} else if ( ! options::ensemble.empty() ) { // Example ensemble
+		dfn::simulate_ensemble();
 	} else { // Example
 		dfn::simulate_dfn();
 	}
@@ -0,0 +1,116 @@
+// Trajectory Segment Output File Writer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/SegmentOutput.hh>
+
+// C++ Headers
+#include <iostream>
+
+namespace QSS {
+
+namespace { // Internal
+
+// File format constants: Native byte order
+char const header_magic[ 8 ] = { 'Q', 'S', 'S', 'S', 'E', 'G', '\0', '\0' };
+char const end_magic[ 8 ] = { 'Q', 'S', 'S', 'S', 'E', 'N', 'D', '\0' };
+std::uint32_t const version( 1u );
+std::uint32_t const record_size( sizeof( SegmentOutput::Record ) );
+
+} // Internal
+
+// Open File for Continuous and/or Quantized Segments from Time t0
+bool
+SegmentOutput::
+open( std::string const & name, Time const t0, bool const x, bool const q, size_type const capacity )
+{
+	close( t_last_ );
+	stream_.open( name, std::ios_base::binary | std::ios_base::out );
+	if ( ! stream_ ) {
+		std::cerr << "Error: Segment output file open failed: " << name << std::endl;
+		return false;
+	}
+	x_ = x;
+	q_ = q;
+	names_.clear();
+	idx_.clear();
+	x_last_.clear();
+	q_last_.clear();
+	logged_.clear();
+	capacity_ = capacity > 0u ? capacity : 1u;
+	buffer_.clear();
+	buffer_.reserve( capacity_ );
+	n_segments_ = 0u;
+	t0_ = t_last_ = t0;
+	stream_.write( header_magic, sizeof( header_magic ) );
+	stream_.write( reinterpret_cast< char const * >( &version ), sizeof( version ) );
+	stream_.write( reinterpret_cast< char const * >( &record_size ), sizeof( record_size ) );
+	return true;
+}
+
+// Flush, Write Footer with End Time tE, and Close
+void
+SegmentOutput::
+close( Time const tE )
+{
+	if ( ! stream_.is_open() ) return;
+	flush();
+	std::uint64_t const footer( static_cast< std::uint64_t >( stream_.tellp() ) );
+	std::uint64_t const n( names_.size() );
+	stream_.write( reinterpret_cast< char const * >( &t0_ ), sizeof( t0_ ) );
+	stream_.write( reinterpret_cast< char const * >( &tE ), sizeof( tE ) );
+	stream_.write( reinterpret_cast< char const * >( &n ), sizeof( n ) );
+	for ( std::string const & name : names_ ) {
+		std::uint32_t const l( static_cast< std::uint32_t >( name.length() ) );
+		stream_.write( reinterpret_cast< char const * >( &l ), sizeof( l ) );
+		stream_.write( name.data(), l );
+	}
+	stream_.write( reinterpret_cast< char const * >( &footer ), sizeof( footer ) );
+	stream_.write( end_magic, sizeof( end_magic ) );
+	if ( ! stream_ ) std::cerr << "Error: Segment output file write failed" << std::endl;
+	stream_.close();
+}
+
+// Write Staged Records
+void
+SegmentOutput::
+flush()
+{
+	if ( buffer_.empty() ) return;
+	stream_.write( reinterpret_cast< char const * >( buffer_.data() ), static_cast< std::streamsize >( buffer_.size() * sizeof( Record ) ) );
+	buffer_.clear();
+}
+
+} // QSS
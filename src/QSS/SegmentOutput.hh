@@ -0,0 +1,224 @@
+// Trajectory Segment Output File Writer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_SegmentOutput_hh_INCLUDED
+#define QSS_SegmentOutput_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+
+// Trajectory Segment Output File Writer
+//
+// Logs each variable's continuous and/or quantized polynomial segment (start time and Taylor
+// coefficients) whenever it changes so output volume scales with events, not tEnd / dtOut
+// Segments are taken from the variables' derivatives at the segment start times so the
+// variable classes are untouched and every QSS order is handled (exact up to rounding)
+// A segment equal to the last one logged for its variable is skipped
+// File layout: Header, records, variable name and time range footer, footer offset and end magic
+class SegmentOutput
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Real = double;
+	using Index = std::uint32_t;
+
+	// Trajectory Representation
+	enum class Rep : std::uint32_t {
+	 x, // Continuous
+	 q // Quantized
+	};
+
+	// Segment Record: Value at t + d is c0 + c1 d + c2 d^2 + c3 d^3
+	struct Record
+	{
+		Time t; // Segment start time
+		Real c0, c1, c2, c3; // Coefficients
+		Index i; // Variable index
+		Rep rep; // Representation
+	};
+
+public: // Creation
+
+	// Default Constructor
+	SegmentOutput() = default;
+
+	// Destructor
+	~SegmentOutput()
+	{
+		close( t_last_ );
+	}
+
+	// Copy Constructor
+	SegmentOutput( SegmentOutput const & ) = delete;
+
+	// Copy Assignment
+	SegmentOutput &
+	operator =( SegmentOutput const & ) = delete;
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return stream_.is_open();
+	}
+
+public: // Properties
+
+	// Variable Count
+	size_type
+	n_vars() const
+	{
+		return names_.size();
+	}
+
+	// Segments Logged
+	size_type
+	n_segments() const
+	{
+		return n_segments_;
+	}
+
+public: // Methods
+
+	// Open File for Continuous and/or Quantized Segments from Time t0
+	bool
+	open( std::string const & name, Time const t0, bool const x = true, bool const q = false, size_type const capacity = 65536u );
+
+	// Flush, Write Footer with End Time tE, and Close
+	void
+	close( Time const tE );
+
+	// Add a Variable
+	template< typename V >
+	Index
+	add( V const * var )
+	{
+		Index const i( static_cast< Index >( names_.size() ) );
+		names_.push_back( var->name );
+		idx_[ var ] = i;
+		x_last_.push_back( Record{ 0.0, 0.0, 0.0, 0.0, 0.0, i, Rep::x } );
+		q_last_.push_back( Record{ 0.0, 0.0, 0.0, 0.0, 0.0, i, Rep::q } );
+		logged_.push_back( false );
+		return i;
+	}
+
+	// Add Variables and Log their Initial Segments
+	template< typename Variables >
+	void
+	add_all( Variables const & vars )
+	{
+		for ( auto const var : vars ) add( var );
+		log_all( vars );
+	}
+
+	// Log a Variable's Current Segments
+	template< typename V >
+	void
+	log( V const * var )
+	{
+		auto const iv( idx_.find( var ) );
+		if ( iv == idx_.end() ) return; // Not selected
+		Index const i( iv->second );
+		bool const first( ! logged_[ i ] );
+		logged_[ i ] = true;
+		if ( x_ ) {
+			Time const tX( var->tX );
+			put( x_last_[ i ], Record{ tX, var->x( tX ), var->x1( tX ), 0.5 * var->x2( tX ), var->x3( tX ) / 6.0, i, Rep::x }, first );
+		}
+		if ( q_ ) {
+			Time const tQ( var->tQ );
+			put( q_last_[ i ], Record{ tQ, var->q( tQ ), var->q1( tQ ), 0.5 * var->q2( tQ ), 0.0, i, Rep::q }, first );
+		}
+	}
+
+	// Log Variables' Current Segments
+	template< typename Variables >
+	void
+	log_all( Variables const & vars )
+	{
+		for ( auto const var : vars ) log( var );
+	}
+
+private: // Methods
+
+	// Stage a Record Unless Equal to the Last for its Variable and Representation
+	void
+	put( Record & last, Record const & record, bool const first )
+	{
+		if ( ( ! first ) && ( record.t == last.t ) && ( record.c0 == last.c0 ) && ( record.c1 == last.c1 ) && ( record.c2 == last.c2 ) && ( record.c3 == last.c3 ) ) return;
+		last = record;
+		buffer_.push_back( record );
+		++n_segments_;
+		if ( record.t > t_last_ ) t_last_ = record.t;
+		if ( buffer_.size() >= capacity_ ) flush();
+	}
+
+	// Write Staged Records
+	void
+	flush();
+
+private: // Data
+
+	bool x_{ true }; // Continuous segments?
+	bool q_{ false }; // Quantized segments?
+	std::vector< std::string > names_; // Variable names
+	std::unordered_map< void const *, Index > idx_; // Variable indexes
+	std::vector< Record > x_last_; // Last continuous segments
+	std::vector< Record > q_last_; // Last quantized segments
+	std::vector< bool > logged_; // Variables logged?
+	std::vector< Record > buffer_; // Staged records
+	size_type capacity_{ 65536u }; // Staging capacity
+	size_type n_segments_{ 0u }; // Segments logged
+	Time t0_{ 0.0 }; // Begin time
+	Time t_last_{ 0.0 }; // Latest segment time
+	std::ofstream stream_;
+
+};
+
+} // QSS
+
+#endif
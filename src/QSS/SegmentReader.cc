@@ -0,0 +1,221 @@
+// Trajectory Segment Output File Reader
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/SegmentReader.hh>
+
+// C++ Headers
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <initializer_list>
+#include <iostream>
+
+namespace QSS {
+
+namespace { // Internal
+
+// File format constants: Native byte order
+char const header_magic[ 8 ] = { 'Q', 'S', 'S', 'S', 'E', 'G', '\0', '\0' };
+char const end_magic[ 8 ] = { 'Q', 'S', 'S', 'S', 'E', 'N', 'D', '\0' };
+std::uint32_t const version( 1u );
+std::streamoff const header_size( 16 );
+std::streamoff const trailer_size( 16 );
+
+} // Internal
+
+// Static Data Definitions
+SegmentReader::size_type const SegmentReader::npos;
+
+// Segment Output File?
+bool
+SegmentReader::
+is_segment( std::string const & name )
+{
+	std::ifstream stream( name, std::ios_base::binary | std::ios_base::in );
+	char magic[ 8 ];
+	stream.read( magic, sizeof( magic ) );
+	return stream && ( std::memcmp( magic, header_magic, sizeof( magic ) ) == 0 );
+}
+
+// Open and Read a File
+bool
+SegmentReader::
+open( std::string const & name )
+{
+	close();
+	std::ifstream stream( name, std::ios_base::binary | std::ios_base::in );
+	if ( ! stream ) {
+		std::cerr << "Error: Segment output file open failed: " << name << std::endl;
+		return false;
+	}
+
+	// Header and trailer
+	char magic[ 8 ];
+	std::uint32_t file_version( 0u ), file_record_size( 0u );
+	stream.read( magic, sizeof( magic ) );
+	stream.read( reinterpret_cast< char * >( &file_version ), sizeof( file_version ) );
+	stream.read( reinterpret_cast< char * >( &file_record_size ), sizeof( file_record_size ) );
+	if ( ( ! stream ) || ( std::memcmp( magic, header_magic, sizeof( magic ) ) != 0 ) || ( file_version != version ) || ( file_record_size != sizeof( Record ) ) ) {
+		std::cerr << "Error: Not a QSS segment output file or unsupported version: " << name << std::endl;
+		return false;
+	}
+	stream.seekg( 0, std::ios_base::end );
+	std::streamoff const size( stream.tellg() );
+	std::uint64_t footer( 0u );
+	if ( size >= header_size + trailer_size ) {
+		stream.seekg( size - trailer_size );
+		stream.read( reinterpret_cast< char * >( &footer ), sizeof( footer ) );
+		stream.read( magic, sizeof( magic ) );
+	}
+	if ( ( ! stream ) || ( size < header_size + trailer_size ) || ( std::memcmp( magic, end_magic, sizeof( magic ) ) != 0 ) || ( std::streamoff( footer ) < header_size ) || ( std::streamoff( footer ) > size - trailer_size ) || ( ( std::streamoff( footer ) - header_size ) % sizeof( Record ) != 0 ) ) {
+		std::cerr << "Error: Segment output file is truncated or corrupt: " << name << std::endl;
+		return false;
+	}
+
+	// Footer
+	std::uint64_t n_vars( 0u );
+	stream.seekg( std::streamoff( footer ) );
+	stream.read( reinterpret_cast< char * >( &t0_ ), sizeof( t0_ ) );
+	stream.read( reinterpret_cast< char * >( &tE_ ), sizeof( tE_ ) );
+	stream.read( reinterpret_cast< char * >( &n_vars ), sizeof( n_vars ) );
+	for ( std::uint64_t i = 0; ( i < n_vars ) && stream; ++i ) {
+		std::uint32_t l( 0u );
+		stream.read( reinterpret_cast< char * >( &l ), sizeof( l ) );
+		if ( std::streamoff( l ) > size ) break;
+		std::string var_name( l, ' ' );
+		if ( l > 0u ) stream.read( &var_name[ 0 ], l );
+		index_of_[ var_name ] = names_.size();
+		names_.push_back( var_name );
+	}
+	if ( ( ! stream ) || ( names_.size() != n_vars ) ) {
+		std::cerr << "Error: Segment output file variable names are corrupt: " << name << std::endl;
+		close();
+		return false;
+	}
+
+	// Segments by variable
+	size_type const n_records( static_cast< size_type >( ( std::streamoff( footer ) - header_size ) / sizeof( Record ) ) );
+	Records records( n_records );
+	stream.seekg( header_size );
+	if ( n_records > 0u ) stream.read( reinterpret_cast< char * >( records.data() ), static_cast< std::streamsize >( n_records * sizeof( Record ) ) );
+	if ( ! stream ) {
+		std::cerr << "Error: Segment output file records read failed: " << name << std::endl;
+		close();
+		return false;
+	}
+	x_segments_.assign( names_.size(), Records() );
+	q_segments_.assign( names_.size(), Records() );
+	for ( Record const & r : records ) {
+		if ( ( r.i >= names_.size() ) || ( ( r.rep != Rep::x ) && ( r.rep != Rep::q ) ) ) {
+			std::cerr << "Error: Segment output file record is corrupt: " << name << std::endl;
+			close();
+			return false;
+		}
+		( r.rep == Rep::x ? x_segments_ : q_segments_ )[ r.i ].push_back( r );
+		( r.rep == Rep::x ? x_ : q_ ) = true;
+	}
+	auto const by_time( []( Record const & a, Record const & b ){ return a.t < b.t; } );
+	for ( Records & segments : x_segments_ ) {
+		if ( ! std::is_sorted( segments.begin(), segments.end(), by_time ) ) std::stable_sort( segments.begin(), segments.end(), by_time );
+	}
+	for ( Records & segments : q_segments_ ) {
+		if ( ! std::is_sorted( segments.begin(), segments.end(), by_time ) ) std::stable_sort( segments.begin(), segments.end(), by_time );
+	}
+	open_ = true;
+	return true;
+}
+
+// Close
+void
+SegmentReader::
+close()
+{
+	open_ = false;
+	t0_ = tE_ = 0.0;
+	x_ = q_ = false;
+	names_.clear();
+	index_of_.clear();
+	x_segments_.clear();
+	q_segments_.clear();
+}
+
+// Resample a Variable's Representation at t0, t0 + dt, ... and tE
+SegmentReader::Points
+SegmentReader::
+resample( size_type const i, Rep const rep, Time const dt ) const
+{
+	Points points;
+	Cursor value_at( cursor( i, rep ) );
+	Time t( t0_ );
+	for ( size_type k = 1u; t < tE_; ++k ) {
+		points.push_back( Point{ t, value_at( t ) } );
+		if ( ! ( dt > 0.0 ) ) break;
+		t = t0_ + k * dt;
+	}
+	points.push_back( Point{ tE_, value_at( tE_ ) } );
+	return points;
+}
+
+// Convert a Segment Output File to Text Output Files Sampled at Step dt
+bool
+SegmentReader::
+convert( std::string const & name, Time const dt )
+{
+	SegmentReader reader;
+	if ( ! reader.open( name ) ) return false;
+	size_type n_points( 0u );
+	for ( size_type i = 0; i < reader.n_vars(); ++i ) {
+		for ( Rep const rep : { Rep::x, Rep::q } ) {
+			if ( ! ( rep == Rep::x ? reader.x_ : reader.q_ ) ) continue;
+			std::string const out_name( reader.name( i ) + ( rep == Rep::x ? ".x.out" : ".q.out" ) );
+			std::ofstream out( out_name, std::ios_base::binary | std::ios_base::out );
+			if ( ! out ) {
+				std::cerr << "Error: Output file open failed: " << out_name << std::endl;
+				return false;
+			}
+			out << std::setprecision( 16 );
+			for ( Point const & p : reader.resample( i, rep, dt ) ) {
+				out << p.t << '\t' << p.v << '\n';
+				++n_points;
+			}
+		}
+	}
+	std::cout << "Converted " << reader.n_vars() << " variables from " << name << " to " << n_points << " points sampled at " << dt << " s" << std::endl;
+	return true;
+}
+
+} // QSS
@@ -0,0 +1,261 @@
+// Trajectory Segment Output File Reader
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_SegmentReader_hh_INCLUDED
+#define QSS_SegmentReader_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/SegmentOutput.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+
+// Trajectory Segment Output File Reader
+//
+// Evaluates any variable's continuous or quantized trajectory at any time from its segments
+// Cursors resample lazily: Nondecreasing query times advance through the segments in amortized constant time
+class SegmentReader
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = SegmentOutput::Time;
+	using Real = SegmentOutput::Real;
+	using Index = SegmentOutput::Index;
+	using Rep = SegmentOutput::Rep;
+	using Record = SegmentOutput::Record;
+	using Records = std::vector< Record >;
+
+	static size_type const npos = static_cast< size_type >( -1 );
+
+	// Trajectory Point
+	struct Point
+	{
+		Time t;
+		Real v;
+	};
+
+	using Points = std::vector< Point >;
+
+	// Lazy Resampling Cursor
+	class Cursor
+	{
+
+	public: // Creation
+
+		// Segments Constructor
+		explicit
+		Cursor( Records const & segments ) :
+		 b_( segments.data() ),
+		 e_( segments.data() + segments.size() ),
+		 i_( segments.data() )
+		{}
+
+	public: // Operators
+
+		// Value at Time t: Restarts if t Moves Back
+		Real
+		operator ()( Time const t )
+		{
+			if ( b_ == e_ ) return 0.0;
+			if ( t < i_->t ) i_ = b_; // Back: Restart
+			while ( ( i_ + 1 != e_ ) && ( ( i_ + 1 )->t <= t ) ) ++i_;
+			return value( *i_, t );
+		}
+
+	private: // Data
+
+		Record const * b_; // Segments begin
+		Record const * e_; // Segments end
+		Record const * i_; // Current segment
+
+	}; // Cursor
+
+public: // Creation
+
+	// Default Constructor
+	SegmentReader() = default;
+
+	// Name Constructor
+	explicit
+	SegmentReader( std::string const & name )
+	{
+		open( name );
+	}
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return open_;
+	}
+
+	// Segment Output File?
+	static
+	bool
+	is_segment( std::string const & name );
+
+public: // Properties
+
+	// Variable Count
+	size_type
+	n_vars() const
+	{
+		return names_.size();
+	}
+
+	// Variable Name
+	std::string const &
+	name( size_type const i ) const
+	{
+		return names_[ i ];
+	}
+
+	// Variable Index of a Name (or npos)
+	size_type
+	index( std::string const & name ) const
+	{
+		auto const i( index_of_.find( name ) );
+		return i == index_of_.end() ? npos : i->second;
+	}
+
+	// Begin Time
+	Time
+	t0() const
+	{
+		return t0_;
+	}
+
+	// End Time
+	Time
+	tE() const
+	{
+		return tE_;
+	}
+
+	// Segments of a Variable's Representation in Time Order
+	Records const &
+	segments( size_type const i, Rep const rep = Rep::x ) const
+	{
+		return rep == Rep::x ? x_segments_[ i ] : q_segments_[ i ];
+	}
+
+	// Continuous Value of a Variable at Time t
+	Real
+	x( size_type const i, Time const t ) const
+	{
+		return value( x_segments_[ i ], t );
+	}
+
+	// Quantized Value of a Variable at Time t
+	Real
+	q( size_type const i, Time const t ) const
+	{
+		return value( q_segments_[ i ], t );
+	}
+
+public: // Methods
+
+	// Open and Read a File
+	bool
+	open( std::string const & name );
+
+	// Close
+	void
+	close();
+
+	// Resampling Cursor of a Variable's Representation
+	Cursor
+	cursor( size_type const i, Rep const rep = Rep::x ) const
+	{
+		return Cursor( segments( i, rep ) );
+	}
+
+	// Resample a Variable's Representation at t0, t0 + dt, ... and tE
+	Points
+	resample( size_type const i, Rep const rep, Time const dt ) const;
+
+public: // Static Methods
+
+	// Segment Value at Time t
+	static
+	Real
+	value( Record const & r, Time const t )
+	{
+		Time const tDel( t - r.t );
+		return r.c0 + ( ( r.c1 + ( r.c2 + ( r.c3 * tDel ) ) * tDel ) * tDel );
+	}
+
+	// Value of Segments at Time t: First Segment Before its Start
+	static
+	Real
+	value( Records const & segments, Time const t )
+	{
+		if ( segments.empty() ) return 0.0;
+		auto const i( std::upper_bound( segments.begin(), segments.end(), t, []( Time const v, Record const & r ){ return v < r.t; } ) );
+		return value( i == segments.begin() ? *i : *( i - 1 ), t );
+	}
+
+	// Convert a Segment Output File to Text Output Files Sampled at Step dt
+	static
+	bool
+	convert( std::string const & name, Time const dt );
+
+private: // Data
+
+	bool open_{ false }; // Open?
+	Time t0_{ 0.0 }; // Begin time
+	Time tE_{ 0.0 }; // End time
+	bool x_{ false }; // Continuous segments present?
+	bool q_{ false }; // Quantized segments present?
+	std::vector< std::string > names_; // Variable names
+	std::unordered_map< std::string, size_type > index_of_; // Variable index of name
+	std::vector< Records > x_segments_; // Continuous segments by variable
+	std::vector< Records > q_segments_; // Quantized segments by variable
+
+};
+
+} // QSS
+
+#endif
@@ -0,0 +1,200 @@
+// Thread Pool
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/ThreadPool.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <memory>
+#include <new>
+
+// Platform Headers
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Intrinsics
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define QSS_SPIN_PAUSE() _mm_pause()
+#else
+#define QSS_SPIN_PAUSE()
+#endif
+
+namespace QSS {
+
+namespace { // Internal
+
+std::uint64_t const spins( 1u << 10 ); // Waiting spins before yielding
+std::uint64_t const yields( 1u << 12 ); // Idle worker yields before sleeping
+
+thread_local std::size_t thread_index_( 0u ); // Pool index of the current thread: 0 if not a pool worker
+
+// Wait Step: Spin then Yield so Oversubscribed Threads Make Progress
+inline
+void
+wait_step( std::uint64_t const spin )
+{
+	if ( spin < spins ) {
+		QSS_SPIN_PAUSE();
+	} else {
+		std::this_thread::yield();
+	}
+}
+
+} // Internal
+
+// Threads Constructor: 0 for Hardware Concurrency
+ThreadPool::
+ThreadPool(
+ size_type const n_threads,
+ bool const deterministic,
+ bool const pin
+) :
+ n_( n_threads == 0u ? std::max( std::thread::hardware_concurrency(), 1u ) : n_threads ),
+ deterministic_( deterministic ),
+ parts_storage_( new char[ ( n_ + 1u ) * sizeof( Part ) ] )
+{
+	void * storage( parts_storage_.get() );
+	std::size_t space( ( n_ + 1u ) * sizeof( Part ) );
+	parts_ = static_cast< Part * >( std::align( alignof( Part ), n_ * sizeof( Part ), storage, space ) ); // new only aligns over-aligned types from C++17
+	for ( size_type k = 0u; k < n_; ++k ) new ( parts_ + k ) Part();
+	threads_.reserve( n_ - 1u );
+	for ( size_type k = 1u; k < n_; ++k ) threads_.emplace_back( &ThreadPool::worker, this, k );
+	if ( pin && ( ! threads_.empty() ) ) { // Worker k on CPU k modulo the CPUs: Part 0 stays with the calling thread's affinity
+#ifdef __linux__
+		size_type const n_cpus( std::max( std::thread::hardware_concurrency(), 1u ) );
+		pinned_ = true;
+		for ( size_type k = 1u; k < n_; ++k ) {
+			cpu_set_t cpus;
+			CPU_ZERO( &cpus );
+			CPU_SET( static_cast< int >( k % n_cpus ), &cpus );
+			if ( pthread_setaffinity_np( threads_[ k - 1u ].native_handle(), sizeof( cpu_set_t ), &cpus ) != 0 ) pinned_ = false;
+		}
+#endif
+	}
+}
+
+// Destructor
+ThreadPool::
+~ThreadPool()
+{
+	{
+		std::lock_guard< std::mutex > lock( mutex_ );
+		stop_.store( true );
+	}
+	wake_.notify_all();
+	for ( std::thread & thread : threads_ ) thread.join();
+}
+
+// Index of the Current Thread in its Pool: 0 for Threads that aren't Pool Workers
+ThreadPool::size_type
+ThreadPool::
+thread_index()
+{
+	return thread_index_;
+}
+
+// Run a Chunked Loop on the Pool
+void
+ThreadPool::
+run( size_type const n, size_type const grain, Body const body, void const * f )
+{
+	assert( n_ > 1u );
+	assert( busy_.load() == 0u );
+	body_ = body;
+	f_ = f;
+	grain_ = std::max( grain, size_type( 1u ) );
+	size_type const m( n / n_ ), r( n % n_ );
+	for ( size_type k = 0u, b = 0u; k < n_; ++k ) { // Even parts with the remainder spread over the first parts
+		size_type const e( b + m + ( k < r ? 1u : 0u ) );
+		parts_[ k ].next.store( b, std::memory_order_relaxed );
+		parts_[ k ].end = e;
+		b = e;
+	}
+	busy_.store( n_ - 1u, std::memory_order_relaxed );
+	generation_.fetch_add( 1u ); // Publishes the loop to the workers
+	if ( sleepers_.load() > 0u ) {
+		{ std::lock_guard< std::mutex > lock( mutex_ ); }
+		wake_.notify_all();
+	}
+	work( 0u );
+	for ( std::uint64_t spin( 0u ); busy_.load( std::memory_order_acquire ) != 0u; ++spin ) wait_step( spin );
+}
+
+// Work on the Parts Starting with Part k
+void
+ThreadPool::
+work( size_type const k )
+{
+	for ( size_type j = 0u, m = ( deterministic_ ? 1u : n_ ); j < m; ++j ) {
+		Part & part( parts_[ ( k + j ) % n_ ] ); // Own part then steal from the others
+		size_type const end( part.end );
+		if ( part.next.load( std::memory_order_relaxed ) >= end ) continue;
+		for ( size_type b; ( b = part.next.fetch_add( grain_, std::memory_order_relaxed ) ) < end; ) {
+			body_( f_, b, std::min( b + grain_, end ) );
+		}
+	}
+}
+
+// Worker Thread Loop
+void
+ThreadPool::
+worker( size_type const k )
+{
+	thread_index_ = k;
+	std::uint64_t seen( 0u ); // Last loop generation worked
+	while ( true ) {
+		std::uint64_t spin( 0u );
+		while ( ( generation_.load( std::memory_order_acquire ) == seen ) && ( ! stop_.load( std::memory_order_relaxed ) ) ) {
+			if ( ++spin < spins + yields ) {
+				wait_step( spin );
+			} else { // Sleep until the next loop
+				std::unique_lock< std::mutex > lock( mutex_ );
+				sleepers_.fetch_add( 1u );
+				wake_.wait( lock, [this,seen](){ return ( generation_.load() != seen ) || stop_.load(); } );
+				sleepers_.fetch_sub( 1u );
+			}
+		}
+		if ( stop_.load() ) return;
+		seen = generation_.load( std::memory_order_acquire );
+		work( k );
+		busy_.fetch_sub( 1u, std::memory_order_release );
+	}
+}
+
+} // QSS
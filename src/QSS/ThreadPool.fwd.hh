@@ -1,4 +1,4 @@
-// FMU-Based QSS Globals
+// Thread Pool Forward Declaration
 //
 // Project: QSS Solver
 //
@@ -33,16 +33,14 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
 // ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-// QSS Headers
-#include <QSS/fmu/globals_fmu.hh>
-#include <QSS/fmu/Variable.hh>
-#include <QSS/EventQueue.hh>
+#ifndef QSS_ThreadPool_fwd_hh_INCLUDED
+#define QSS_ThreadPool_fwd_hh_INCLUDED
 
 namespace QSS {
-namespace fmu {
 
-// QSS Globals
-EventQueue< Variable > events;
+// Thread Pool
+class ThreadPool;
 
-} // fmu
 } // QSS
+
+#endif
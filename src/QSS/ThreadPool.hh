@@ -0,0 +1,300 @@
+// Thread Pool
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_ThreadPool_hh_INCLUDED
+#define QSS_ThreadPool_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace QSS {
+
+// Thread Pool
+//
+// Persistent workers for fine-grained parallel loops inside a simulation pass: Dispatch and
+// completion are spin-waited so loops of a few microseconds are worthwhile, waits yield after
+// a short spin so oversubscribed threads progress, and idle workers then sleep on a condition
+//
+// The index range of a loop is split evenly over the threads and each thread takes grain-sized
+// chunks from its own part first and then steals chunks from the other parts
+// The calling thread works on part 0 so a pool of size 1 runs loops serially with no workers
+// Loop bodies must not throw or start another loop on the same pool
+//
+// Deterministic pools don't steal so each index runs on the same thread in every loop of its size
+// Reductions combine fixed blocks in block order so their results don't depend on the threads
+// Pinned pools bind worker k to CPU k modulo the CPUs where the platform supports it
+class ThreadPool
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+
+private: // Types
+
+	// Chunk Body: Calls the Loop Function for Indexes [b,e)
+	using Body = void (*)( void const * f, size_type const b, size_type const e );
+
+	// Index Range Part: Aligned to a Cache Line to Limit False Sharing Between Parts
+	struct alignas( 64 ) Part
+	{
+		std::atomic< size_type > next{ 0u }; // Next index to take
+		size_type end{ 0u }; // End index
+	};
+
+public: // Types
+
+	// Task Group: Tasks Added then Run Concurrently on the Pool by wait()
+	class TaskGroup
+	{
+
+	public: // Creation
+
+		// Pool Constructor
+		explicit
+		TaskGroup( ThreadPool & pool ) :
+		 pool_( pool )
+		{}
+
+		// Copy Constructor
+		TaskGroup( TaskGroup const & ) = delete;
+
+		// Destructor: Runs Any Tasks Not Yet Run
+		~TaskGroup()
+		{
+			wait();
+		}
+
+	public: // Assignment
+
+		// Copy Assignment
+		TaskGroup &
+		operator =( TaskGroup const & ) = delete;
+
+	public: // Properties
+
+		// Tasks Not Yet Run
+		size_type
+		size() const
+		{
+			return tasks_.size();
+		}
+
+	public: // Methods
+
+		// Add a Task
+		template< typename F >
+		void
+		run( F && f )
+		{
+			tasks_.emplace_back( std::forward< F >( f ) );
+		}
+
+		// Run the Tasks and Wait for Them
+		void
+		wait()
+		{
+			pool_.parallel_for( tasks_.size(), [this]( size_type const i ){ tasks_[ i ](); } );
+			tasks_.clear();
+		}
+
+	private: // Data
+
+		ThreadPool & pool_; // Pool
+		std::vector< std::function< void() > > tasks_; // Tasks
+
+	};
+
+public: // Creation
+
+	// Threads Constructor: 0 for Hardware Concurrency
+	explicit
+	ThreadPool(
+	 size_type const n_threads = 0u,
+	 bool const deterministic = false,
+	 bool const pin = false
+	);
+
+	// Copy Constructor
+	ThreadPool( ThreadPool const & ) = delete;
+
+	// Move Constructor
+	ThreadPool( ThreadPool && ) = delete;
+
+	// Destructor
+	~ThreadPool();
+
+public: // Assignment
+
+	// Copy Assignment
+	ThreadPool &
+	operator =( ThreadPool const & ) = delete;
+
+	// Move Assignment
+	ThreadPool &
+	operator =( ThreadPool && ) = delete;
+
+public: // Properties
+
+	// Threads Including the Calling Thread
+	size_type
+	size() const
+	{
+		return n_;
+	}
+
+	// Deterministic Scheduling: No Stealing?
+	bool
+	deterministic() const
+	{
+		return deterministic_;
+	}
+
+	// Workers Pinned to CPUs?
+	bool
+	pinned() const
+	{
+		return pinned_;
+	}
+
+public: // Static Properties
+
+	// Index of the Current Thread in its Pool: 0 for Threads that aren't Pool Workers
+	//
+	// Loop bodies can use it to pick per-thread resources: The calling thread of a loop is 0
+	static
+	size_type
+	thread_index();
+
+public: // Methods
+
+	// Parallel Loop: f( i ) for i in [0,n) in Chunks of grain Indexes
+	template< typename F >
+	void
+	parallel_for( size_type const n, F const & f, size_type const grain = 1u )
+	{
+		if ( n == 0u ) return;
+		if ( ( n_ == 1u ) || ( n <= grain ) ) { // Serial
+			for ( size_type i = 0u; i < n; ++i ) f( i );
+		} else {
+			run( n, grain, &chunk< F >, &f );
+		}
+	}
+
+	// Fixed-Order Reduction: Combination of f( i ) for i in [0,n) Over Blocks of grain Indexes
+	//
+	// Each block combines its values in index order starting from init, which must be an identity
+	// of combine, and then the block results combine in block order: Blocks depend only on n and
+	// grain so floating point results are the same for any number of threads
+	template< typename T, typename F, typename C >
+	T
+	reduce( size_type const n, T const & init, F const & f, C const & combine, size_type const grain = 1u )
+	{
+		size_type const g( std::max( grain, size_type( 1u ) ) );
+		size_type const n_blocks( ( n + g - 1u ) / g );
+		std::vector< T > partials( n_blocks, init );
+		parallel_for( n_blocks, [n,g,&f,&combine,&partials]( size_type const k ){
+			T & partial( partials[ k ] );
+			for ( size_type i = k * g, e = std::min( i + g, n ); i < e; ++i ) partial = combine( partial, f( i ) );
+		} );
+		T r( init );
+		for ( T const & partial : partials ) r = combine( r, partial );
+		return r;
+	}
+
+private: // Methods
+
+	// Run a Chunked Loop on the Pool
+	void
+	run( size_type const n, size_type const grain, Body const body, void const * f );
+
+	// Work on the Parts Starting with Part k
+	void
+	work( size_type const k );
+
+	// Worker Thread Loop
+	void
+	worker( size_type const k );
+
+private: // Static Methods
+
+	// Chunk Body of a Loop Function
+	template< typename F >
+	static
+	void
+	chunk( void const * f, size_type const b, size_type const e )
+	{
+		F const & fun( *static_cast< F const * >( f ) );
+		for ( size_type i = b; i < e; ++i ) fun( i );
+	}
+
+private: // Data
+
+	size_type n_{ 1u }; // Threads including the calling thread
+	bool deterministic_{ false }; // Deterministic scheduling?
+	bool pinned_{ false }; // Workers pinned to CPUs?
+	std::vector< std::thread > threads_; // Worker threads
+	std::unique_ptr< char[] > parts_storage_; // Index range parts storage with alignment room
+	Part * parts_{ nullptr }; // Index range parts: Cache line aligned in their storage
+
+	// Current loop
+	Body body_{ nullptr }; // Chunk body
+	void const * f_{ nullptr }; // Loop function
+	size_type grain_{ 1u }; // Chunk size
+
+	// Synchronization
+	std::atomic< std::uint64_t > generation_{ 0u }; // Loops dispatched
+	std::atomic< size_type > busy_{ 0u }; // Workers still on the current loop
+	std::atomic< size_type > sleepers_{ 0u }; // Workers waiting on the condition variable
+	std::atomic< bool > stop_{ false }; // Shut down?
+	std::mutex mutex_; // Sleep mutex
+	std::condition_variable wake_; // Sleep condition
+
+};
+
+} // QSS
+
+#endif
@@ -0,0 +1,151 @@
+// Event Pass Timeline Tracer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/Tracer.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+namespace QSS {
+
+namespace { // Internal
+
+char const * const type_names[] = { "discrete", "discrete_simultaneous", "QSS", "QSS_simultaneous", "ZC", "handler", "handler_simultaneous" };
+
+} // Internal
+
+// Open Trace File and Start Writer: Capacity Rounded Up to a Power of 2
+bool
+Tracer::
+open( std::string const & name, size_type const capacity )
+{
+	close();
+	stream_.open( name, std::ios_base::binary | std::ios_base::out );
+	if ( ! stream_ ) {
+		std::cerr << "Error: Trace file open failed: " << name << std::endl;
+		return false;
+	}
+	size_type n( 2u );
+	while ( n < capacity ) n <<= 1;
+	ring_.assign( n, Record() );
+	mask_ = n - 1u;
+	head_.store( 0u );
+	tail_.store( 0u );
+	done_.store( false );
+	first_ = true;
+	t0_ = Clock::now();
+	stream_ << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	writer_ = std::thread( &Tracer::run, this );
+	return true;
+}
+
+// Flush and Close
+void
+Tracer::
+close()
+{
+	if ( ! writer_.joinable() ) return;
+	{
+		std::lock_guard< std::mutex > lock( mutex_ );
+		done_.store( true, std::memory_order_release );
+	}
+	cv_.notify_one();
+	writer_.join();
+	stream_ << "\n]}\n";
+	stream_.close();
+}
+
+// Push a Record
+void
+Tracer::
+push( Record const & record )
+{
+	size_type const h( head_.load( std::memory_order_relaxed ) );
+	size_type const n( ring_.size() );
+	while ( h - tail_.load( std::memory_order_acquire ) >= n ) { // Full: Wait for writer
+		cv_.notify_one();
+		std::this_thread::yield();
+	}
+	ring_[ h & mask_ ] = record;
+	head_.store( h + 1u, std::memory_order_release );
+	if ( ( ( h + 1u ) & ( ( n >> 1 ) - 1u ) ) == 0u ) cv_.notify_one(); // Wake writer every half ring
+}
+
+// Writer Thread Loop
+void
+Tracer::
+run()
+{
+	while ( true ) {
+		{
+			std::unique_lock< std::mutex > lock( mutex_ );
+			cv_.wait_for( lock, std::chrono::milliseconds( 50 ), [this]{ return done_.load( std::memory_order_acquire ) || ( head_.load( std::memory_order_acquire ) - tail_.load( std::memory_order_relaxed ) >= ( ring_.size() >> 1 ) ); } );
+		}
+		drain();
+		if ( done_.load( std::memory_order_acquire ) ) break;
+	}
+	drain(); // Records pushed before the stop request
+}
+
+// Write Pending Records
+void
+Tracer::
+drain()
+{
+	size_type t( tail_.load( std::memory_order_relaxed ) );
+	size_type const h( head_.load( std::memory_order_acquire ) );
+	char buf[ 384 ];
+	while ( t != h ) {
+		Record const & r( ring_[ t & mask_ ] );
+		int const len( std::snprintf( buf, sizeof( buf ),
+		 "%s\n{\"name\":\"%s\",\"cat\":\"event\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"t\":%.17g,\"i\":%zu,\"triggers\":%u,\"observers\":%u}}",
+		 first_ ? "" : ",",
+		 type_names[ static_cast< size_type >( r.type ) ],
+		 r.begin * 1.0e-3,
+		 ( r.end - r.begin ) * 1.0e-3,
+		 r.s.t,
+		 r.s.i,
+		 static_cast< unsigned >( r.n_triggers ),
+		 static_cast< unsigned >( r.n_observers ) ) );
+		if ( len > 0 ) stream_.write( buf, std::min( len, int( sizeof( buf ) ) - 1 ) );
+		first_ = false;
+		tail_.store( ++t, std::memory_order_release );
+	}
+}
+
+} // QSS
@@ -0,0 +1,194 @@
+// Event Pass Timeline Tracer
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_Tracer_hh_INCLUDED
+#define QSS_Tracer_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/SuperdenseTime.hh>
+
+// C++ Headers
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace QSS {
+
+// Event Pass Timeline Tracer
+//
+// Event passes are pushed into a single-producer ring buffer that a writer thread drains
+// to a Chrome trace JSON file (chrome://tracing, Perfetto): Never writes to stdout
+// The producer waits only if the writer falls a full ring behind so no records are lost
+class Tracer
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Clock = std::chrono::steady_clock;
+	using Nanoseconds = std::int64_t;
+
+	// Event Pass Type
+	enum class Type : std::uint8_t {
+	 discrete,
+	 discrete_simultaneous,
+	 QSS,
+	 QSS_simultaneous,
+	 ZC,
+	 handler,
+	 handler_simultaneous
+	};
+
+	// Event Pass Record
+	struct Record
+	{
+		SuperdenseTime s; // Superdense time
+		Nanoseconds begin; // Wall-clock begin since open
+		Nanoseconds end; // Wall-clock end since open
+		std::uint32_t n_triggers; // Trigger count
+		std::uint32_t n_observers; // Observer count
+		Type type; // Event pass type
+	};
+
+public: // Creation
+
+	// Default Constructor
+	Tracer() = default;
+
+	// Destructor
+	~Tracer()
+	{
+		close();
+	}
+
+	// Copy Constructor
+	Tracer( Tracer const & ) = delete;
+
+	// Copy Assignment
+	Tracer &
+	operator =( Tracer const & ) = delete;
+
+public: // Predicates
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return writer_.joinable();
+	}
+
+public: // Properties
+
+	// Wall-Clock Nanoseconds Since Open
+	Nanoseconds
+	now() const
+	{
+		return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - t0_ ).count();
+	}
+
+	// Records Written
+	size_type
+	written() const
+	{
+		return tail_.load( std::memory_order_acquire );
+	}
+
+public: // Methods
+
+	// Open Trace File and Start Writer: Capacity Rounded Up to a Power of 2
+	bool
+	open( std::string const & name, size_type const capacity = 65536u );
+
+	// Flush and Close
+	void
+	close();
+
+	// Begin an Event Pass
+	void
+	begin( SuperdenseTime const & s )
+	{
+		s_ = s;
+		begin_ = now();
+	}
+
+	// End the Event Pass Begun Last
+	void
+	end( Type const type, size_type const n_triggers, size_type const n_observers )
+	{
+		push( Record{ s_, begin_, now(), static_cast< std::uint32_t >( n_triggers ), static_cast< std::uint32_t >( n_observers ), type } );
+	}
+
+	// Push a Record
+	void
+	push( Record const & record );
+
+private: // Methods
+
+	// Writer Thread Loop
+	void
+	run();
+
+	// Write Pending Records
+	void
+	drain();
+
+private: // Data
+
+	std::vector< Record > ring_; // Ring buffer
+	size_type mask_{ 0u }; // Ring index mask
+	std::atomic< size_type > head_{ 0u }; // Records pushed
+	std::atomic< size_type > tail_{ 0u }; // Records written
+	std::atomic< bool > done_{ false }; // Writer stop request
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	std::thread writer_;
+	std::ofstream stream_;
+	Clock::time_point t0_{ Clock::now() }; // Open time
+	bool first_{ true }; // First record written?
+	SuperdenseTime s_; // Active pass superdense time
+	Nanoseconds begin_{ 0 }; // Active pass begin
+
+};
+
+} // QSS
+
+#endif
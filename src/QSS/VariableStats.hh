@@ -0,0 +1,263 @@
+// Per-Variable Event Statistics
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_VariableStats_hh_INCLUDED
+#define QSS_VariableStats_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace QSS {
+
+// Per-Variable Event Statistics
+//
+// Counters live in a side array indexed like the model's variables: init assigns each variable's stats_slot
+// Step sizes are the intervals between successive requantizations (QSS, discrete, and handler events)
+template< typename V >
+class VariableStats
+{
+
+public: // Types
+
+	using Variable = V;
+	using Variables = std::vector< V * >;
+	using Time = double;
+	using size_type = std::size_t;
+
+	// Statistics of One Variable
+	struct Stat
+	{
+		size_type n_QSS{ 0u }; // Requantizations
+		size_type n_observer{ 0u }; // Observer advances received
+		size_type n_ZC{ 0u }; // Zero-crossings
+		size_type n_discrete{ 0u }; // Discrete events
+		size_type n_handler{ 0u }; // Handler events
+		size_type n_dt{ 0u }; // Steps
+		Time dt_min{ std::numeric_limits< Time >::infinity() }; // Min step
+		Time dt_max{ 0.0 }; // Max step
+		Time dt_sum{ 0.0 }; // Sum of steps
+		Time tQ{ 0.0 }; // Last requantization time
+
+		// Mean Step
+		Time
+		dt_mean() const
+		{
+			return ( n_dt > 0u ? dt_sum / n_dt : 0.0 );
+		}
+
+		// Events
+		size_type
+		n_events() const
+		{
+			return n_QSS + n_ZC + n_discrete + n_handler;
+		}
+	};
+
+	using Stats = std::vector< Stat >;
+
+public: // Creation
+
+	// Default Constructor
+	VariableStats() = default;
+
+	// Variables Constructor
+	VariableStats( Variables const & vars, Time const t0 )
+	{
+		init( vars, t0 );
+	}
+
+public: // Properties
+
+	// Statistics of a Variable
+	Stat const &
+	operator []( Variable const * var ) const
+	{
+		return stats_[ var->stats_slot ];
+	}
+
+public: // Methods
+
+	// Initialize for Variables
+	void
+	init( Variables const & vars, Time const t0 )
+	{
+		vars_ = &vars;
+		stats_.assign( vars.size(), Stat() );
+		for ( size_type i = 0, n = vars.size(); i < n; ++i ) {
+			vars[ i ]->stats_slot = i;
+			stats_[ i ].tQ = t0;
+		}
+	}
+
+	// Requantization Event
+	void
+	QSS( Variable const * var, Time const t )
+	{
+		Stat & s( stats_[ var->stats_slot ] );
+		++s.n_QSS;
+		step( s, t );
+	}
+
+	// Observer Advance
+	void
+	observer( Variable const * var )
+	{
+		++stats_[ var->stats_slot ].n_observer;
+	}
+
+	// Observer Advances of a Trigger's Observers
+	template< typename Observers >
+	void
+	observers( Observers const & observers )
+	{
+		for ( Variable const * observer : observers ) {
+			++stats_[ observer->stats_slot ].n_observer;
+		}
+	}
+
+	// Zero-Crossing Event
+	void
+	ZC( Variable const * var )
+	{
+		++stats_[ var->stats_slot ].n_ZC;
+	}
+
+	// Discrete Event
+	void
+	discrete( Variable const * var, Time const t )
+	{
+		Stat & s( stats_[ var->stats_slot ] );
+		++s.n_discrete;
+		step( s, t );
+	}
+
+	// Handler Event
+	void
+	handler( Variable const * var, Time const t )
+	{
+		Stat & s( stats_[ var->stats_slot ] );
+		++s.n_handler;
+		step( s, t );
+	}
+
+	// Write CSV Sorted by Descending Event Count
+	void
+	write( std::string const & name ) const
+	{
+		std::ofstream csv( name, std::ios_base::binary | std::ios_base::out );
+		if ( ! csv ) {
+			std::cerr << "Error: Variable statistics file open failed: " << name << std::endl;
+			return;
+		}
+		csv << std::setprecision( 16 );
+		csv << "name,requantizations,observer_advances,zero_crossings,discrete_events,handler_events,dt_min,dt_mean,dt_max\n";
+		for ( size_type const i : sorted() ) {
+			Stat const & s( stats_[ i ] );
+			csv << ( *vars_ )[ i ]->name << ',' << s.n_QSS << ',' << s.n_observer << ',' << s.n_ZC << ',' << s.n_discrete << ',' << s.n_handler << ',';
+			if ( s.n_dt > 0u ) {
+				csv << s.dt_min << ',' << s.dt_mean() << ',' << s.dt_max << '\n';
+			} else {
+				csv << ",,\n";
+			}
+		}
+	}
+
+	// Report the Hottest Variables
+	void
+	report( std::ostream & stream, size_type const n_hot = 10u ) const
+	{
+		std::vector< size_type > const order( sorted() );
+		size_type const n( std::min( n_hot, order.size() ) );
+		if ( n == 0u ) return;
+		stream << "\nHot Variables =====" << std::endl;
+		for ( size_type k = 0; k < n; ++k ) {
+			size_type const i( order[ k ] );
+			Stat const & s( stats_[ i ] );
+			if ( s.n_events() == 0u ) break;
+			stream << ( *vars_ )[ i ]->name << ": " << s.n_QSS << " requantizations, " << s.n_observer << " observer advances";
+			if ( s.n_ZC > 0u ) stream << ", " << s.n_ZC << " zero-crossings";
+			if ( s.n_discrete > 0u ) stream << ", " << s.n_discrete << " discrete events";
+			if ( s.n_handler > 0u ) stream << ", " << s.n_handler << " handler events";
+			if ( s.n_dt > 0u ) stream << ", mean step " << s.dt_mean();
+			stream << std::endl;
+		}
+	}
+
+private: // Methods
+
+	// Step Update
+	static
+	void
+	step( Stat & s, Time const t )
+	{
+		Time const dt( t - s.tQ );
+		++s.n_dt;
+		s.dt_min = std::min( s.dt_min, dt );
+		s.dt_max = std::max( s.dt_max, dt );
+		s.dt_sum += dt;
+		s.tQ = t;
+	}
+
+	// Indexes Sorted by Descending Event Count then Observer Advances
+	std::vector< size_type >
+	sorted() const
+	{
+		std::vector< size_type > order( stats_.size() );
+		for ( size_type i = 0, n = order.size(); i < n; ++i ) order[ i ] = i;
+		std::stable_sort( order.begin(), order.end(), [this]( size_type const i, size_type const j ){
+			Stat const & s( stats_[ i ] );
+			Stat const & r( stats_[ j ] );
+			return ( s.n_events() > r.n_events() ) || ( ( s.n_events() == r.n_events() ) && ( s.n_observer > r.n_observer ) );
+		} );
+		return order;
+	}
+
+private: // Data
+
+	Variables const * vars_{ nullptr }; // Model variables
+	Stats stats_; // Statistics side array
+
+};
+
+} // QSS
+
+#endif
@@ -0,0 +1,629 @@
+// Lane-Batched QSS2 LTI Ensemble Engine
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/Batch_LTI.hh>
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/Variable_QSS2.hh>
+#include <QSS/math.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <limits>
+#include <unordered_map>
+
+namespace QSS {
+namespace dfn {
+
+// Lane Kernels
+//
+// Loops over lane-contiguous values that the compiler vectorizes: Compiled for AVX2 on x86
+// GCC/Clang builds and selected at first use if supported. There is no AVX-512 variant because
+// it implies FMA, and contracting the sums would change their rounding from that of the scalar
+// Function_LTI sums that each lane matches
+namespace {
+
+using size_type = Batch_LTI::size_type;
+using Time = Batch_LTI::Time;
+using Value = Batch_LTI::Value;
+using Coefficient = Batch_LTI::Coefficient;
+using V = Variable_QSS2< mdl::Function_LTI >; // Supported variable type
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define QSS_BATCH_LTI_DISPATCH
+#define QSS_BATCH_LTI_INLINE inline __attribute__((always_inline))
+#else
+#define QSS_BATCH_LTI_INLINE inline
+#endif
+
+// Quantized Value Sums at Lane Times
+QSS_BATCH_LTI_INLINE
+void
+q_body( size_type const K, size_type const nT, size_type const * var, Coefficient const * coef, Coefficient const c0, Value const * q_0, Value const * q_1, Time const * tQ, Time const * t, Value * v )
+{
+	for ( size_type l = 0; l < K; ++l ) v[ l ] = c0;
+	for ( size_type k = 0; k < nT; ++k ) {
+		Coefficient const c( coef[ k ] );
+		size_type const o( var[ k ] * K );
+		Value const * q_0k( q_0 + o );
+		Value const * q_1k( q_1 + o );
+		Time const * tQk( tQ + o );
+		for ( size_type l = 0; l < K; ++l ) {
+			v[ l ] += c * ( q_0k[ l ] + ( q_1k[ l ] * ( t[ l ] - tQk[ l ] ) ) );
+		}
+	}
+}
+
+// Quantized First Derivative Sums
+QSS_BATCH_LTI_INLINE
+void
+q1_body( size_type const K, size_type const nT, size_type const * var, Coefficient const * coef, Value const * q_1, Value * v )
+{
+	for ( size_type l = 0; l < K; ++l ) v[ l ] = 0.0;
+	for ( size_type k = 0; k < nT; ++k ) {
+		Coefficient const c( coef[ k ] );
+		Value const * q_1k( q_1 + ( var[ k ] * K ) );
+		for ( size_type l = 0; l < K; ++l ) {
+			v[ l ] += c * q_1k[ l ];
+		}
+	}
+}
+
+// Kernel Function Pointer Types
+using Q_Kernel = void (*)( size_type, size_type, size_type const *, Coefficient const *, Coefficient, Value const *, Value const *, Time const *, Time const *, Value * );
+using Q1_Kernel = void (*)( size_type, size_type, size_type const *, Coefficient const *, Value const *, Value * );
+
+// Kernel Variants
+#define QSS_BATCH_LTI_KERNELS(SUFFIX,ATTR) \
+ATTR void q_##SUFFIX( size_type const K, size_type const nT, size_type const * var, Coefficient const * coef, Coefficient const c0, Value const * q_0, Value const * q_1, Time const * tQ, Time const * t, Value * v ) \
+{ q_body( K, nT, var, coef, c0, q_0, q_1, tQ, t, v ); } \
+ATTR void q1_##SUFFIX( size_type const K, size_type const nT, size_type const * var, Coefficient const * coef, Value const * q_1, Value * v ) \
+{ q1_body( K, nT, var, coef, q_1, v ); }
+
+QSS_BATCH_LTI_KERNELS(generic,)
+#ifdef QSS_BATCH_LTI_DISPATCH
+QSS_BATCH_LTI_KERNELS(avx2,__attribute__((target("avx2"))))
+#endif
+
+// Kernel Set
+struct Kernels
+{
+	Q_Kernel q;
+	Q1_Kernel q1;
+};
+
+// Kernel Set for the Running CPU
+Kernels
+kernels_select()
+{
+#ifdef QSS_BATCH_LTI_DISPATCH
+	__builtin_cpu_init();
+	if ( __builtin_cpu_supports( "avx2" ) ) return Kernels{ q_avx2, q1_avx2 };
+#endif
+	return Kernels{ q_generic, q1_generic };
+}
+
+// Kernel Set Singleton
+Kernels const &
+kernels()
+{
+	static Kernels const k( kernels_select() );
+	return k;
+}
+
+} // Internal
+
+// Model Variables, Lanes, and End Time Constructor: Variables of an Initialized Model
+Batch_LTI::
+Batch_LTI(
+ Variables const & vars,
+ size_type const K,
+ Time const tEnd
+) :
+ n_( vars.size() ),
+ K_( K )
+{
+	assert( K_ > 0u );
+	assert( is_batchable( vars ) );
+
+	// Model structure
+	std::unordered_map< Variable const *, size_type > var_idx;
+	for ( size_type i = 0; i < n_; ++i ) var_idx[ vars[ i ] ] = i;
+	names_.reserve( n_ );
+	c0_.reserve( n_ );
+	fBeg_.reserve( n_ + 1u );
+	oBeg_.reserve( n_ + 1u );
+	fBeg_.push_back( 0u );
+	oBeg_.push_back( 0u );
+	for ( Variable const * var : vars ) {
+		mdl::Function_LTI< Variable > const & d( static_cast< V const * >( var )->d() );
+		names_.push_back( var->name );
+		c0_.push_back( d.constant() );
+		for ( size_type k = 0, nT = d.coefficients().size(); k < nT; ++k ) { // Finalized term order
+			fVar_.push_back( var_idx[ d.variables()[ k ] ] );
+			fCoef_.push_back( d.coefficients()[ k ] );
+		}
+		fBeg_.push_back( fVar_.size() );
+		for ( Variable const * observer : var->observers() ) oVar_.push_back( var_idx[ observer ] );
+		oBeg_.push_back( oVar_.size() );
+		dt_min_.push_back( var->dt_min );
+		dt_max_.push_back( var->dt_max );
+		dt_inf_.push_back( var->dt_inf );
+	}
+
+	// Member state: Lanes start with the model's settings
+	size_type const nK( n_ * K_ );
+	rTol_.resize( nK );
+	aTol_.resize( nK );
+	xIni_.resize( nK );
+	for ( size_type i = 0; i < n_; ++i ) {
+		Variable const * var( vars[ i ] );
+		for ( size_type o = i * K_, e = o + K_; o < e; ++o ) {
+			rTol_[ o ] = var->rTol;
+			aTol_[ o ] = var->aTol;
+			xIni_[ o ] = var->xIni;
+		}
+	}
+	qTol_.resize( nK );
+	x_0_.resize( nK );
+	x_1_.resize( nK );
+	x_2_.resize( nK );
+	q_0_.resize( nK );
+	q_1_.resize( nK );
+	tQ_.resize( nK );
+	tX_.resize( nK );
+	tE_.resize( nK );
+	dt_inf_rlx_.resize( nK );
+	heap_.resize( nK );
+	pos_.resize( nK );
+	t_.assign( K_, 0.0 );
+	tEnd_.assign( K_, tEnd );
+	n_QSS_events_.assign( K_, 0u );
+	n_QSS_simultaneous_events_.assign( K_, 0u );
+	marks_.assign( n_, 0u );
+	tL_.assign( K_, 0.0 );
+	vL_.assign( K_, 0.0 );
+	lanes_.reserve( K_ );
+}
+
+// Variables Supported: QSS2 Variables with LTI Derivatives?
+bool
+Batch_LTI::
+is_batchable( Variables const & vars )
+{
+	if ( vars.empty() ) return false;
+	for ( Variable const * var : vars ) {
+		if ( dynamic_cast< V const * >( var ) == nullptr ) return false;
+	}
+	return true;
+}
+
+// Variable Index of a Name or n_vars() if None
+Batch_LTI::size_type
+Batch_LTI::
+index( std::string const & name ) const
+{
+	for ( size_type i = 0; i < n_; ++i ) {
+		if ( names_[ i ] == name ) return i;
+	}
+	return n_;
+}
+
+// Set a Member's Relative Tolerance for All Variables
+void
+Batch_LTI::
+set_rTol( size_type const l, Value const rTol )
+{
+	assert( l < K_ );
+	for ( size_type o = l, nK = n_ * K_; o < nK; o += K_ ) rTol_[ o ] = std::max( rTol, 0.0 );
+}
+
+// Set a Member's Absolute Tolerance for All Variables
+void
+Batch_LTI::
+set_aTol( size_type const l, Value const aTol )
+{
+	assert( l < K_ );
+	for ( size_type o = l, nK = n_ * K_; o < nK; o += K_ ) aTol_[ o ] = std::max( aTol, std::numeric_limits< Value >::min() );
+}
+
+// Initialize All Members at Time Zero: The Stages of Variable_QSS2 Initialization
+void
+Batch_LTI::
+init()
+{
+	std::fill( t_.begin(), t_.end(), 0.0 );
+	std::fill( n_QSS_events_.begin(), n_QSS_events_.end(), 0u );
+	std::fill( n_QSS_simultaneous_events_.begin(), n_QSS_simultaneous_events_.end(), 0u );
+	std::fill( marks_.begin(), marks_.end(), 0u );
+	std::fill( tL_.begin(), tL_.end(), 0.0 );
+	n_passes_ = 0u;
+	lanes_.clear();
+	for ( size_type l = 0; l < K_; ++l ) lanes_.push_back( l );
+	for ( size_type i = 0; i < n_; ++i ) { // Stage 0
+		for ( size_type o = i * K_, e = o + K_; o < e; ++o ) {
+			x_0_[ o ] = q_0_[ o ] = xIni_[ o ];
+			tQ_[ o ] = tX_[ o ] = 0.0;
+			dt_inf_rlx_[ o ] = ( dt_inf_[ i ] == infinity ? infinity : 0.5 * dt_inf_[ i ] );
+			set_qTol( o );
+		}
+	}
+	for ( size_type i = 0; i < n_; ++i ) { // Stage 1
+		q_lanes( i, tL_.data(), vL_.data() );
+		for ( size_type l = 0, o = i * K_; l < K_; ++l, ++o ) {
+			x_1_[ o ] = q_1_[ o ] = vL_[ l ];
+		}
+	}
+	for ( size_type i = 0; i < n_; ++i ) { // Stage 2
+		q1_lanes( i, vL_.data() );
+		for ( size_type l = 0, o = i * K_; l < K_; ++l, ++o ) {
+			x_2_[ o ] = one_half * vL_[ l ];
+			set_tE_aligned( i, o );
+		}
+	}
+	for ( size_type l = 0; l < K_; ++l ) { // Event queues
+		size_type const lN( l * n_ );
+		for ( size_type p = 0; p < n_; ++p ) {
+			heap_[ lN + p ] = p;
+			pos_[ ( p * K_ ) + l ] = p;
+			sift_up( l, p );
+		}
+	}
+}
+
+// Run All Members to their End Times
+void
+Batch_LTI::
+run()
+{
+	while ( true ) {
+
+		// Variables of the earliest member event at or before its end time
+		Time tMin( infinity );
+		size_type lMin( K_ );
+		for ( size_type l = 0; l < K_; ++l ) {
+			Time const tT( top_time( l ) );
+			if ( ( tT <= tEnd_[ l ] ) && ( ( lMin == K_ ) || ( tT < tMin ) ) ) {
+				tMin = tT;
+				lMin = l;
+			}
+		}
+		if ( lMin == K_ ) break; // All members are at their end times
+		top_vars( lMin, triggers_ );
+
+		// Lanes whose next events are those variables
+		lanes_.clear();
+		for ( size_type l = 0; l < K_; ++l ) {
+			if ( ( top_time( l ) <= tEnd_[ l ] ) && std::binary_search( triggers_.begin(), triggers_.end(), top( l ) ) ) {
+				top_vars( l, tops_ );
+				if ( tops_ == triggers_ ) lanes_.push_back( l );
+			}
+		}
+		size_type const pass( ++n_passes_ ); // Pass mark
+		bool const simultaneous( triggers_.size() > 1u );
+		for ( size_type const l : lanes_ ) {
+			++n_QSS_events_[ l ];
+			if ( simultaneous ) ++n_QSS_simultaneous_events_[ l ];
+		}
+
+		if ( ! simultaneous ) { // Requantization: Variable_QSS2::advance_QSS
+			size_type const i( triggers_.front() );
+			size_type const iK( i * K_ );
+			for ( size_type const l : lanes_ ) {
+				size_type const o( iK + l );
+				Time const tE( tE_[ o ] );
+				Time const tDel( ( tQ_[ o ] = tE ) - tX_[ o ] );
+				x_0_[ o ] = q_0_[ o ] = x_0_[ o ] + ( ( x_1_[ o ] + ( x_2_[ o ] * tDel ) ) * tDel );
+				set_qTol( o );
+				tL_[ l ] = t_[ l ] = tE;
+			}
+			q_lanes( i, tL_.data(), vL_.data() );
+			for ( size_type const l : lanes_ ) {
+				size_type const o( iK + l );
+				x_1_[ o ] = q_1_[ o ] = vL_[ l ];
+			}
+			q1_lanes( i, vL_.data() );
+			for ( size_type const l : lanes_ ) {
+				size_type const o( iK + l );
+				x_2_[ o ] = one_half * vL_[ l ];
+				tX_[ o ] = tL_[ l ];
+				set_tE_aligned( i, o );
+				shift( l, o );
+			}
+
+			// Observer advances: Variable_QSS2::advance_observer
+			for ( size_type k = oBeg_[ i ], e = oBeg_[ i + 1u ]; k < e; ++k ) {
+				advance_observer( oVar_[ k ] );
+			}
+		} else { // Simultaneous requantization: Variable_QSS2 stages of the Simulator's simultaneous triggers
+			for ( size_type const i : triggers_ ) { // Stage 0
+				marks_[ i ] = pass;
+				size_type const iK( i * K_ );
+				for ( size_type const l : lanes_ ) {
+					size_type const o( iK + l );
+					Time const tE( tE_[ o ] );
+					Time const tDel( ( tQ_[ o ] = tE ) - tX_[ o ] );
+					x_0_[ o ] = q_0_[ o ] = x_0_[ o ] + ( ( x_1_[ o ] + ( x_2_[ o ] * tDel ) ) * tDel );
+					tX_[ o ] = tE;
+					set_qTol( o );
+					tL_[ l ] = t_[ l ] = tE;
+				}
+			}
+			for ( size_type const i : triggers_ ) { // Stage 1: Triggers' simultaneous values at the pass time are their new quantized values
+				q_lanes( i, tL_.data(), vL_.data() );
+				for ( size_type const l : lanes_ ) {
+					size_type const o( ( i * K_ ) + l );
+					x_1_[ o ] = q_1_[ o ] = vL_[ l ];
+				}
+			}
+			for ( size_type const i : triggers_ ) { // Stage 2
+				q1_lanes( i, vL_.data() );
+				for ( size_type const l : lanes_ ) {
+					size_type const o( ( i * K_ ) + l );
+					x_2_[ o ] = one_half * vL_[ l ];
+					set_tE_aligned( i, o );
+					shift( l, o );
+				}
+			}
+
+			// Observer advances: Each observer other than the triggers once
+			observers_.clear();
+			for ( size_type const i : triggers_ ) {
+				for ( size_type k = oBeg_[ i ], e = oBeg_[ i + 1u ]; k < e; ++k ) {
+					size_type const j( oVar_[ k ] );
+					if ( marks_[ j ] != pass ) {
+						marks_[ j ] = pass;
+						observers_.push_back( j );
+					}
+				}
+			}
+			for ( size_type const j : observers_ ) {
+				advance_observer( j );
+			}
+		}
+	}
+	for ( size_type l = 0; l < K_; ++l ) t_[ l ] = tEnd_[ l ];
+}
+
+// Member's Next Event Variables: Those at its Next Event Time in Index Order
+void
+Batch_LTI::
+top_vars( size_type const l, Indexes & vars ) const
+{
+	size_type const * const heap( heap_.data() + ( l * n_ ) );
+	Time const tT( top_time( l ) );
+	vars.clear();
+	positions_.assign( 1u, 0u );
+	for ( size_type k = 0; k < positions_.size(); ++k ) { // Heap entries at the top time are a subtree of the root
+		size_type const p( positions_[ k ] );
+		vars.push_back( heap[ p ] );
+		for ( size_type c = ( p << 1 ) + 1u, e = std::min( c + 2u, n_ ); c < e; ++c ) {
+			if ( tE_[ ( heap[ c ] * K_ ) + l ] == tT ) positions_.push_back( c );
+		}
+	}
+	std::sort( vars.begin(), vars.end() );
+}
+
+// Observer Advance of Variable j in the Pass's Lanes: Variable_QSS2::advance_observer
+void
+Batch_LTI::
+advance_observer( size_type const j )
+{
+	size_type const jK( j * K_ );
+	q_lanes( j, tL_.data(), vL_.data() );
+	for ( size_type const l : lanes_ ) {
+		size_type const o( jK + l );
+		Time const tDel( tL_[ l ] - tX_[ o ] );
+		x_0_[ o ] = x_0_[ o ] + ( ( x_1_[ o ] + ( x_2_[ o ] * tDel ) ) * tDel );
+		x_1_[ o ] = vL_[ l ];
+	}
+	q1_lanes( j, vL_.data() );
+	for ( size_type const l : lanes_ ) {
+		size_type const o( jK + l );
+		x_2_[ o ] = one_half * vL_[ l ];
+		tX_[ o ] = tL_[ l ];
+		set_tE_unaligned( j, o );
+		shift( l, o );
+	}
+}
+
+// Shift a Member's Variable Event to its End Time
+void
+Batch_LTI::
+shift( size_type const l, size_type const o )
+{
+	size_type const p( pos_[ o ] );
+	if ( ( p > 0u ) && ( tE_[ o ] < tE_[ ( heap_[ ( l * n_ ) + ( ( p - 1u ) >> 1 ) ] * K_ ) + l ] ) ) {
+		sift_up( l, p );
+	} else {
+		sift_down( l, p );
+	}
+}
+
+// Sift a Member's Heap Entry Up Toward the Top
+void
+Batch_LTI::
+sift_up( size_type const l, size_type p )
+{
+	size_type * const heap( heap_.data() + ( l * n_ ) );
+	size_type const i( heap[ p ] );
+	Time const tE( tE_[ ( i * K_ ) + l ] );
+	while ( p > 0u ) {
+		size_type const a( ( p - 1u ) >> 1 ); // Parent
+		size_type const j( heap[ a ] );
+		if ( ! ( tE < tE_[ ( j * K_ ) + l ] ) ) break;
+		heap[ p ] = j;
+		pos_[ ( j * K_ ) + l ] = p;
+		p = a;
+	}
+	heap[ p ] = i;
+	pos_[ ( i * K_ ) + l ] = p;
+}
+
+// Sift a Member's Heap Entry Down Away From the Top
+void
+Batch_LTI::
+sift_down( size_type const l, size_type p )
+{
+	size_type * const heap( heap_.data() + ( l * n_ ) );
+	size_type const i( heap[ p ] );
+	Time const tE( tE_[ ( i * K_ ) + l ] );
+	while ( true ) {
+		size_type c( ( p << 1 ) + 1u ); // Left child
+		if ( c >= n_ ) break;
+		Time tC( tE_[ ( heap[ c ] * K_ ) + l ] );
+		if ( c + 1u < n_ ) { // Right child
+			Time const tR( tE_[ ( heap[ c + 1u ] * K_ ) + l ] );
+			if ( tR < tC ) {
+				++c;
+				tC = tR;
+			}
+		}
+		if ( ! ( tC < tE ) ) break;
+		size_type const j( heap[ c ] );
+		heap[ p ] = j;
+		pos_[ ( j * K_ ) + l ] = p;
+		p = c;
+	}
+	heap[ p ] = i;
+	pos_[ ( i * K_ ) + l ] = p;
+}
+
+// Derivative Quantized Values of Variable i at Lane Times t
+void
+Batch_LTI::
+q_lanes( size_type const i, Time const * t, Value * v ) const
+{
+	size_type const b( fBeg_[ i ] ), nT( fBeg_[ i + 1u ] - b );
+	if ( 2u * lanes_.size() >= K_ ) { // Dense: All lanes in vector kernel
+		kernels().q( K_, nT, fVar_.data() + b, fCoef_.data() + b, c0_[ i ], q_0_.data(), q_1_.data(), tQ_.data(), t, v );
+	} else { // Sparse: Active lanes
+		for ( size_type const l : lanes_ ) {
+			Value s( c0_[ i ] );
+			for ( size_type k = b, e = b + nT; k < e; ++k ) {
+				size_type const o( ( fVar_[ k ] * K_ ) + l );
+				s += fCoef_[ k ] * ( q_0_[ o ] + ( q_1_[ o ] * ( t[ l ] - tQ_[ o ] ) ) );
+			}
+			v[ l ] = s;
+		}
+	}
+}
+
+// Derivative Quantized First Derivatives of Variable i
+void
+Batch_LTI::
+q1_lanes( size_type const i, Value * v ) const
+{
+	size_type const b( fBeg_[ i ] ), nT( fBeg_[ i + 1u ] - b );
+	if ( 2u * lanes_.size() >= K_ ) { // Dense: All lanes in vector kernel
+		kernels().q1( K_, nT, fVar_.data() + b, fCoef_.data() + b, q_1_.data(), v );
+	} else { // Sparse: Active lanes
+		for ( size_type const l : lanes_ ) {
+			Value s( 0.0 );
+			for ( size_type k = b, e = b + nT; k < e; ++k ) {
+				s += fCoef_[ k ] * q_1_[ ( fVar_[ k ] * K_ ) + l ];
+			}
+			v[ l ] = s;
+		}
+	}
+}
+
+// Set End Time: Quantized and Continuous Aligned
+void
+Batch_LTI::
+set_tE_aligned( size_type const i, size_type const o )
+{
+	assert( tX_[ o ] <= tQ_[ o ] );
+	assert( dt_min_[ i ] <= dt_max_[ i ] );
+	Value const x_1( x_1_[ o ] ), x_2( x_2_[ o ] );
+	Time dt( x_2 != 0.0 ? std::sqrt( qTol_[ o ] / std::abs( x_2 ) ) : infinity );
+	dt = std::min( std::max( dt, dt_min_[ i ] ), dt_max_[ i ] );
+	Time & tE( tE_[ o ] );
+	tE = ( dt != infinity ? tQ_[ o ] + dt : infinity );
+	if ( ( options::inflection ) && ( x_2 != 0.0 ) && ( signum( x_1 ) != signum( x_2 ) ) ) {
+		Time const tI( tX_[ o ] - ( x_1 / ( two * x_2 ) ) );
+		if ( tQ_[ o ] < tI ) tE = std::min( tE, tI );
+	}
+	tE_infinity( i, o, tQ_[ o ] );
+}
+
+// Set End Time: Quantized and Continuous Unaligned
+void
+Batch_LTI::
+set_tE_unaligned( size_type const i, size_type const o )
+{
+	assert( tQ_[ o ] <= tX_[ o ] );
+	assert( dt_min_[ i ] <= dt_max_[ i ] );
+	Value const x_1( x_1_[ o ] ), x_2( x_2_[ o ] ), q_1( q_1_[ o ] ), qTol( qTol_[ o ] );
+	Time const tX( tX_[ o ] );
+	Value const d0( x_0_[ o ] - ( q_0_[ o ] + ( q_1 * ( tX - tQ_[ o ] ) ) ) );
+	Value const d1( x_1 - q_1 );
+	Time dt;
+	if ( ( d1 >= 0.0 ) && ( x_2 >= 0.0 ) ) { // Upper boundary crossing
+		dt = min_root_quadratic_upper( x_2, d1, d0 - qTol );
+	} else if ( ( d1 <= 0.0 ) && ( x_2 <= 0.0 ) ) { // Lower boundary crossing
+		dt = min_root_quadratic_lower( x_2, d1, d0 + qTol );
+	} else { // Both boundaries can have crossings
+		dt = min_root_quadratic_both( x_2, d1, d0 + qTol, d0 - qTol );
+	}
+	dt = std::min( std::max( dt, dt_min_[ i ] ), dt_max_[ i ] );
+	Time & tE( tE_[ o ] );
+	tE = ( dt == infinity ? infinity : tX + dt );
+	if ( ( options::inflection ) && ( x_2 != 0.0 ) && ( signum( x_1 ) != signum( x_2 ) ) && ( signum( x_1 ) == signum( q_1 ) ) ) {
+		Time const tI( tX - ( x_1 / ( two * x_2 ) ) );
+		if ( tX < tI ) tE = std::min( tE, tI );
+	}
+	tE_infinity( i, o, tX );
+}
+
+// Infinite Time Step Processing from a Time
+void
+Batch_LTI::
+tE_infinity( size_type const i, size_type const o, Time const t )
+{
+	if ( dt_inf_[ i ] != infinity ) { // Deactivation control is enabled
+		if ( tE_[ o ] == infinity ) { // Deactivation has occurred
+			if ( dt_inf_rlx_[ o ] < half_infinity ) { // Relax and use deactivation time step
+				dt_inf_rlx_[ o ] *= 2.0;
+				tE_[ o ] = t + dt_inf_rlx_[ o ];
+			}
+		} else { // Reset deactivation time step
+			dt_inf_rlx_[ o ] = dt_inf_[ i ];
+		}
+	}
+}
+
+} // dfn
+} // QSS
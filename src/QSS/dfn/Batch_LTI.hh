@@ -0,0 +1,322 @@
+// Lane-Batched QSS2 LTI Ensemble Engine
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_Batch_LTI_hh_INCLUDED
+#define QSS_dfn_Batch_LTI_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/Variable.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+
+// Lane-Batched QSS2 LTI Ensemble Engine
+//
+// Simulates K members of a QSS2 model with LTI derivatives that share its structure but can
+// differ in tolerances, initial values, and end times. Each member has its own event queue and
+// timeline: the member with the earliest event selects the variables to requantize and every
+// member whose next events are those variables requantizes them in the same pass, with the
+// derivative sums evaluated for all the lanes at once over lane-contiguous trajectory coefficients
+//
+// Requantizations that coincide within a member are staged as the Simulator's simultaneous
+// triggers are, so each member performs the same floating point operations as its own Simulator
+// run with the plain (not incremental or vectorized) LTI sums and counts the same passes
+class Batch_LTI
+{
+
+public: // Types
+
+	using Variables = Variable::Variables;
+	using size_type = std::size_t;
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+	using Coefficient = double;
+
+private: // Types
+
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+	using Coefficients = std::vector< Coefficient >;
+	using Indexes = std::vector< size_type >;
+
+public: // Creation
+
+	// Model Variables, Lanes, and End Time Constructor: Variables of an Initialized Model
+	Batch_LTI(
+	 Variables const & vars,
+	 size_type const K,
+	 Time const tEnd
+	);
+
+public: // Predicates
+
+	// Variables Supported: QSS2 Variables with LTI Derivatives?
+	static
+	bool
+	is_batchable( Variables const & vars );
+
+public: // Properties
+
+	// Lanes
+	size_type
+	n_lanes() const
+	{
+		return K_;
+	}
+
+	// Variables
+	size_type
+	n_vars() const
+	{
+		return n_;
+	}
+
+	// Variable Name
+	std::string const &
+	name( size_type const i ) const
+	{
+		assert( i < n_ );
+		return names_[ i ];
+	}
+
+	// Variable Index of a Name or n_vars() if None
+	size_type
+	index( std::string const & name ) const;
+
+	// Member Current Time
+	Time
+	t( size_type const l ) const
+	{
+		assert( l < K_ );
+		return t_[ l ];
+	}
+
+	// Member End Time
+	Time
+	tEnd( size_type const l ) const
+	{
+		assert( l < K_ );
+		return tEnd_[ l ];
+	}
+
+	// Member Continuous Value of a Variable at the Member's Current Time
+	Value
+	x( size_type const l, size_type const i ) const
+	{
+		assert( l < K_ );
+		assert( i < n_ );
+		size_type const o( ( i * K_ ) + l );
+		Time const tDel( t_[ l ] - tX_[ o ] );
+		return x_0_[ o ] + ( ( x_1_[ o ] + ( x_2_[ o ] * tDel ) ) * tDel );
+	}
+
+	// Member Requantization Event Passes
+	size_type
+	n_QSS_events( size_type const l ) const
+	{
+		assert( l < K_ );
+		return n_QSS_events_[ l ];
+	}
+
+	// Member Simultaneous Requantization Event Passes
+	size_type
+	n_QSS_simultaneous_events( size_type const l ) const
+	{
+		assert( l < K_ );
+		return n_QSS_simultaneous_events_[ l ];
+	}
+
+	// Requantization Passes: Each Requantizes the Same Variables in One or More Lanes
+	size_type
+	n_passes() const
+	{
+		return n_passes_;
+	}
+
+public: // Methods
+
+	// Set a Member's Relative Tolerance for All Variables
+	void
+	set_rTol( size_type const l, Value const rTol );
+
+	// Set a Member's Absolute Tolerance for All Variables
+	void
+	set_aTol( size_type const l, Value const aTol );
+
+	// Set a Member's Initial Value of a Variable
+	void
+	set_xIni( size_type const l, size_type const i, Value const x )
+	{
+		assert( l < K_ );
+		assert( i < n_ );
+		xIni_[ ( i * K_ ) + l ] = x;
+	}
+
+	// Set a Member's End Time
+	void
+	set_tEnd( size_type const l, Time const tEnd )
+	{
+		assert( l < K_ );
+		tEnd_[ l ] = tEnd;
+	}
+
+	// Initialize All Members at Time Zero
+	void
+	init();
+
+	// Run All Members to their End Times
+	void
+	run();
+
+private: // Methods
+
+	// Derivative Quantized Values of Variable i at Lane Times t
+	void
+	q_lanes( size_type const i, Time const * t, Value * v ) const;
+
+	// Derivative Quantized First Derivatives of Variable i
+	void
+	q1_lanes( size_type const i, Value * v ) const;
+
+	// Set Current Tolerance
+	void
+	set_qTol( size_type const o )
+	{
+		qTol_[ o ] = std::max( rTol_[ o ] * std::abs( q_0_[ o ] ), aTol_[ o ] );
+		assert( qTol_[ o ] > 0.0 );
+	}
+
+	// Set End Time: Quantized and Continuous Aligned
+	void
+	set_tE_aligned( size_type const i, size_type const o );
+
+	// Set End Time: Quantized and Continuous Unaligned
+	void
+	set_tE_unaligned( size_type const i, size_type const o );
+
+	// Infinite Time Step Processing from a Time
+	void
+	tE_infinity( size_type const i, size_type const o, Time const t );
+
+	// Member's Next Event Variable
+	size_type
+	top( size_type const l ) const
+	{
+		return heap_[ l * n_ ];
+	}
+
+	// Member's Next Event Time
+	Time
+	top_time( size_type const l ) const
+	{
+		return tE_[ ( heap_[ l * n_ ] * K_ ) + l ];
+	}
+
+	// Member's Next Event Variables: Those at its Next Event Time in Index Order
+	void
+	top_vars( size_type const l, Indexes & vars ) const;
+
+	// Observer Advance of Variable j in the Pass's Lanes
+	void
+	advance_observer( size_type const j );
+
+	// Shift a Member's Variable Event to its End Time
+	void
+	shift( size_type const l, size_type const o );
+
+	// Sift a Member's Heap Entry Up Toward the Top
+	void
+	sift_up( size_type const l, size_type p );
+
+	// Sift a Member's Heap Entry Down Away From the Top
+	void
+	sift_down( size_type const l, size_type p );
+
+private: // Data
+
+	size_type n_{ 0u }; // Variables
+	size_type K_{ 0u }; // Lanes
+
+	// Model structure: Shared by the members
+	std::vector< std::string > names_; // Variable names
+	Coefficients c0_; // Derivative constant terms
+	Indexes fBeg_; // Derivative term ranges
+	Indexes fVar_; // Derivative term variable indexes
+	Coefficients fCoef_; // Derivative term coefficients
+	Indexes oBeg_; // Observer ranges
+	Indexes oVar_; // Observer variable indexes
+	Times dt_min_, dt_max_, dt_inf_; // Time step controls
+
+	// Member state: Variable-major with lane-contiguous values at [ i * K + l ]
+	Values rTol_, aTol_, qTol_; // Tolerances
+	Values xIni_; // Initial values
+	Values x_0_, x_1_, x_2_; // Continuous rep coefficients
+	Values q_0_, q_1_; // Quantized rep coefficients
+	Times tQ_, tX_, tE_; // Quantized and continuous range begin times and end time
+	Times dt_inf_rlx_; // Relaxed time step inf
+	Indexes heap_; // Member event queues: Binary min-heaps of variable indexes by end time at [ l * n + p ]
+	Indexes pos_; // Variable heap positions
+
+	// Member timing and counts
+	Times t_; // Current times
+	Times tEnd_; // End times
+	Indexes n_QSS_events_; // Requantization event passes
+	Indexes n_QSS_simultaneous_events_; // Simultaneous requantization event passes
+	size_type n_passes_{ 0u }; // Requantization passes
+
+	// Lane scratch
+	mutable Times tL_; // Lane times
+	mutable Values vL_; // Lane values
+	Indexes lanes_; // Active lanes
+	Indexes triggers_; // Pass variables
+	Indexes observers_; // Pass observers
+	Indexes tops_; // Lane's next event variables
+	mutable Indexes positions_; // Heap positions
+	Indexes marks_; // Pass marks of the triggers and observers
+
+};
+
+} // dfn
+} // QSS
+
+#endif
@@ -0,0 +1,698 @@
+// QSS Defined Model Variable Cluster
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// QSS Headers
+#include <QSS/dfn/Cluster.hh>
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/Variable_QSS.hh>
+#include <QSS/options.hh>
+#include <QSS/Partition.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace QSS {
+namespace dfn {
+
+namespace { // Internal
+
+using V = Variable_QSS< mdl::Function_LTI >; // Supported variable type
+using size_type = Cluster::size_type;
+
+// Min Time from an Item to a Requantization of an Observer it Advances
+//
+// Observer advances can't put requantizations closer than dt_min unless inflection or deactivation steps shorten them
+Cluster::Time
+lookahead_of( Variable const * var )
+{
+	return ( ( ! options::inflection ) && ( options::dtInf == infinity ) ) ? var->dt_min : Cluster::Time( 0.0 );
+}
+
+} // Internal
+
+// Destructor
+Cluster::
+~Cluster()
+{
+	for ( Variable_Ghost * ghost : ghosts_ ) delete ghost;
+}
+
+// Next Item Time Including Messages in Transit: Infinity if None
+Cluster::Time
+Cluster::
+next() const
+{
+	Time t( next( events_ ) );
+	for ( Envelope const & envelope : incoming_ ) {
+		t = std::min( t, envelope.key.s.t );
+	}
+	return t;
+}
+
+// Next Item Superdense Time Including Messages in Transit: Infinity if None
+SuperdenseTime
+Cluster::
+next_superdense() const
+{
+	SuperdenseTime s( events_.empty() ? SuperdenseTime( infinity ) : events_.top_superdense_time() );
+	if ( ( ! inbox_.empty() ) && ( inbox_.begin()->first.s < s ) ) s = inbox_.begin()->first.s;
+	for ( Envelope const & envelope : incoming_ ) {
+		if ( envelope.key.s < s ) s = envelope.key.s;
+	}
+	return s;
+}
+
+// Earliest Output Time: No Message Can Go Out Before It
+Cluster::Time
+Cluster::
+eot() const
+{
+	Time t( next() + lookahead_ ); // Earliest boundary requantization an item can cause
+	for ( Variable const * var : boundary_ ) {
+		t = std::min( t, var->tE );
+	}
+	return t;
+}
+
+// Refresh the Ghosts from their Sources: Between Initialization Stages
+void
+Cluster::
+refresh()
+{
+	for ( Variable_Ghost * ghost : ghosts_ ) {
+		ghost->refresh();
+	}
+}
+
+// Schedule the Variables' Requantizations in the Cluster's Queue: After Initialization
+void
+Cluster::
+schedule()
+{
+	events_.clear();
+	for ( Variable * var : vars_ ) {
+		var->set_queue( events_ );
+	}
+	for ( Variable_Ghost * ghost : ghosts_ ) {
+		ghost->set_queue( events_ );
+	}
+	events_.add_QSS( vars_ );
+	events_.journal( optimistic_ ? &shifts_ : nullptr );
+}
+
+// Advance Through Items Before a Bound Time and at or Before a Stop Time
+void
+Cluster::
+advance( Time const tB, Time const tS )
+{
+	while ( true ) {
+		Time const t( next( events_ ) );
+		if ( ( t >= tB ) || ( t > tS ) ) break;
+		process();
+	}
+}
+
+// Advance Through the Next Item
+void
+Cluster::
+step()
+{
+	if ( next( events_ ) < infinity ) process();
+}
+
+// Speculatively Advance Through Up to n Items at or Before a Stop Time: Optimistic Synchronization
+void
+Cluster::
+speculate( Time const tS, size_type const n )
+{
+	assert( optimistic_ );
+	accept();
+	for ( size_type i = 0; i < n; ++i ) {
+		if ( next( events_ ) > tS ) break;
+		if ( held_ && ( ! ( next_superdense() < hold_ ) ) ) break;
+		process();
+	}
+}
+
+// Send the Outgoing Messages to their Clusters
+void
+Cluster::
+send( Clusters & clusters )
+{
+	for ( Envelope const & envelope : outbox_ ) {
+		Message const & message( envelope.message );
+		assert( message.ghost->cluster() < clusters.size() );
+		Cluster & cluster( *clusters[ message.ghost->cluster() ] );
+		if ( cluster.optimistic_ ) { // Accepted by the cluster in its next advance
+			cluster.incoming_.push_back( envelope );
+		} else {
+			assert( ! envelope.anti );
+			cluster.inbox_.emplace( envelope.key, message );
+		}
+	}
+	outbox_.clear();
+}
+
+// Accept the Messages in Transit: Stragglers and Anti-Messages for Processed Messages Roll Back
+//
+// Messages at a superdense time are received together so a message at the superdense time of
+// processed messages rolls back to the first of them
+void
+Cluster::
+accept()
+{
+	for ( Envelope const & envelope : incoming_ ) {
+		Key const & key( envelope.key );
+		Key const first{ key.s, 1u, 0u }; // First message key at the superdense time
+		if ( envelope.anti ) { // Cancel the message
+			if ( inbox_.find( key ) == inbox_.end() ) rollback( first ); // Processed: Roll back its receipt
+			assert( inbox_.find( key ) != inbox_.end() );
+			inbox_.erase( key );
+		} else {
+			for ( auto r = records_.rbegin(); ( r != records_.rend() ) && ( ! ( r->key.s < key.s ) ); ++r ) {
+				if ( ( ! r->received ) && ( r->key.s == key.s ) ) { // Processed pass at the message's superdense time
+					tie( key.s );
+					break;
+				}
+			}
+			if ( ( ! records_.empty() ) && ( ! ( records_.back().key < first ) ) ) rollback( first ); // Straggler
+			inbox_.emplace( key, envelope.message );
+		}
+	}
+	incoming_.clear();
+}
+
+// Roll Back to a Superdense Time and Hold Before It: Optimistic Synchronization
+void
+Cluster::
+hold( SuperdenseTime const & s )
+{
+	assert( optimistic_ );
+	Key const key{ s, 0u, 0u };
+	if ( ( ! records_.empty() ) && ( ! ( records_.back().key < key ) ) ) rollback( key );
+	held_ = true;
+	hold_ = s;
+	tied_ = false;
+}
+
+// Discard the Rollback Logs of Items Before the Global Virtual Time
+void
+Cluster::
+commit( Time const gvt )
+{
+	size_type n( 0u ); // Committed records
+	while ( ( n < records_.size() ) && ( records_[ n ].key.s.t < gvt ) ) ++n;
+	if ( n == 0u ) return;
+	if ( n == records_.size() ) {
+		records_.clear();
+		states_.clear();
+		sum_states_.clear();
+		shifts_.clear();
+		sent_.clear();
+	} else {
+		Record const first( records_[ n ] );
+		records_.erase( records_.begin(), records_.begin() + n );
+		states_.erase( states_.begin(), states_.begin() + first.iState );
+		sum_states_.erase( sum_states_.begin(), sum_states_.begin() + first.iSum );
+		shifts_.erase( shifts_.begin(), shifts_.begin() + first.iShift );
+		sent_.erase( sent_.begin(), sent_.begin() + first.iSent );
+		for ( Record & record : records_ ) {
+			record.iState -= first.iState;
+			record.iSum -= first.iSum;
+			record.iShift -= first.iShift;
+			record.iSent -= first.iSent;
+		}
+	}
+}
+
+// Partition LTI QSS Variables into Clusters: False if Other Variable Types are Present
+bool
+Cluster::
+partition( Variables const & vars, size_type const n, Clusters & clusters )
+{
+	clusters.clear();
+	size_type const n_vars( vars.size() );
+
+	// Supported models: LTI QSS variables depending only on each other
+	std::unordered_map< Variable const *, size_type > var_idx;
+	for ( size_type i = 0; i < n_vars; ++i ) {
+		var_idx[ vars[ i ] ] = i;
+	}
+	std::vector< V * > lti;
+	lti.reserve( n_vars );
+	for ( Variable * var : vars ) {
+		V * v( dynamic_cast< V * >( var ) );
+		if ( v == nullptr ) return false;
+		for ( Variable const * x : v->d().variables() ) {
+			if ( var_idx.find( x ) == var_idx.end() ) return false;
+		}
+		lti.push_back( v );
+	}
+
+	// Partition of the dependency graph
+	Partition::Adjacency adjacency( n_vars );
+	for ( size_type i = 0; i < n_vars; ++i ) {
+		for ( Variable const * x : lti[ i ]->d().variables() ) {
+			adjacency[ i ].push_back( var_idx[ x ] );
+		}
+	}
+	Partition const partition( adjacency, n );
+	for ( size_type p = 0; p < partition.n_parts(); ++p ) {
+		clusters.emplace_back( new Cluster( p ) );
+	}
+	for ( size_type i = 0; i < n_vars; ++i ) {
+		clusters[ partition[ i ] ]->vars_.push_back( vars[ i ] );
+	}
+
+	// Ghosts of other clusters' variables replace them in the derivatives
+	std::vector< std::unordered_map< Variable const *, Variable_Ghost * > > cluster_ghosts( clusters.size() ); // Ghosts by source in each cluster
+	for ( size_type i = 0; i < n_vars; ++i ) {
+		size_type const p( partition[ i ] );
+		Cluster & cluster( *clusters[ p ] );
+		Variables const xs( lti[ i ]->d().variables() ); // Copy since replaced below
+		for ( Variable * x : xs ) {
+			size_type const q( partition[ var_idx[ x ] ] );
+			if ( q == p ) continue;
+			Variable_Ghost * & ghost( cluster_ghosts[ p ][ x ] );
+			if ( ghost == nullptr ) { // New ghost
+				ghost = new Variable_Ghost( x, p );
+				cluster.ghosts_.push_back( ghost );
+				Cluster & source( *clusters[ q ] );
+				Ghosts & links( source.links_[ x ] );
+				if ( links.empty() ) source.boundary_.push_back( x );
+				links.push_back( ghost );
+				if ( std::find( cluster.feeders_.begin(), cluster.feeders_.end(), q ) == cluster.feeders_.end() ) cluster.feeders_.push_back( q );
+			}
+			lti[ i ]->d().replace( x, ghost );
+		}
+	}
+
+	// Lookahead: Min over the boundary variables
+	for ( auto & cluster : clusters ) {
+		std::sort( cluster->feeders_.begin(), cluster->feeders_.end() );
+		Time lookahead( infinity );
+		for ( Variable const * var : cluster->boundary_ ) {
+			lookahead = std::min( lookahead, lookahead_of( var ) );
+		}
+		cluster->lookahead_ = lookahead;
+	}
+	return true;
+}
+
+// Positive Lookahead for Conservative Synchronization? False if Every Variable's Lookahead is Zero
+bool
+Cluster::
+has_lookahead( Variables const & vars )
+{
+	for ( Variable const * var : vars ) {
+		if ( lookahead_of( var ) > 0.0 ) return true;
+	}
+	return false;
+}
+
+// Requantization Pass Merged Across the Clusters with Passes at a Superdense Time: The Next Items of Every Cluster
+//
+// The triggers' stages run as in a cluster's simultaneous pass with their ghosts refreshed from the
+// simultaneous representations between stages, then the ghosts take the quantized representations
+// and the observers of the triggers and ghosts advance once: No messages are posted and since no
+// item is earlier the pass is never rolled back so it isn't recorded
+void
+Cluster::
+requantize( Clusters & clusters, SuperdenseTime const & s )
+{
+	Time const t( s.t );
+	Variables triggers;
+	Ghosts ghosts; // Triggers' ghosts in other clusters
+	Cluster * first( nullptr ); // First cluster with a pass: Counts the pass
+	for ( auto & cluster : clusters ) {
+		if ( ! cluster->pass_at( s ) ) continue;
+		if ( first == nullptr ) first = cluster.get();
+		cluster->events_.set_active_time();
+		for ( Variable * trigger : cluster->events_.top_vars() ) {
+			triggers.push_back( trigger );
+			auto const i( cluster->links_.find( trigger ) );
+			if ( i != cluster->links_.end() ) ghosts.insert( ghosts.end(), i->second.begin(), i->second.end() );
+		}
+	}
+	assert( first != nullptr );
+	for ( Variable_Ghost * ghost : ghosts ) {
+		clusters[ ghost->cluster() ]->events_.set_active_time( s ); // Observers reschedule as in the pass
+	}
+	++first->n_QSS_events_;
+	if ( triggers.size() > 1u ) ++first->n_QSS_simultaneous_events_;
+	++first->n_processed_;
+	first->passes_.emplace_back( s, triggers.size() );
+
+	std::sort( triggers.begin(), triggers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort triggers by order
+	for ( Variable * trigger : triggers ) {
+		trigger->sT = s; // Set trigger superdense time
+	}
+	size_type const iBeg_triggers_2( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+	size_type const iBeg_triggers_3( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 3; } ) ) ) );
+	int const triggers_order_max( triggers.empty() ? 0 : triggers.back()->order() );
+	for ( Variable * trigger : triggers ) {
+		assert( trigger->tE == t );
+		trigger->advance_QSS_0();
+	}
+	for ( Variable_Ghost * ghost : ghosts ) ghost->refresh_simultaneous( t );
+	for ( Variable * trigger : triggers ) {
+		trigger->advance_QSS_1();
+	}
+	if ( triggers_order_max >= 2 ) { // 2nd order pass
+		for ( Variable_Ghost * ghost : ghosts ) ghost->refresh_simultaneous( t );
+		for ( size_type i = iBeg_triggers_2, n = triggers.size(); i < n; ++i ) {
+			triggers[ i ]->advance_QSS_2();
+		}
+		if ( triggers_order_max >= 3 ) { // 3rd order pass
+			for ( Variable_Ghost * ghost : ghosts ) ghost->refresh_simultaneous( t );
+			for ( size_type i = iBeg_triggers_3, n = triggers.size(); i < n; ++i ) {
+				triggers[ i ]->advance_QSS_3();
+			}
+		}
+	}
+	for ( Variable_Ghost * ghost : ghosts ) ghost->refresh();
+
+	Variables passed( triggers ); // Triggers and their ghosts
+	passed.insert( passed.end(), ghosts.begin(), ghosts.end() );
+	Variable::advance_sums( passed );
+	Variables const observers( Variable::pass_observers( passed, true ) );
+	Variable::batch_begin( passed, t );
+	for ( Variable * observer : observers ) {
+		observer->advance_observer( t );
+	}
+	Variable::batch_end( passed );
+}
+
+// Count the Passes Before a Superdense Time as the Serial Loop Does: Passes at a Superdense Time in Several Clusters Count Once
+void
+Cluster::
+count( Clusters & clusters, SuperdenseTime const & s, size_type & n_QSS_events, size_type & n_QSS_simultaneous_events )
+{
+	Passes passes;
+	for ( auto & cluster : clusters ) { // Each cluster's passes are in superdense time order
+		Passes & cluster_passes( cluster->passes_ );
+		auto const e( std::lower_bound( cluster_passes.begin(), cluster_passes.end(), s, []( Pass const & pass, SuperdenseTime const & sB ){ return pass.first < sB; } ) );
+		passes.insert( passes.end(), cluster_passes.begin(), e );
+		cluster_passes.erase( cluster_passes.begin(), e );
+	}
+	std::sort( passes.begin(), passes.end(), []( Pass const & p1, Pass const & p2 ){ return p1.first < p2.first; } );
+	for ( size_type i = 0, n = passes.size(); i < n; ) {
+		SuperdenseTime const sP( passes[ i ].first );
+		size_type n_triggers( 0u );
+		for ( ; ( i < n ) && ( passes[ i ].first == sP ); ++i ) n_triggers += passes[ i ].second;
+		++n_QSS_events;
+		if ( n_triggers > 1u ) ++n_QSS_simultaneous_events;
+	}
+}
+
+// Next Item Time with an Event Queue: Infinity if None
+Cluster::Time
+Cluster::
+next( EventQueue< Variable > const & queue ) const
+{
+	Time const tE( queue.empty() ? infinity : queue.top_time() );
+	Time const tM( inbox_.empty() ? infinity : inbox_.begin()->first.s.t );
+	return std::min( tE, tM );
+}
+
+// Next Item is a Message with an Event Queue?
+bool
+Cluster::
+message_next( EventQueue< Variable > const & queue ) const
+{
+	if ( inbox_.empty() ) return false;
+	return queue.empty() || ( inbox_.begin()->first.s < queue.top_superdense_time() );
+}
+
+// Process the Next Item with the Cluster's Queue Active
+void
+Cluster::
+process()
+{
+	if ( message_next( events_ ) ) {
+		receive();
+	} else {
+		requantize();
+	}
+}
+
+// Requantization Pass at the Top of the Queue
+void
+Cluster::
+requantize()
+{
+	assert( events_.top_is_QSS() );
+	SuperdenseTime const s( events_.top_superdense_time() );
+	Time const t( s.t );
+	events_.set_active_time();
+	if ( optimistic_ && ( ! inbox_.empty() ) && ( inbox_.begin()->first.s == s ) ) tie( s ); // Another cluster's pass at the superdense time
+	++n_QSS_events_;
+	n_posts_ = 0u;
+	if ( events_.single() ) { // Single trigger
+		passes_.emplace_back( s, 1u );
+		Variable * trigger( events_.top_var() );
+		assert( trigger->tE == t );
+		if ( optimistic_ ) {
+			record( Key{ s, 0u, 0u } );
+			save( trigger, true );
+			for ( Variable * observer : trigger->observers() ) save( observer );
+		}
+		trigger->advance_QSS();
+		if ( ! links_.empty() ) post( trigger, s );
+	} else { // Simultaneous triggers: Serial stages as in the Simulator's loop
+		++n_QSS_simultaneous_events_;
+		Variables triggers( events_.top_vars() );
+		passes_.emplace_back( s, triggers.size() );
+		std::sort( triggers.begin(), triggers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort triggers by order
+		if ( optimistic_ ) {
+			record( Key{ s, 0u, 0u } ).simultaneous = true;
+			for ( Variable * trigger : triggers ) save( trigger, true );
+		}
+		for ( Variable * trigger : triggers ) {
+			trigger->sT = s; // Set trigger superdense time
+		}
+		size_type const iBeg_triggers_2( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+		size_type const iBeg_triggers_3( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 3; } ) ) ) );
+		int const triggers_order_max( triggers.empty() ? 0 : triggers.back()->order() );
+		Variables const observers( Variable::pass_observers( triggers, true ) ); // In order of first appearance: Not hash order
+		int const order_max( observers.empty() ? triggers_order_max : std::max( triggers_order_max, observers.back()->order() ) );
+		if ( optimistic_ ) {
+			for ( Variable * observer : observers ) save( observer );
+		}
+		for ( Variable * trigger : triggers ) {
+			assert( trigger->tE == t );
+			trigger->advance_QSS_0();
+		}
+		for ( Variable * trigger : triggers ) {
+			trigger->advance_QSS_1();
+		}
+		if ( order_max >= 2 ) { // 2nd order pass
+			for ( size_type i = iBeg_triggers_2, n = triggers.size(); i < n; ++i ) {
+				triggers[ i ]->advance_QSS_2();
+			}
+			if ( order_max >= 3 ) { // 3rd order pass
+				for ( size_type i = iBeg_triggers_3, n = triggers.size(); i < n; ++i ) {
+					triggers[ i ]->advance_QSS_3();
+				}
+			}
+		}
+		Variable::advance_sums( triggers );
+		Variable::batch_begin( triggers, t );
+		for ( Variable * observer : observers ) {
+			observer->advance_observer( t );
+		}
+		Variable::batch_end( triggers );
+		if ( ! links_.empty() ) {
+			for ( Variable const * trigger : triggers ) {
+				post( trigger, s );
+			}
+		}
+	}
+}
+
+// Receive the Next Messages: Those at the Next Message Superdense Time
+//
+// Passes at a superdense time in several clusters are one pass in the serial loop so their
+// messages update the ghosts together and then the ghosts' observers advance once
+void
+Cluster::
+receive()
+{
+	auto const b( inbox_.begin() );
+	SuperdenseTime const s( b->first.s );
+	auto e( std::next( b ) );
+	while ( ( e != inbox_.end() ) && ( e->first.s == s ) ) ++e;
+	events_.set_active_time( s ); // Observers reschedule as in their source's pass
+	if ( std::next( b ) == e ) { // Single message
+		Message const & message( b->second );
+		Variable_Ghost * ghost( message.ghost );
+		if ( optimistic_ ) {
+			Record & r( record( b->first ) );
+			r.message = message;
+			r.received = true;
+			save( ghost, true );
+			for ( Variable * observer : ghost->observers() ) save( observer );
+		}
+		ghost->update( message.tQ, message.q_0, message.q_1, message.q_2 );
+		ghost->advance_observers();
+		++n_messages_;
+	} else { // Messages at the superdense time
+		Variables ghosts;
+		for ( auto i = b; i != e; ++i ) {
+			ghosts.push_back( i->second.ghost );
+		}
+		Variables const observers( Variable::pass_observers( ghosts, true ) );
+		if ( optimistic_ ) { // First message's record saves the states: The others roll back with it
+			for ( auto i = b; i != e; ++i ) {
+				Record & r( record( i->first ) );
+				r.message = i->second;
+				r.received = true;
+				if ( i == b ) {
+					for ( Variable * ghost : ghosts ) save( ghost, true );
+					for ( Variable * observer : observers ) save( observer );
+				}
+			}
+		}
+		for ( auto i = b; i != e; ++i ) {
+			Message const & message( i->second );
+			message.ghost->update( message.tQ, message.q_0, message.q_1, message.q_2 );
+			++n_messages_;
+		}
+		Variable::advance_sums( ghosts );
+		Variable::batch_begin( ghosts, s.t );
+		for ( Variable * observer : observers ) {
+			observer->advance_observer( s.t );
+		}
+		Variable::batch_end( ghosts );
+	}
+	inbox_.erase( b, e );
+}
+
+// Post Messages for a Requantized Boundary Variable's Ghosts
+void
+Cluster::
+post( Variable const * trigger, SuperdenseTime const & s )
+{
+	auto const i( links_.find( trigger ) );
+	if ( i == links_.end() ) return;
+	Time const tQ( trigger->tQ );
+	Value const q_0( trigger->q( tQ ) );
+	Value const q_1( trigger->q1( tQ ) );
+	Value const q_2( one_half * trigger->q2( tQ ) );
+	for ( Variable_Ghost * ghost : i->second ) {
+		Key const key{ s, index_ + 1u, n_posts_++ };
+		outbox_.push_back( Envelope{ key, Message{ ghost, tQ, q_0, q_1, q_2 }, false } );
+		if ( optimistic_ ) sent_.emplace_back( key, ghost );
+	}
+}
+
+// Record an Item Before Processing It
+Cluster::Record &
+Cluster::
+record( Key const & key )
+{
+	++n_processed_;
+	records_.push_back( Record{ key, Message{ nullptr, 0.0, 0.0, 0.0, 0.0 }, false, false, states_.size(), sum_states_.size(), shifts_.size(), sent_.size() } );
+	return records_.back();
+}
+
+// Save a Variable's State and Optionally its Incremental Sum Terms Before an Item Changes Them
+void
+Cluster::
+save( Variable * var, bool const sums )
+{
+	states_.emplace_back( var, Variable::State() );
+	var->save_state( states_.back().second );
+	if ( sums ) {
+		for ( auto const & sum : var->sums() ) {
+			sum_states_.emplace_back( sum.first, Sum_LTI::State() );
+			sum.first->save( sum.second, sum_states_.back().second );
+		}
+	}
+}
+
+// Roll Back the Items at or After a Key
+void
+Cluster::
+rollback( Key const & key )
+{
+	++n_rollbacks_;
+	while ( ( ! records_.empty() ) && ( ! ( records_.back().key < key ) ) ) {
+		undo();
+	}
+}
+
+// Undo the Last Recorded Item
+void
+Cluster::
+undo()
+{
+	assert( ! records_.empty() );
+	Record const & r( records_.back() );
+	for ( size_type i = states_.size(); i-- > r.iState; ) { // Reverse order so the earliest save of a variable wins
+		states_[ i ].first->restore_state( states_[ i ].second );
+	}
+	states_.resize( r.iState );
+	for ( size_type i = sum_states_.size(); i-- > r.iSum; ) {
+		sum_states_[ i ].first->restore( sum_states_[ i ].second );
+	}
+	sum_states_.resize( r.iSum );
+	for ( size_type i = shifts_.size(); i-- > r.iShift; ) { // Reverse order restores the queue order
+		Variable * var( shifts_[ i ].var );
+		var->event( events_.unshift_QSS( shifts_[ i ], var->event() ) );
+	}
+	shifts_.resize( r.iShift );
+	for ( size_type i = r.iSent, n = sent_.size(); i < n; ++i ) { // Anti-messages
+		outbox_.push_back( Envelope{ sent_[ i ].first, Message{ sent_[ i ].second, 0.0, 0.0, 0.0, 0.0 }, true } );
+	}
+	sent_.resize( r.iSent );
+	if ( r.received ) { // Message returns to the inbox
+		inbox_.emplace( r.key, r.message );
+		--n_messages_;
+	} else {
+		--n_QSS_events_;
+		if ( r.simultaneous ) --n_QSS_simultaneous_events_;
+		assert( ( ! passes_.empty() ) && ( passes_.back().first == r.key.s ) );
+		passes_.pop_back();
+	}
+	++n_undone_;
+	records_.pop_back();
+}
+
+} // dfn
+} // QSS
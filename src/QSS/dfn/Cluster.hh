@@ -0,0 +1,478 @@
+// QSS Defined Model Variable Cluster
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_dfn_Cluster_hh_INCLUDED
+#define QSS_dfn_Cluster_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/Sum_LTI.hh>
+#include <QSS/dfn/Variable.hh>
+#include <QSS/dfn/Variable_Ghost.hh>
+#include <QSS/EventQueue.hh>
+#include <QSS/SuperdenseTime.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+
+// QSS Defined Model Variable Cluster for Partitioned Simulation
+//
+// A cluster owns a part of a model's variables, their event queue, and ghosts of the other
+// clusters' variables that its derivatives read, so clusters can advance concurrently
+// Requantizations of boundary variables, those with ghosts in other clusters, go out as messages
+// stamped with the pass's superdense time that clusters receive in order with their own events
+//
+// Conservative synchronization: A cluster only advances through items before the earliest time
+// its feeder clusters can still send a message, which is bounded by their boundary variables'
+// queued requantization times and by their next item times plus a dt_min lookahead
+// Without a positive dt_min lookahead the clusters would advance about one item per round so
+// conservative partitioning is refused for such models
+//
+// Optimistic (Time Warp) synchronization: A cluster speculatively advances through its items and
+// logs the states each item changes, so a straggler message earlier than processed items rolls
+// them back, with anti-messages cancelling the messages they sent, and logs older than the global
+// virtual time (GVT) are discarded: Rollbacks restore the event queue order exactly so the items
+// that stand give the same results as conservative synchronization
+//
+// Passes at the same superdense time in several clusters form one pass of the serial loop: The
+// messages a cluster gets at a superdense time are received together, and passes whose clusters
+// exchange messages at their superdense time are merged into one pass across the clusters that
+// updates the ghosts directly: Conservative synchronization merges them when they are the next
+// items and optimistic synchronization rolls back to them and holds the clusters there until the
+// GVT reaches them
+class Cluster
+{
+
+public: // Types
+
+	using Variables = Variable::Variables;
+	using size_type = Variables::size_type;
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+	using Clusters = std::vector< std::unique_ptr< Cluster > >;
+
+	// Requantization Message for a Ghost
+	struct Message
+	{
+		Variable_Ghost * ghost; // Destination ghost
+		Time tQ; // Quantized time range begin
+		Value q_0, q_1, q_2; // Quantized rep coefficients
+	};
+
+	// Message Key: Pass Superdense Time, Sending Cluster, and Post Order in the Pass
+	//
+	// Requantization passes take source 0 and messages their sending cluster's index + 1 so a pass
+	// precedes the messages at its superdense time: Clusters requantizing at the same superdense time
+	// would otherwise each roll back the other's pass without end
+	struct Key
+	{
+		SuperdenseTime s; // Superdense time
+		size_type source; // Sending cluster index + 1: 0 for requantization passes
+		size_type index; // Post order in the pass
+
+		// Key < Key
+		friend
+		bool
+		operator <( Key const & k1, Key const & k2 )
+		{
+			return ( k1.s < k2.s ) || ( ( k1.s == k2.s ) && ( ( k1.source < k2.source ) || ( ( k1.source == k2.source ) && ( k1.index < k2.index ) ) ) );
+		}
+	};
+
+private: // Types
+
+	// Message or Anti-Message in Transit
+	struct Envelope
+	{
+		Key key; // Message key
+		Message message; // Message
+		bool anti; // Anti-message cancelling the message with the key?
+	};
+
+	// Processed Item Record for Rollback
+	struct Record
+	{
+		Key key; // Item key: Requantization passes precede the messages at their superdense time
+		Message message; // Received message
+		bool received; // Message receipt?
+		bool simultaneous; // Simultaneous requantization pass?
+		size_type iState, iSum, iShift, iSent; // Log sizes before the item
+	};
+
+	using Ghosts = std::vector< Variable_Ghost * >;
+	using Links = std::unordered_map< Variable const *, Ghosts >; // Boundary variables' ghosts in other clusters
+	using Inbox = std::map< Key, Message >;
+	using Outbox = std::vector< Envelope >;
+	using Records = std::vector< Record >;
+	using States = std::vector< std::pair< Variable *, Variable::State > >;
+	using SumStates = std::vector< std::pair< Sum_LTI *, Sum_LTI::State > >;
+	using Sent = std::vector< std::pair< Key, Variable_Ghost * > >;
+	using Pass = std::pair< SuperdenseTime, size_type >; // Pass superdense time and trigger count
+	using Passes = std::vector< Pass >;
+
+public: // Creation
+
+	// Index Constructor
+	explicit
+	Cluster( size_type const index ) :
+	 index_( index )
+	{}
+
+	// Copy Constructor
+	Cluster( Cluster const & ) = delete;
+
+	// Move Constructor
+	Cluster( Cluster && ) = delete;
+
+	// Destructor
+	~Cluster();
+
+public: // Assignment
+
+	// Copy Assignment
+	Cluster &
+	operator =( Cluster const & ) = delete;
+
+	// Move Assignment
+	Cluster &
+	operator =( Cluster && ) = delete;
+
+public: // Predicates
+
+	// Optimistic Synchronization?
+	bool
+	optimistic() const
+	{
+		return optimistic_;
+	}
+
+	// Requantization Pass at a Superdense Time Next in the Queue?
+	bool
+	pass_at( SuperdenseTime const & s ) const
+	{
+		return ( ! events_.empty() ) && ( events_.top_superdense_time() == s );
+	}
+
+	// Pass Sharing its Superdense Time with Another Cluster's Pass Found?
+	bool
+	tied() const
+	{
+		return tied_;
+	}
+
+	// Held Before a Superdense Time?
+	bool
+	held() const
+	{
+		return held_;
+	}
+
+public: // Properties
+
+	// Index
+	size_type
+	index() const
+	{
+		return index_;
+	}
+
+	// Variables
+	Variables const &
+	vars() const
+	{
+		return vars_;
+	}
+
+	// Ghosts of Other Clusters' Variables
+	size_type
+	n_ghosts() const
+	{
+		return ghosts_.size();
+	}
+
+	// Boundary Variables: Variables with Ghosts in Other Clusters
+	Variables const &
+	boundary() const
+	{
+		return boundary_;
+	}
+
+	// Feeder Clusters: Clusters Whose Variables this Cluster's Ghosts Copy
+	std::vector< size_type > const &
+	feeders() const
+	{
+		return feeders_;
+	}
+
+	// Requantization Event Passes
+	size_type
+	n_QSS_events() const
+	{
+		return n_QSS_events_;
+	}
+
+	// Simultaneous Requantization Event Passes
+	size_type
+	n_QSS_simultaneous_events() const
+	{
+		return n_QSS_simultaneous_events_;
+	}
+
+	// Messages Received
+	size_type
+	n_messages() const
+	{
+		return n_messages_;
+	}
+
+	// Items Processed Including Those Rolled Back
+	size_type
+	n_processed() const
+	{
+		return n_processed_;
+	}
+
+	// Items Rolled Back
+	size_type
+	n_undone() const
+	{
+		return n_undone_;
+	}
+
+	// Rollbacks
+	size_type
+	n_rollbacks() const
+	{
+		return n_rollbacks_;
+	}
+
+	// Earliest Superdense Time of a Pass Shared with Another Cluster's Pass
+	SuperdenseTime const &
+	tie() const
+	{
+		return tie_;
+	}
+
+	// Superdense Time the Cluster is Held Before
+	SuperdenseTime const &
+	hold() const
+	{
+		return hold_;
+	}
+
+	// Next Item Time Including Messages in Transit: Infinity if None
+	Time
+	next() const;
+
+	// Next Item Superdense Time Including Messages in Transit: Infinity if None
+	SuperdenseTime
+	next_superdense() const;
+
+	// Earliest Output Time: No Message Can Go Out Before It
+	Time
+	eot() const;
+
+public: // Methods
+
+	// Optimistic Synchronization Set
+	void
+	optimistic( bool const optimistic )
+	{
+		optimistic_ = optimistic;
+	}
+
+	// Refresh the Ghosts from their Sources: Between Initialization Stages
+	void
+	refresh();
+
+	// Schedule the Variables' Requantizations in the Cluster's Queue: After Initialization
+	void
+	schedule();
+
+	// Advance Through Items Before a Bound Time and at or Before a Stop Time
+	void
+	advance( Time const tB, Time const tS );
+
+	// Advance Through the Next Item
+	void
+	step();
+
+	// Speculatively Advance Through Up to n Items at or Before a Stop Time: Optimistic Synchronization
+	void
+	speculate( Time const tS, size_type const n );
+
+	// Send the Outgoing Messages to their Clusters
+	void
+	send( Clusters & clusters );
+
+	// Accept the Messages in Transit: Stragglers and Anti-Messages for Processed Messages Roll Back
+	void
+	accept();
+
+	// Roll Back to a Superdense Time and Hold Before It: Optimistic Synchronization
+	void
+	hold( SuperdenseTime const & s );
+
+	// Release the Hold
+	void
+	release()
+	{
+		held_ = tied_ = false;
+	}
+
+	// Discard the Rollback Logs of Items Before the Global Virtual Time
+	void
+	commit( Time const gvt );
+
+public: // Static Methods
+
+	// Partition LTI QSS Variables into Clusters: False if Other Variable Types are Present
+	static
+	bool
+	partition( Variables const & vars, size_type const n, Clusters & clusters );
+
+	// Positive Lookahead for Conservative Synchronization? False if Every Variable's Lookahead is Zero
+	static
+	bool
+	has_lookahead( Variables const & vars );
+
+	// Requantization Pass Merged Across the Clusters with Passes at a Superdense Time: The Next Items of Every Cluster
+	static
+	void
+	requantize( Clusters & clusters, SuperdenseTime const & s );
+
+	// Count the Passes Before a Superdense Time as the Serial Loop Does: Passes at a Superdense Time in Several Clusters Count Once
+	static
+	void
+	count( Clusters & clusters, SuperdenseTime const & s, size_type & n_QSS_events, size_type & n_QSS_simultaneous_events );
+
+private: // Methods
+
+	// Next Item Time with an Event Queue: Infinity if None
+	Time
+	next( EventQueue< Variable > const & queue ) const;
+
+	// Next Item is a Message with an Event Queue?
+	bool
+	message_next( EventQueue< Variable > const & queue ) const;
+
+	// Process the Next Item with the Cluster's Queue Active
+	void
+	process();
+
+	// Requantization Pass at the Top of the Queue
+	void
+	requantize();
+
+	// Receive the Next Messages: Those at the Next Message Superdense Time
+	void
+	receive();
+
+	// Post Messages for a Requantized Boundary Variable's Ghosts
+	void
+	post( Variable const * trigger, SuperdenseTime const & s );
+
+	// Pass Sharing its Superdense Time with Another Cluster's Pass Found
+	void
+	tie( SuperdenseTime const & s )
+	{
+		if ( ( ! tied_ ) || ( s < tie_ ) ) tie_ = s;
+		tied_ = true;
+	}
+
+	// Record an Item Before Processing It
+	Record &
+	record( Key const & key );
+
+	// Save a Variable's State and Optionally its Incremental Sum Terms Before an Item Changes Them
+	void
+	save( Variable * var, bool const sums = false );
+
+	// Roll Back the Items at or After a Key
+	void
+	rollback( Key const & key );
+
+	// Undo the Last Recorded Item
+	void
+	undo();
+
+private: // Data
+
+	size_type index_{ 0u }; // Index
+	Variables vars_; // Variables
+	EventQueue< Variable > events_; // Event queue of the variables and ghosts: After initialization
+	Ghosts ghosts_; // Ghosts of other clusters' variables (owned)
+	Links links_; // Boundary variables' ghosts in other clusters
+	Variables boundary_; // Boundary variables
+	std::vector< size_type > feeders_; // Clusters sending to this cluster
+	Time lookahead_{ infinity }; // Min time from an item to a boundary requantization it causes
+	Inbox inbox_; // Incoming messages
+	Outbox outbox_; // Outgoing messages
+	size_type n_posts_{ 0u }; // Messages posted in the current pass
+	size_type n_QSS_events_{ 0u }; // Requantization event passes
+	size_type n_QSS_simultaneous_events_{ 0u }; // Simultaneous requantization event passes
+	size_type n_messages_{ 0u }; // Messages received
+	Passes passes_; // Passes not yet counted
+
+	// Optimistic synchronization
+	bool optimistic_{ false }; // Optimistic synchronization?
+	Outbox incoming_; // Messages and anti-messages in transit
+	Records records_; // Processed items not yet committed
+	States states_; // Saved variable states
+	SumStates sum_states_; // Saved incremental sum states
+	EventQueue< Variable >::Journal shifts_; // Event queue shift journal
+	Sent sent_; // Sent messages
+	size_type n_processed_{ 0u }; // Items processed including those rolled back
+	size_type n_undone_{ 0u }; // Items rolled back
+	size_type n_rollbacks_{ 0u }; // Rollbacks
+	bool tied_{ false }; // Pass sharing its superdense time with another cluster's pass found?
+	SuperdenseTime tie_; // Earliest superdense time of a pass shared with another cluster's pass
+	bool held_{ false }; // Held before a superdense time?
+	SuperdenseTime hold_; // Superdense time the cluster is held before
+
+};
+
+} // dfn
+} // QSS
+
+#endif
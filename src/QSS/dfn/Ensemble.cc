@@ -0,0 +1,343 @@
+// QSS Defined Model Ensemble Runner
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/Ensemble.hh>
+#include <QSS/dfn/Batch_LTI.hh>
+#include <QSS/OutputFilter.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+namespace QSS {
+namespace dfn {
+
+namespace { // Internal
+
+// string is Readable as a Nonnegative double?
+bool
+is_nonnegative_double( std::string const & s, double & v )
+{
+	if ( s.empty() || std::isspace( s[ 0 ] ) ) return false;
+	char * end( nullptr );
+	v = std::strtod( s.c_str(), &end );
+	return ( *end == '\0' ) && ( v >= 0.0 );
+}
+
+// string is Readable as an Unsigned Integer?
+bool
+is_unsigned( std::string const & s, std::uint64_t & v )
+{
+	if ( s.empty() || ! std::all_of( s.begin(), s.end(), []( char const c ){ return std::isdigit( c ) != 0; } ) ) return false;
+	v = std::strtoull( s.c_str(), nullptr, 10 );
+	return true;
+}
+
+// Run a Scenario
+void
+simulate( Ensemble::Scenario const & scenario, Ensemble::Result & result, bool const out_values )
+{
+	Simulator::Options opts( scenario.opts );
+	opts.outputs = false; // Scenarios would collide on the output files
+	opts.report = false;
+	opts.fanout = 0u; // Scenarios already occupy the threads
+	opts.clusters = 0u;
+	std::chrono::steady_clock::time_point const time0( std::chrono::steady_clock::now() );
+	Simulator sim( opts );
+	sim.init();
+	sim.advance_to( sim.tE() );
+	sim.finish();
+	result.seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - time0 ).count();
+	result.results = sim.results();
+	result.tE = sim.tE();
+	if ( out_values ) {
+		for ( Variable const * var : sim.out_vars() ) {
+			result.names.push_back( var->name );
+			result.x.push_back( var->x( sim.t() ) );
+		}
+	}
+}
+
+// Run a Batch of Scenarios as Lanes: Scenarios Run Separately if the Model isn't Batchable
+void
+simulate_batch( Ensemble::Scenarios const & scenarios, Ensemble::size_type const b, Ensemble::size_type const e, Ensemble::Results & results, bool const out_values )
+{
+	using size_type = Ensemble::size_type;
+	std::chrono::steady_clock::time_point const time0( std::chrono::steady_clock::now() );
+
+	// Shared model structure from a model initialized with the first scenario's options
+	Simulator::Options opts( scenarios[ b ].opts );
+	opts.outputs = false;
+	opts.report = false;
+	opts.fanout = 0u;
+	opts.clusters = 0u; // Lanes read the model's own variables
+	opts.xIni.clear(); // Initial value overrides are set per lane
+	Simulator sim( opts );
+	sim.init();
+	if ( ! Batch_LTI::is_batchable( sim.vars() ) ) {
+		for ( size_type s = b; s < e; ++s ) simulate( scenarios[ s ], results[ s ], out_values );
+		return;
+	}
+
+	// Lane settings
+	size_type const K( e - b );
+	Batch_LTI batch( sim.vars(), K, sim.tE() );
+	for ( size_type l = 0; l < K; ++l ) {
+		Simulator::Options const & lane_opts( scenarios[ b + l ].opts );
+		if ( lane_opts.rTol != opts.rTol ) batch.set_rTol( l, lane_opts.rTol );
+		if ( lane_opts.aTol != opts.aTol ) batch.set_aTol( l, lane_opts.aTol );
+		if ( lane_opts.tEnd < std::numeric_limits< Ensemble::Time >::infinity() ) batch.set_tEnd( l, lane_opts.tEnd );
+		for ( auto const & name_x : lane_opts.xIni ) {
+			size_type const i( batch.index( name_x.first ) );
+			if ( i == batch.n_vars() ) {
+				std::cerr << "Error: Initial value for unknown variable: " << name_x.first << std::endl;
+				std::exit( EXIT_FAILURE );
+			}
+			batch.set_xIni( l, i, name_x.second );
+		}
+	}
+
+	// Run
+	batch.init();
+	batch.run();
+	double const seconds( std::chrono::duration< double >( std::chrono::steady_clock::now() - time0 ).count() );
+
+	// Results
+	size_type n_QSS_events( 0u );
+	for ( size_type l = 0; l < K; ++l ) n_QSS_events += batch.n_QSS_events( l );
+	double const lanes( batch.n_passes() > 0u ? double( n_QSS_events ) / batch.n_passes() : 1.0 );
+	for ( size_type l = 0; l < K; ++l ) {
+		Ensemble::Result & result( results[ b + l ] );
+		result.results.n_QSS_events = batch.n_QSS_events( l );
+		result.results.n_QSS_simultaneous_events = batch.n_QSS_simultaneous_events( l );
+		result.tE = batch.tEnd( l );
+		result.seconds = seconds / K;
+		result.batched = true;
+		result.lanes = lanes;
+		if ( out_values ) {
+			for ( Variable const * var : sim.out_vars() ) {
+				result.names.push_back( var->name );
+				result.x.push_back( batch.x( l, batch.index( var->name ) ) );
+			}
+		}
+	}
+}
+
+} // Internal
+
+// Run the Scenarios on a Number of Threads (0 for Hardware Concurrency) in Batches of up to K Lanes
+void
+Ensemble::
+run( size_type n_threads, size_type const K )
+{
+	size_type const n( scenarios_.size() );
+	results_.assign( n, Result() );
+	bool const out_values( OutputFilter( options::output::include, options::output::exclude ).is_active() ); // Final values only of selected variables
+
+	// Work units: Single scenarios or batches of consecutive scenarios sharing a model structure
+	std::vector< size_type > units( 1u, 0u ); // Unit scenario ranges
+	for ( size_type i = 1u; i < n; ++i ) {
+		Simulator::Options const & unit_opts( scenarios_[ units.back() ].opts );
+		Simulator::Options const & opts( scenarios_[ i ].opts );
+		if ( ( K <= 1u ) || ( i - units.back() >= K ) || ( opts.model != unit_opts.model ) || ( opts.size != unit_opts.size ) || ( opts.degree != unit_opts.degree ) || ( opts.power != unit_opts.power ) || ( opts.seed != unit_opts.seed ) || ( opts.qss != unit_opts.qss ) ) units.push_back( i );
+	}
+	units.push_back( n );
+	size_type const n_units( n > 0u ? units.size() - 1u : 0u );
+	if ( n_threads == 0u ) n_threads = std::max( std::thread::hardware_concurrency(), 1u );
+	n_threads_ = std::max( std::min( n_threads, n_units ), size_type( 1u ) );
+
+	// Workers take the next unit until none are left: Results are stored by scenario index so their order doesn't depend on scheduling
+	std::atomic< size_type > next( 0u );
+	auto const worker( [this,&units,n_units,out_values,&next](){
+		for ( size_type u = next++; u < n_units; u = next++ ) {
+			size_type const b( units[ u ] ), e( units[ u + 1u ] );
+			if ( e - b == 1u ) {
+				simulate( scenarios_[ b ], results_[ b ], out_values );
+			} else {
+				simulate_batch( scenarios_, b, e, results_, out_values );
+			}
+		}
+	} );
+	std::vector< std::thread > threads;
+	threads.reserve( n_threads_ - 1u );
+	for ( size_type k = 1u; k < n_threads_; ++k ) threads.emplace_back( worker );
+	worker(); // Calling thread is a worker too
+	for ( std::thread & thread : threads ) thread.join();
+}
+
+// Write Summary CSV
+void
+Ensemble::
+write( std::ostream & stream ) const
+{
+	stream << std::setprecision( 16 );
+	stream << "scenario,rTol,aTol,seed,tEnd,discrete_events,QSS_events,QSS_simultaneous_events,ZC_events,seconds";
+	if ( ! results_.empty() ) {
+		for ( std::string const & name : results_.front().names ) stream << ',' << name;
+	}
+	stream << '\n';
+	for ( size_type i = 0, n = std::min( scenarios_.size(), results_.size() ); i < n; ++i ) {
+		Scenario const & scenario( scenarios_[ i ] );
+		Result const & result( results_[ i ] );
+		Simulator::Results const & r( result.results );
+		stream << scenario.name << ',' << scenario.opts.rTol << ',' << scenario.opts.aTol << ',' << scenario.opts.seed << ',' << result.tE << ',';
+		stream << r.n_discrete_events << ',' << r.n_QSS_events << ',' << r.n_QSS_simultaneous_events << ',' << r.n_ZC_events << ',' << result.seconds;
+		for ( Value const x : result.x ) stream << ',' << x;
+		stream << '\n';
+	}
+}
+
+// Write Summary CSV File
+bool
+Ensemble::
+write( std::string const & file_name ) const
+{
+	std::ofstream csv( file_name, std::ios_base::binary | std::ios_base::out );
+	if ( ! csv ) {
+		std::cerr << "Error: Ensemble summary file open failed: " << file_name << std::endl;
+		return false;
+	}
+	write( csv );
+	return true;
+}
+
+// Read Scenarios File: One Scenario per Line of name= rTol= aTol= seed= tEnd= xIni:VAR= Settings
+bool
+Ensemble::
+read( std::string const & file_name, Scenarios & scenarios )
+{
+	std::ifstream in( file_name );
+	if ( ! in ) {
+		std::cerr << "Error: Ensemble file open failed: " << file_name << std::endl;
+		return false;
+	}
+	scenarios.clear();
+	std::string line;
+	size_type n_line( 0u );
+	while ( std::getline( in, line ) ) {
+		++n_line;
+		std::string::size_type const iComment( line.find( '#' ) );
+		if ( iComment != std::string::npos ) line.erase( iComment );
+		std::istringstream settings( line );
+		std::string setting;
+		Scenario scenario;
+		bool any( false );
+		while ( settings >> setting ) {
+			any = true;
+			std::string::size_type const iEq( setting.find( '=' ) );
+			std::string const key( setting.substr( 0u, iEq ) );
+			std::string const val( iEq == std::string::npos ? std::string() : setting.substr( iEq + 1u ) );
+			double v( 0.0 );
+			bool valid( true );
+			if ( key == "name" ) {
+				scenario.name = val;
+				valid = ! val.empty();
+			} else if ( key == "rTol" ) {
+				if ( ( valid = is_nonnegative_double( val, v ) ) ) scenario.opts.rTol = v;
+			} else if ( key == "aTol" ) {
+				if ( ( valid = is_nonnegative_double( val, v ) && ( v > 0.0 ) ) ) scenario.opts.aTol = v;
+			} else if ( key == "seed" ) {
+				valid = is_unsigned( val, scenario.opts.seed );
+			} else if ( key == "tEnd" ) {
+				if ( ( valid = is_nonnegative_double( val, v ) ) ) scenario.opts.tEnd = v;
+			} else if ( ( key.compare( 0u, 5u, "xIni:" ) == 0 ) && ( key.length() > 5u ) ) {
+				char * end( nullptr );
+				v = std::strtod( val.c_str(), &end );
+				if ( ( valid = ( ! val.empty() ) && ( *end == '\0' ) ) ) scenario.opts.xIni[ key.substr( 5u ) ] = v;
+			} else {
+				valid = false;
+			}
+			if ( ! valid ) {
+				std::cerr << "Error: Ensemble file " << file_name << " line " << n_line << ": Invalid setting: " << setting << std::endl;
+				return false;
+			}
+		}
+		if ( ! any ) continue; // Blank or comment line
+		if ( scenario.name.empty() ) scenario.name = std::to_string( scenarios.size() + 1u );
+		scenarios.push_back( scenario );
+	}
+	return true;
+}
+
+// Ensemble Simulation from Global Options
+void
+simulate_ensemble()
+{
+	Ensemble::Scenarios scenarios;
+	if ( ! Ensemble::read( options::ensemble, scenarios ) ) std::exit( EXIT_FAILURE );
+	if ( scenarios.empty() ) {
+		std::cerr << "Error: No scenarios in ensemble file: " << options::ensemble << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	Ensemble ensemble( scenarios );
+	std::chrono::steady_clock::time_point const time0( std::chrono::steady_clock::now() );
+	ensemble.run( options::threads, options::batch );
+	double const seconds( std::chrono::duration< double >( std::chrono::steady_clock::now() - time0 ).count() );
+	if ( ! ensemble.write( "ensemble.csv" ) ) std::exit( EXIT_FAILURE );
+
+	// Reporting
+	double seconds_sum( 0.0 );
+	Simulator::size_type n_QSS_events( 0u );
+	Simulator::size_type n_batched( 0u );
+	double lanes_sum( 0.0 );
+	for ( Ensemble::Result const & result : ensemble.results() ) {
+		seconds_sum += result.seconds;
+		n_QSS_events += result.results.n_QSS_events;
+		if ( result.batched ) {
+			++n_batched;
+			lanes_sum += result.lanes;
+		}
+	}
+	std::cout << "\nEnsemble =====" << std::endl;
+	std::cout << scenarios.size() << " scenarios on " << ensemble.n_threads() << " threads" << std::endl;
+	if ( n_batched > 0u ) std::cout << n_batched << " scenarios batched: " << lanes_sum / n_batched << " mean lanes per requantization pass" << std::endl;
+	std::cout << n_QSS_events << " total requantization event passes" << std::endl;
+	std::cout << seconds << " s wall time: " << seconds_sum << " s summed over scenarios" << std::endl;
+	if ( seconds_sum > 0.0 ) std::cout << n_QSS_events / seconds_sum << " requantizations per scenario-second" << std::endl;
+}
+
+} // dfn
+} // QSS
@@ -0,0 +1,1393 @@
+// QSS Defined Model Simulator
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/Simulator.hh>
+#include <QSS/dfn/globals_dfn.hh>
+#include <QSS/dfn/Variable_ZC.hh>
+#include <QSS/dfn/mdl/achilles.hh>
+#include <QSS/dfn/mdl/achilles2.hh>
+#include <QSS/dfn/mdl/achillesc.hh>
+#include <QSS/dfn/mdl/achilles_ND.hh>
+#include <QSS/dfn/mdl/bball.hh>
+#include <QSS/dfn/mdl/exponential_decay.hh>
+#include <QSS/dfn/mdl/exponential_decay_sine.hh>
+#include <QSS/dfn/mdl/exponential_decay_sine_ND.hh>
+#include <QSS/dfn/mdl/exponential_decay_step.hh>
+#include <QSS/dfn/mdl/LTI_file.hh>
+#include <QSS/dfn/mdl/generated.hh>
+#include <QSS/dfn/mdl/nonlinear.hh>
+#include <QSS/dfn/mdl/nonlinear_AD.hh>
+#include <QSS/dfn/mdl/nonlinear_ND.hh>
+#include <QSS/dfn/mdl/StateEvent6.hh>
+#include <QSS/dfn/mdl/stiff.hh>
+#include <QSS/dfn/mdl/xy.hh>
+#include <QSS/dfn/mdl/xyz.hh>
+#include <QSS/Instrument.hh>
+#include <QSS/OutputFilter.hh>
+#include <QSS/OutputPolicy.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace QSS {
+namespace dfn {
+
+namespace { // Internal
+
+// Run a Simultaneous Trigger Stage over Variables from Index b on a Pool
+template< typename Stage >
+void
+parallel_stage( ThreadPool & pool, Variable::Variables const & vars, std::size_t const b, Stage const & stage )
+{
+	assert( b <= vars.size() );
+	std::size_t const n( vars.size() - b );
+	std::size_t const grain( std::max( n / ( 4u * pool.size() ), std::size_t( 1u ) ) );
+	Variable * const * const v( vars.data() + b );
+	pool.parallel_for( n, [v,&stage]( std::size_t const i ){
+		stage( v[ i ] );
+	}, grain );
+}
+
+} // Internal
+
+// Default Constructor: Global Options
+Simulator::
+Simulator() :
+ Simulator( Options() )
+{}
+
+// Options Constructor
+Simulator::
+Simulator( Options const & opts ) :
+ opts_( opts ),
+ tE_( opts.tEnd )
+{}
+
+// Destructor
+Simulator::
+~Simulator()
+{
+	for ( auto & var : vars_ ) delete var;
+}
+
+// Variable of a Name or nullptr if None
+Variable *
+Simulator::
+var( std::string const & name ) const
+{
+	for ( Variable * var : vars_ ) {
+		if ( var->name == name ) return var;
+	}
+	return nullptr;
+}
+
+// Continuous Value of a Variable at the Current Time
+Simulator::Value
+Simulator::
+x( std::string const & name ) const
+{
+	Variable const * v( var( name ) );
+	if ( v == nullptr ) throw std::invalid_argument( "Unknown variable: " + name );
+	return v->x( t_ );
+}
+
+// Quantized Value of a Variable at the Current Time
+Simulator::Value
+Simulator::
+q( std::string const & name ) const
+{
+	Variable const * v( var( name ) );
+	if ( v == nullptr ) throw std::invalid_argument( "Unknown variable: " + name );
+	return v->q( t_ );
+}
+
+// Initialize: Build the Model, Initialize its Variables, and Open Outputs
+void
+Simulator::
+init()
+{
+	assert( ! initialized_ );
+
+	// I/o setup
+	if ( opts_.report ) {
+		std::cout << std::setprecision( 16 );
+		std::cerr << std::setprecision( 16 );
+	}
+
+	// Model setup
+	build();
+	for ( auto var : vars_ ) { // Variables schedule in the simulator's queue
+		var->set_queue( events_ );
+	}
+	for ( auto const & name_x : opts_.xIni ) { // Initial value overrides
+		Variable * v( var( name_x.first ) );
+		if ( v == nullptr ) {
+			std::cerr << "Error: Initial value for unknown variable: " << name_x.first << std::endl;
+			std::exit( EXIT_FAILURE );
+		}
+		v->xIni = name_x.second;
+	}
+
+	// Size setup
+	size_type const n_vars( vars_.size() );
+
+	// Output variables and variable-index map setup: Only selected variables pay for output
+	OutputFilter const out_filter( opts_.out.include, opts_.out.exclude );
+	for ( auto var : vars_ ) {
+		if ( out_filter( var->name ) ) {
+			out_idx_[ var ] = out_vars_.size();
+			out_vars_.push_back( var );
+		}
+	}
+	if ( opts_.report && out_filter.is_active() ) std::cout << out_vars_.size() << " of " << n_vars << " variables selected for output" << std::endl;
+
+	// Output selections
+	bool const doOut( opts_.outputs && ( opts_.out.x || opts_.out.q ) ); // Trajectory outputs?
+	doSOut_ = doOut && opts_.out.s;
+	doTOut_ = doOut && opts_.out.t;
+	doROut_ = doOut && opts_.out.r;
+	doStats_ = opts_.outputs && options::stats;
+	doSeg_ = opts_.outputs && ( opts_.out.x_segments || opts_.out.q_segments );
+	doTrace_ = opts_.outputs && ( ! options::trace.empty() );
+
+	// Partitioned simulation setup: Before initialization so derivatives read ghosts of other clusters' variables
+	if ( opts_.clusters > 1u ) {
+		if ( doTOut_ || doROut_ || doStats_ || doSeg_ || doTrace_ || options::output::d ) {
+			if ( opts_.report ) std::cout << "Partitioned simulation supports sampled outputs only: Needs the event, segment, statistics, trace, and diagnostic outputs off: Running unpartitioned" << std::endl;
+		} else if ( ( opts_.optimism == 0u ) && ( ! Cluster::has_lookahead( vars_ ) ) ) {
+			if ( opts_.report ) std::cout << "Conservative partitioned simulation needs a positive --dtMin lookahead without --inflection or --dtInf (or use --optimism): Running unpartitioned" << std::endl;
+		} else if ( ! Cluster::partition( vars_, opts_.clusters, clusters_ ) ) {
+			if ( opts_.report ) std::cout << "Partitioned simulation supports LTI QSS models: Running unpartitioned" << std::endl;
+		}
+	}
+
+	// Containers of ZC and non-ZC variables
+	Variables vars_ZC;
+	Variables vars_nonZC;
+	int max_QSS_order( 0 );
+	for ( auto var : vars_ ) {
+		if ( var->is_ZC() ) { // ZC variable
+			vars_ZC.push_back( var );
+		} else { // Non-ZC variable
+			vars_nonZC.push_back( var );
+			max_QSS_order = std::max( max_QSS_order, var->order() ); // Max QSS order of non-ZC variables to avoid unnec loop stages
+		}
+	}
+	int const QSS_order_max( max_QSS_order ); // Highest QSS order in use
+	assert( QSS_order_max <= 3 );
+
+	// Timing setup
+	t0_ = 0.0; // Simulation start time
+	t_ = t0_; // Simulation current time
+	tOut_ = t0_ + opts_.dtOut; // Sampling time
+	iOut_ = 1u; // Output step index
+
+	// Parallel initialization and advance pool: Partitioned simulation or parallel observer advance
+	if ( ( opts_.fanout > 0u ) || ( ! clusters_.empty() ) ) pool_.reset( new ThreadPool( opts_.threads, opts_.deterministic, opts_.pin ) );
+
+	// Variable initialization
+	if ( opts_.report ) std::cout << "\nInitialization =====" << std::endl;
+	if ( pool_ && ( pool_->size() > 1u ) && ( vars_nonZC.size() >= opts_.fanout ) && ( ! options::output::d ) && std::all_of( vars_nonZC.begin(), vars_nonZC.end(), []( Variable const * v ){ return v->is_concurrent(); } ) ) { // Parallel stages
+		// Stages read the other variables' reps as of the stage start: Their quantized coefficient updates follow the stage
+		// Registrations with observees are deferred and then made in variable order so the observers are ordered as in serial stages
+		// Requantization events are queued in one sorted build with ties in the serial stages' insertion order
+		for ( auto var : vars_nonZC ) {
+			var->defer_registrations();
+		}
+		parallel_stage( *pool_, vars_nonZC, 0u, []( Variable * var ){ var->init_0(); } );
+		for ( auto & cluster : clusters_ ) cluster->refresh(); // Ghosts see each stage's results
+		parallel_stage( *pool_, vars_nonZC, 0u, []( Variable * var ){ var->init_1_deferred(); } );
+		for ( auto var : vars_nonZC ) {
+			var->init_deferred( 1 );
+			var->register_deferred();
+		}
+		for ( auto var : vars_ ) {
+			var->shrink_observers();
+		}
+		for ( auto & cluster : clusters_ ) cluster->refresh();
+		if ( QSS_order_max >= 2 ) {
+			parallel_stage( *pool_, vars_nonZC, 0u, []( Variable * var ){ var->init_2_deferred(); } );
+			for ( auto var : vars_nonZC ) {
+				var->init_deferred( 2 );
+			}
+			for ( auto & cluster : clusters_ ) cluster->refresh();
+			if ( QSS_order_max >= 3 ) {
+				parallel_stage( *pool_, vars_nonZC, 0u, []( Variable * var ){ var->init_3_deferred(); } );
+				for ( auto & cluster : clusters_ ) cluster->refresh();
+			}
+		}
+		Variables queued( vars_nonZC );
+		std::stable_sort( queued.begin(), queued.end(), []( Variable const * v1, Variable const * v2 ){ return v1->order() < v2->order(); } ); // Stage of insertion
+		events_.add_QSS( queued );
+		if ( opts_.report ) std::cout << "Parallel initialization on " << pool_->size() << " threads" << std::endl;
+	} else { // Serial stages
+		for ( auto var : vars_nonZC ) {
+			var->init_0();
+		}
+		for ( auto & cluster : clusters_ ) cluster->refresh(); // Ghosts see each stage's results
+		for ( auto var : vars_nonZC ) {
+			var->init_1();
+		}
+		for ( auto & cluster : clusters_ ) cluster->refresh();
+		if ( QSS_order_max >= 2 ) {
+			for ( auto var : vars_nonZC ) {
+				var->init_2();
+			}
+			for ( auto & cluster : clusters_ ) cluster->refresh();
+			if ( QSS_order_max >= 3 ) {
+				for ( auto var : vars_nonZC ) {
+					var->init_3();
+				}
+				for ( auto & cluster : clusters_ ) cluster->refresh();
+			}
+		}
+	}
+	for ( auto var : vars_ZC ) { // ZC variables after to get actual LIQSS2+ quantized reps
+		var->init();
+	}
+	if ( options::output::d ) { // Diagnostic output
+		for ( Variable const * var : vars_nonZC ) var->advance_d( '!' );
+		for ( Variable const * var : vars_ZC ) var->advance_d( '!' );
+	}
+
+	// Partitioned simulation: Requantizations move to the clusters' queues
+	if ( ! clusters_.empty() ) {
+		for ( auto & cluster : clusters_ ) {
+			cluster->optimistic( opts_.optimism > 0u );
+			cluster->schedule();
+		}
+		events_.clear();
+		if ( opts_.report ) {
+			size_type n_boundary( 0u );
+			size_type n_ghosts( 0u );
+			for ( auto const & cluster : clusters_ ) {
+				n_boundary += cluster->boundary().size();
+				n_ghosts += cluster->n_ghosts();
+			}
+			std::cout << ( opts_.optimism > 0u ? "Optimistic" : "Conservative" ) << " partitioned simulation: " << clusters_.size() << " clusters on " << pool_->size() << " threads: " << n_boundary << " boundary variables with " << n_ghosts << " ghosts" << std::endl;
+		}
+	}
+
+	// Parallel observer advance and simultaneous stage setup: Only for large fan-outs and passes
+	if ( ( opts_.fanout > 0u ) && clusters_.empty() ) {
+		if ( pool_->size() > 1u ) {
+			size_type n_parallel( 0u );
+			for ( auto var : vars_ ) {
+				var->set_parallel_observers( opts_.fanout, pool_.get() );
+				if ( var->parallel_observers() ) ++n_parallel;
+			}
+			if ( opts_.report ) std::cout << "Parallel advance on " << pool_->size() << " threads: " << n_parallel << " variables with parallel observer advance" << std::endl;
+		} else { // No workers
+			pool_.reset();
+		}
+	}
+
+	// Output initialization
+	if ( opts_.outputs && ( options::format == options::Format::binary ) ) { // Binary output file
+		if ( ! bin_out_.open( "out.bin" ) ) std::exit( EXIT_FAILURE );
+	} else if ( opts_.outputs && ( options::format == options::Format::columnar ) ) { // Columnar output file
+		if ( ! col_out_.open( "out.col" ) ) std::exit( EXIT_FAILURE );
+	}
+	if ( doSOut_ || doTOut_ || doROut_ ) { // t0 QSS outputs
+		for ( auto var : out_vars_ ) { // QSS outputs
+			if ( opts_.out.x ) {
+				x_outs_.emplace_back( var->name + ".x.out", &bin_out_, &col_out_ );
+				x_outs_.back().append( t_, var->x( t_ ) );
+			}
+			if ( opts_.out.q ) {
+				q_outs_.emplace_back( var->name + ".q.out", &bin_out_, &col_out_ );
+				q_outs_.back().append( t_, var->q( t_ ) );
+			}
+		}
+	}
+
+	// Per-variable statistics setup
+	if ( doStats_ ) var_stats_.init( vars_, t0_ );
+
+	// Segment output setup
+	if ( doSeg_ ) {
+		if ( ! seg_out_.open( "out.seg", t0_, opts_.out.x_segments, opts_.out.q_segments ) ) std::exit( EXIT_FAILURE );
+		seg_out_.add_all( out_vars_ );
+	}
+
+	// Event pass tracer setup
+	if ( doTrace_ ) tracer_.open( options::trace );
+
+	// Hardware performance counters setup: Last to count only the simulation loop
+	doPerf_ = opts_.outputs && options::perf && perf_.open();
+
+	initialized_ = true;
+	if ( opts_.report ) std::cout << "\nSimulation Loop =====" << std::endl;
+}
+
+// Advance Through Events at or Before a Time (Clipped to the End Time)
+void
+Simulator::
+advance_to( Time const tA )
+{
+	assert( initialized_ );
+	assert( ! finished_ );
+	if ( ! clusters_.empty() ) { // Partitioned simulation: Sampled outputs at the barriers where every cluster is through the sample time
+		Time const tS( std::min( tA, tE_ ) ); // Stop time
+		while ( true ) {
+			bool const sample( doSOut_ && ( tOut_ < tS ) );
+			Time const tB( sample ? tOut_ : tA ); // Barrier time
+			if ( opts_.optimism > 0u ) {
+				advance_clusters_optimistic( tB );
+			} else {
+				advance_clusters( tB );
+			}
+			if ( ! sample ) break;
+			QSS_INSTRUMENT_PHASE( output );
+			for ( size_type i = 0, n = out_vars_.size(); i < n; ++i ) {
+				if ( opts_.out.x ) x_outs_[ i ].sample( tOut_, out_vars_[ i ]->x( tOut_ ) );
+				if ( opts_.out.q ) q_outs_[ i ].sample( tOut_, out_vars_[ i ]->q( tOut_ ) );
+			}
+			assert( iOut_ < std::numeric_limits< size_type >::max() );
+			tOut_ = t0_ + ( ++iOut_ ) * opts_.dtOut;
+		}
+	} else if ( OutputPolicy_None::covers( doSOut_, doTOut_, doROut_, options::output::d ) ) { // Output-specialized loops
+		advance< OutputPolicy_None >( tA );
+	} else if ( OutputPolicy_Sampled::covers( doSOut_, doTOut_, doROut_, options::output::d ) ) {
+		advance< OutputPolicy_Sampled >( tA );
+	} else if ( OutputPolicy_Events::covers( doSOut_, doTOut_, doROut_, options::output::d ) ) {
+		advance< OutputPolicy_Events >( tA );
+	} else {
+		advance< OutputPolicy_Diagnostic >( tA );
+	}
+}
+
+// Finish: End Time Outputs, Output Flushes, and Reports
+void
+Simulator::
+finish()
+{
+	assert( initialized_ );
+	assert( ! finished_ );
+
+	// End time outputs and streams close
+	if ( doROut_ || doSOut_ ) {
+		QSS_INSTRUMENT_PHASE( output );
+		for ( size_type i = 0, n = out_vars_.size(); i < n; ++i ) {
+			Variable const * var( out_vars_[ i ] );
+			if ( var->tQ < tE_ ) {
+				if ( opts_.out.x ) {
+					x_outs_[ i ].append( tE_, var->x( tE_ ) );
+					x_outs_[ i ].close();
+				}
+				if ( opts_.out.q ) {
+					q_outs_[ i ].append( tE_, var->q( tE_ ) );
+					q_outs_[ i ].close();
+				}
+			}
+		}
+	}
+
+	// Final values
+	for ( Variable const * var : out_vars_ ) {
+		results_.x[ var->name ] = var->x( t_ );
+		results_.q[ var->name ] = var->q( t_ );
+	}
+
+	bin_out_.close(); // Binary output flush
+	col_out_.close(); // Columnar output flush
+	if ( doSeg_ ) seg_out_.close( tE_ ); // Segment output flush
+
+	// Reporting
+	if ( opts_.report ) {
+		std::cout << "\nSimulation Complete =====" << std::endl;
+		if ( results_.n_discrete_events > 0 ) std::cout << results_.n_discrete_events << " discrete event passes" << std::endl;
+		if ( results_.n_QSS_events > 0 ) std::cout << results_.n_QSS_events << " requantization event passes" << std::endl;
+		if ( results_.n_QSS_simultaneous_events > 0 ) std::cout << results_.n_QSS_simultaneous_events << " simultaneous requantization event passes" << std::endl;
+		if ( results_.n_ZC_events > 0 ) std::cout << results_.n_ZC_events << " zero-crossing event passes" << std::endl;
+		if ( ! clusters_.empty() ) {
+			size_type n_messages( 0u );
+			for ( auto const & cluster : clusters_ ) n_messages += cluster->n_messages();
+			std::cout << n_rounds_ << " cluster synchronization rounds with " << n_messages << " messages" << std::endl;
+			if ( opts_.optimism > 0u ) {
+				size_type n_processed( 0u );
+				size_type n_undone( 0u );
+				size_type n_rollbacks( 0u );
+				for ( auto const & cluster : clusters_ ) {
+					n_processed += cluster->n_processed();
+					n_undone += cluster->n_undone();
+					n_rollbacks += cluster->n_rollbacks();
+				}
+				std::cout << n_processed << " items processed with " << n_undone << " rolled back by " << n_rollbacks << " rollbacks: Rollback ratio " << ( n_processed > 0u ? double( n_undone ) / n_processed : 0.0 ) << std::endl;
+			}
+		}
+	}
+	if ( doStats_ ) { // Per-variable statistics
+		if ( opts_.report ) var_stats_.report( std::cout );
+		var_stats_.write( "stats.csv" );
+	}
+	if ( opts_.outputs ) {
+		QSS_INSTRUMENT_REPORT( "instrument.csv" );
+	}
+	if ( doTrace_ ) tracer_.close(); // Trace flush
+	if ( doPerf_ && opts_.report ) perf_.report( std::cout );
+
+	finished_ = true;
+}
+
+// Build the Model: Builders Take This Simulation's Parameters
+void
+Simulator::
+build()
+{
+	// Model build parameters
+	mdl::Parameters params;
+	params.qss = opts_.qss;
+	params.rTol = opts_.rTol;
+	params.aTol = opts_.aTol;
+	params.size = opts_.size;
+	params.degree = opts_.degree;
+	params.power = opts_.power;
+	params.seed = opts_.seed;
+	params.tEnd_set = ( opts_.tEnd < std::numeric_limits< Time >::infinity() );
+	if ( params.tEnd_set ) params.tEnd = opts_.tEnd;
+
+	// Model setup
+	if ( opts_.model == "achilles" ) {
+		mdl::achilles( vars_, params );
+	} else if ( opts_.model == "achilles2" ) {
+		mdl::achilles2( vars_, params );
+	} else if ( opts_.model == "achillesc" ) {
+		mdl::achillesc( vars_, params );
+	} else if ( opts_.model == "achilles_ND" ) {
+		mdl::achilles_ND( vars_, params );
+	} else if ( opts_.model == "bball" ) {
+		mdl::bball( vars_, params );
+	} else if ( opts_.model == "exponential_decay" ) {
+		mdl::exponential_decay( vars_, params );
+	} else if ( opts_.model == "exponential_decay_sine" ) {
+		mdl::exponential_decay_sine( vars_, params );
+	} else if ( opts_.model == "exponential_decay_sine_ND" ) {
+		mdl::exponential_decay_sine_ND( vars_, params );
+	} else if ( opts_.model == "exponential_decay_step" ) {
+		mdl::exponential_decay_step( vars_, params );
+	} else if ( opts_.model == "nonlinear" ) {
+		mdl::nonlinear( vars_, params );
+	} else if ( opts_.model == "nonlinear_AD" ) {
+		mdl::nonlinear_AD( vars_, params );
+	} else if ( opts_.model == "nonlinear_ND" ) {
+		mdl::nonlinear_ND( vars_, params );
+	} else if ( opts_.model == "stiff" ) {
+		mdl::stiff( vars_, params );
+	} else if ( ( opts_.model == "StateEvent6" ) || ( opts_.model == "stateevent6" ) ) {
+		mdl::StateEvent6( vars_, params );
+	} else if ( opts_.model == "xy" ) {
+		mdl::xy( vars_, params );
+	} else if ( opts_.model == "xyz" ) {
+		mdl::xyz( vars_, params );
+	} else if ( mdl::is_LTI_file( opts_.model ) ) {
+		mdl::LTI_file( vars_, opts_.model, params );
+	} else if ( mdl::is_generated( opts_.model ) ) {
+		mdl::generated( vars_, opts_.model, params );
+	} else {
+		std::cerr << "Error: Unknown model: " << opts_.model << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	tE_ = params.tEnd; // Model default end time unless set
+}
+
+// Advance Through Events at or Before a Time with an Output Policy
+template< typename Policy >
+void
+Simulator::
+advance( Time const tA )
+{
+	// Loop state: Members under their loop names
+	Time const t0( t0_ );
+	Time const tE( tE_ );
+	Time & t( t_ );
+	Time & tOut( tOut_ );
+	size_type & iOut( iOut_ );
+	bool const doSOut( Policy::s && doSOut_ );
+	bool const doTOut( Policy::t && doTOut_ );
+	bool const doROut( Policy::r && doROut_ );
+	bool const doDOut( Policy::d && options::output::d );
+	bool const doStats( doStats_ );
+	bool const doSeg( doSeg_ );
+	bool const doTrace( doTrace_ );
+	bool const doPerf( doPerf_ );
+	bool const doPar( ( pool_ != nullptr ) && ( ! options::output::d ) ); // Parallel simultaneous stages?
+	bool const deterministic( opts_.deterministic ); // Address-independent pass ordering?
+	size_type const nPar( opts_.fanout ); // Min variables for a parallel stage
+	Variables const & out_vars( out_vars_ );
+	size_type const n_out_vars( out_vars_.size() );
+	Var_Idx const & out_idx( out_idx_ );
+	std::vector< Output > & x_outs( x_outs_ );
+	std::vector< Output > & q_outs( q_outs_ );
+	VariableStats< Variable > & var_stats( var_stats_ );
+	SegmentOutput & seg_out( seg_out_ );
+	Tracer & tracer( tracer_ );
+	PerfCounters & perf( perf_ );
+	size_type & n_discrete_events( results_.n_discrete_events );
+	size_type & n_QSS_events( results_.n_QSS_events );
+	size_type & n_QSS_simultaneous_events( results_.n_QSS_simultaneous_events );
+	size_type & n_ZC_events( results_.n_ZC_events );
+
+	// Simulation loop
+	Time const tS( std::min( tA, tE ) ); // Stop time
+	bool perform( true ); // Perform event(s)?
+	while ( perform ) {
+		perform = ( events_.top_time() <= tS );
+		t = ( perform ? events_.top_time() : tS );
+		if ( doSOut ) { // Sampled outputs
+			QSS_INSTRUMENT_PHASE( output );
+			Time const tStop( std::min( t, tS ) );
+			while ( tOut < tStop ) {
+				for ( size_type i = 0; i < n_out_vars; ++i ) {
+					if ( opts_.out.x ) x_outs[ i ].sample( tOut, out_vars[ i ]->x( tOut ) );
+					if ( opts_.out.q ) q_outs[ i ].sample( tOut, out_vars[ i ]->q( tOut ) );
+				}
+				assert( iOut < std::numeric_limits< size_type >::max() );
+				tOut = t0 + ( ++iOut ) * opts_.dtOut;
+			}
+		}
+		if ( perform ) { // Perform event(s)
+			Event< Variable > & event( events_.top() );
+			SuperdenseTime const & s( events_.top_superdense_time() );
+			events_.set_active_time();
+			if ( doTrace ) tracer.begin( s );
+			if ( event.is_discrete() ) { // Discrete event
+				QSS_INSTRUMENT_EVENT( discrete );
+				if ( doPerf ) perf.begin( PerfCounters::discrete );
+				++n_discrete_events;
+				if ( events_.single() ) { // Single trigger
+					Variable * trigger( events_.top_var() );
+					assert( trigger->tD == t );
+					if ( doTOut ) { // Time event variable output: Before discontinuous discrete changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								auto const io( out_idx.find( trigger ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+								}
+								for ( Variable const * observer : trigger->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : trigger->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if time event outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					trigger->advance_discrete();
+					if ( doDOut ) {
+						trigger->advance_d( '*' );
+						trigger->advance_observers_d();
+					}
+					if ( doStats ) {
+						var_stats.discrete( trigger, t );
+						var_stats.observers( trigger->observers() );
+					}
+					if ( doSeg ) {
+						seg_out.log( trigger );
+						seg_out.log_all( trigger->observers() );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::discrete, 1u, trigger->observers().size() );
+					if ( doTOut ) { // Time event variable output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								auto const io( out_idx.find( trigger ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+								}
+								for ( Variable const * observer : trigger->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : trigger->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if time event outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				} else { // Simultaneous triggers
+					Variables triggers( events_.top_vars() );
+					std::sort( triggers.begin(), triggers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort triggers by order
+					for ( Variable * trigger : triggers ) {
+						trigger->sT = s; // Set trigger superdense time
+					}
+					size_type const iBeg_triggers_2( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					size_type const iBeg_triggers_3( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 3; } ) ) ) );
+					int const triggers_order_max( triggers.empty() ? 0 : triggers.back()->order() );
+					Variables const observers( Variable::pass_observers( triggers, deterministic ) );
+					size_type const iBeg_observers_2( static_cast< size_type >( std::distance( observers.begin(), std::find_if( observers.begin(), observers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const order_max( observers.empty() ? triggers_order_max : std::max( triggers_order_max, observers.back()->order() ) );
+					if ( doTOut ) { // Time event output: Before discontinuous discrete changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								for ( Variable const * trigger : triggers ) { // Triggers
+									auto const io( out_idx.find( trigger ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if time event outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					for ( Variable * trigger : triggers ) {
+						assert( trigger->tD == t );
+						trigger->advance_discrete_0_1();
+					}
+					if ( order_max >= 2 ) { // 2nd order pass
+						for ( size_type i = iBeg_triggers_2, n = triggers.size(); i < n; ++i ) {
+							triggers[ i ]->advance_discrete_2();
+						}
+						if ( order_max >= 3 ) { // 3rd order pass
+							for ( size_type i = iBeg_triggers_3, n = triggers.size(); i < n; ++i ) {
+								triggers[ i ]->advance_discrete_3();
+							}
+						}
+					}
+					for ( Variable * trigger : triggers ) {
+						trigger->advance_sums();
+					}
+					Variable::batch_begin( triggers, t );
+					if ( doPar && ( observers.size() >= nPar ) ) {
+						Variable::advance_observers_parallel( *pool_, observers, t );
+					} else {
+						for ( Variable * observer : observers ) {
+							observer->advance_observer( t );
+						}
+					}
+					Variable::batch_end( triggers );
+					if ( doDOut ) {
+						for ( Variable const * trigger : triggers ) trigger->advance_d( '*' );
+						for ( Variable const * observer : observers ) observer->advance_observer_d();
+					}
+					if ( doStats ) {
+						for ( Variable const * trigger : triggers ) var_stats.discrete( trigger, t );
+						var_stats.observers( observers );
+					}
+					if ( doSeg ) {
+						seg_out.log_all( triggers );
+						seg_out.log_all( observers );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::discrete_simultaneous, triggers.size(), observers.size() );
+					if ( doTOut ) { // Time event output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								for ( Variable const * trigger : triggers ) { // Triggers
+									auto const io( out_idx.find( trigger ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if time event outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			} else if ( event.is_QSS() ) { // QSS requantization event
+				QSS_INSTRUMENT_EVENT( QSS );
+				if ( doPerf ) perf.begin( PerfCounters::QSS );
+				++n_QSS_events;
+				if ( events_.single() ) { // Single trigger
+					Variable * trigger( events_.top_var() );
+					assert( trigger->tE == t );
+					trigger->advance_QSS();
+					if ( doDOut ) {
+						trigger->advance_d( '!' );
+						trigger->advance_observers_d();
+					}
+					if ( doStats ) {
+						var_stats.QSS( trigger, t );
+						var_stats.observers( trigger->observers() );
+					}
+					if ( doSeg ) {
+						seg_out.log( trigger );
+						seg_out.log_all( trigger->observers() );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::QSS, 1u, trigger->observers().size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								auto const io( out_idx.find( trigger ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+								}
+								for ( Variable const * observer : trigger->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : trigger->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if requantization outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				} else { // Simultaneous triggers
+					++n_QSS_simultaneous_events;
+					Variables triggers( events_.top_vars() );
+					std::sort( triggers.begin(), triggers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort triggers by order
+					Variables triggers_ZC;
+					Variables triggers_nonZC;
+					for ( Variable * trigger : triggers ) {
+						if ( trigger->is_ZC() ) { // ZC variable
+							triggers_ZC.push_back( trigger );
+						} else { // Non-ZC variable
+							triggers_nonZC.push_back( trigger );
+						}
+						trigger->sT = s; // Set trigger superdense time
+					}
+					size_type const iBeg_triggers_nonZC_2( static_cast< size_type >( std::distance( triggers_nonZC.begin(), std::find_if( triggers_nonZC.begin(), triggers_nonZC.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					size_type const iBeg_triggers_nonZC_3( static_cast< size_type >( std::distance( triggers_nonZC.begin(), std::find_if( triggers_nonZC.begin(), triggers_nonZC.end(), []( Variable * v ){ return v->order() >= 3; } ) ) ) );
+					int const triggers_nonZC_order_max( triggers_nonZC.empty() ? 0 : triggers_nonZC.back()->order() );
+					Variables const observers( Variable::pass_observers( triggers_nonZC, deterministic ) );
+					size_type const iBeg_observers_2( static_cast< size_type >( std::distance( observers.begin(), std::find_if( observers.begin(), observers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const nonZC_order_max( observers.empty() ? triggers_nonZC_order_max : std::max( triggers_nonZC_order_max, observers.back()->order() ) );
+					if ( doPar && ( triggers_nonZC.size() >= nPar ) && std::all_of( triggers_nonZC.begin(), triggers_nonZC.end(), []( Variable const * v ){ return v->is_concurrent(); } ) ) { // Parallel stages
+						// Stages read the reps of the stage's other triggers as of the stage start: Their updates follow in trigger order
+						size_type const n( triggers_nonZC.size() );
+						parallel_stage( *pool_, triggers_nonZC, 0u, [t]( Variable * trigger ){ assert( trigger->tE == t ); trigger->advance_QSS_0(); } );
+						parallel_stage( *pool_, triggers_nonZC, 0u, []( Variable * trigger ){ trigger->advance_QSS_1_deferred(); } );
+						for ( Variable * trigger : triggers_nonZC ) {
+							trigger->advance_QSS_deferred( 1 );
+						}
+						if ( iBeg_triggers_nonZC_2 < n ) { // 2nd order pass
+							parallel_stage( *pool_, triggers_nonZC, iBeg_triggers_nonZC_2, []( Variable * trigger ){ trigger->advance_QSS_2_deferred(); } );
+							for ( size_type i = iBeg_triggers_nonZC_2; i < n; ++i ) {
+								triggers_nonZC[ i ]->advance_QSS_deferred( 2 );
+							}
+							if ( iBeg_triggers_nonZC_3 < n ) { // 3rd order pass
+								parallel_stage( *pool_, triggers_nonZC, iBeg_triggers_nonZC_3, []( Variable * trigger ){ trigger->advance_QSS_3_deferred(); } );
+								for ( size_type i = iBeg_triggers_nonZC_3; i < n; ++i ) {
+									triggers_nonZC[ i ]->advance_QSS_deferred( 3 );
+								}
+							}
+						}
+					} else { // Serial stages
+						for ( Variable * trigger : triggers_nonZC ) {
+							assert( trigger->tE == t );
+							trigger->advance_QSS_0();
+						}
+						for ( Variable * trigger : triggers_nonZC ) {
+							trigger->advance_QSS_1();
+						}
+						if ( nonZC_order_max >= 2 ) { // 2nd order pass
+							for ( size_type i = iBeg_triggers_nonZC_2, n = triggers_nonZC.size(); i < n; ++i ) {
+								triggers_nonZC[ i ]->advance_QSS_2();
+							}
+							if ( nonZC_order_max >= 3 ) { // 3rd order pass
+								for ( size_type i = iBeg_triggers_nonZC_3, n = triggers_nonZC.size(); i < n; ++i ) {
+									triggers_nonZC[ i ]->advance_QSS_3();
+								}
+							}
+						}
+					}
+					Variable::advance_sums( triggers_nonZC );
+					for ( Variable * trigger : triggers_ZC ) {
+						assert( trigger->tE == t );
+						trigger->advance_QSS_simultaneous();
+					}
+					Variable::batch_begin( triggers_nonZC, t );
+					if ( doPar && ( observers.size() >= nPar ) ) {
+						Variable::advance_observers_parallel( *pool_, observers, t );
+					} else {
+						for ( Variable * observer : observers ) {
+							observer->advance_observer( t );
+						}
+					}
+					Variable::batch_end( triggers_nonZC );
+					if ( doDOut ) {
+						for ( Variable const * trigger : triggers_nonZC ) trigger->advance_d( '=' );
+						for ( Variable const * trigger : triggers_ZC ) trigger->advance_d( '=' );
+						for ( Variable const * observer : observers ) observer->advance_observer_d();
+					}
+					if ( doStats ) {
+						for ( Variable const * trigger : triggers ) var_stats.QSS( trigger, t );
+						var_stats.observers( observers );
+					}
+					if ( doSeg ) {
+						seg_out.log_all( triggers );
+						seg_out.log_all( observers );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::QSS_simultaneous, triggers.size(), observers.size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								for ( Variable const * trigger : triggers ) { // Triggers
+									auto const io( out_idx.find( trigger ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if requantization outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			} else if ( event.is_ZC() ) { // Zero-crossing event
+				QSS_INSTRUMENT_EVENT( ZC );
+				if ( doPerf ) perf.begin( PerfCounters::ZC );
+				++n_ZC_events;
+				size_type n_ZC_triggers( 0u );
+				while ( events_.top_superdense_time() == s ) {
+					Variable * trigger( events_.top_var() );
+					assert( trigger->tZC() == t );
+					if ( doDOut ) std::cout << "Z " << trigger->name << '(' << t << ')' << '\n';
+					trigger->advance_ZC();
+					if ( doStats ) var_stats.ZC( trigger );
+					++n_ZC_triggers;
+				}
+				if ( doTrace ) tracer.end( Tracer::Type::ZC, n_ZC_triggers, 0u );
+			} else if ( event.is_handler() ) { // Zero-crossing handler event
+				QSS_INSTRUMENT_EVENT( handler );
+				if ( doPerf ) perf.begin( PerfCounters::handler );
+				if ( events_.single() ) { // Single handler
+					if ( doROut ) { // Requantization output: Before discontinuous handler changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							Variable const * handler( event.var() );
+							if ( opts_.out.r ) { // Requantization variable output
+								auto const io( out_idx.find( handler ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+								}
+								for ( Variable const * observer : handler->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : handler->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if requantization outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					event.var()->advance_handler( t, event.val() );
+					if ( doDOut ) {
+						event.var()->advance_d( '*' );
+						event.var()->advance_observers_d();
+					}
+					if ( doStats ) {
+						var_stats.handler( event.var(), t );
+						var_stats.observers( event.var()->observers() );
+					}
+					if ( doSeg ) {
+						seg_out.log( event.var() );
+						seg_out.log_all( event.var()->observers() );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::handler, 1u, event.var()->observers().size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							Variable const * handler( event.var() );
+							if ( opts_.out.r ) { // Requantization variable output
+								auto const io( out_idx.find( handler ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+								}
+								for ( Variable const * observer : handler->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : handler->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if requantization outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				} else { // Simultaneous handlers
+					Events tops( events_.top_events() );
+					Variables handlers;
+					handlers.reserve( tops.size() );
+					for ( auto & e : tops ) handlers.push_back( e.var() );
+					std::sort( handlers.begin(), handlers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort handlers by order
+					size_type const iBeg_handlers_1( static_cast< size_type >( std::distance( handlers.begin(), std::find_if( handlers.begin(), handlers.end(), []( Variable * v ){ return v->order() >= 1; } ) ) ) );
+					size_type const iBeg_handlers_2( static_cast< size_type >( std::distance( handlers.begin(), std::find_if( handlers.begin(), handlers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					size_type const iBeg_handlers_3( static_cast< size_type >( std::distance( handlers.begin(), std::find_if( handlers.begin(), handlers.end(), []( Variable * v ){ return v->order() >= 3; } ) ) ) );
+					int const handlers_order_max( handlers.empty() ? 0 : handlers.back()->order() );
+					Variables const observers( Variable::pass_observers( handlers, deterministic ) );
+					if ( doROut ) { // Requantization output: Before discontinuous handler changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								for ( Variable const * handler : handlers ) {
+									auto const io( out_idx.find( handler ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if requantization outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					for ( auto & e : tops ) {
+						e.var()->advance_handler_0( t, e.val() );
+					}
+					for ( Variable * handler : handlers ) { // Handler stages use quantized reps of other handlers
+						handler->advance_sums();
+					}
+					for ( size_type i = iBeg_handlers_1, n = handlers.size(); i < n; ++i ) {
+						handlers[ i ]->advance_handler_1();
+					}
+					for ( size_type i = iBeg_handlers_1, n = handlers.size(); i < n; ++i ) {
+						handlers[ i ]->advance_sums();
+					}
+					if ( handlers_order_max >= 2 ) { // 2nd order pass
+						for ( size_type i = iBeg_handlers_2, n = handlers.size(); i < n; ++i ) {
+							handlers[ i ]->advance_handler_2();
+						}
+						for ( size_type i = iBeg_handlers_2, n = handlers.size(); i < n; ++i ) {
+							handlers[ i ]->advance_sums();
+						}
+						if ( handlers_order_max >= 3 ) { // 3rd order pass
+							for ( size_type i = iBeg_handlers_3, n = handlers.size(); i < n; ++i ) {
+								handlers[ i ]->advance_handler_3();
+							}
+							for ( size_type i = iBeg_handlers_3, n = handlers.size(); i < n; ++i ) {
+								handlers[ i ]->advance_sums();
+							}
+						}
+					}
+					Variable::batch_begin( handlers, t );
+					if ( doPar && ( observers.size() >= nPar ) ) {
+						Variable::advance_observers_parallel( *pool_, observers, t );
+					} else {
+						for ( Variable * observer : observers ) {
+							observer->advance_observer( t );
+						}
+					}
+					Variable::batch_end( handlers );
+					if ( doDOut ) {
+						for ( Variable const * handler : handlers ) handler->advance_d( '*' );
+						for ( Variable const * observer : observers ) observer->advance_observer_d();
+					}
+					if ( doStats ) {
+						for ( Variable const * handler : handlers ) var_stats.handler( handler, t );
+						var_stats.observers( observers );
+					}
+					if ( doSeg ) {
+						seg_out.log_all( handlers );
+						seg_out.log_all( observers );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::handler_simultaneous, handlers.size(), observers.size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								for ( Variable const * handler : handlers ) {
+									auto const io( out_idx.find( handler ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if requantization outputs
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			} else { // Unsupported event
+				assert( false );
+			}
+			if ( doPerf ) perf.end();
+		}
+	}
+}
+
+// Advance the Clusters Through Events at or Before a Time (Clipped to the End Time)
+//
+// Each round delivers the messages and bounds each cluster by its feeders' earliest output times
+// then the clusters that can advance before their bounds do so concurrently: If none can, the
+// earliest item is processed alone since no message can arrive before it, or if passes at its
+// superdense time are next in several clusters they are processed as one pass merged across them
+// Rounds and their bounds don't depend on the thread count so neither do the results
+void
+Simulator::
+advance_clusters( Time const tA )
+{
+	Time const tS( std::min( tA, tE_ ) ); // Stop time
+	size_type const n( clusters_.size() );
+	std::vector< Time > next( n ); // Next item times
+	std::vector< Time > eot( n ); // Earliest output times
+	std::vector< Time > bound( n ); // Advance bounds
+	while ( true ) {
+		for ( auto & cluster : clusters_ ) cluster->send( clusters_ );
+		pool_->parallel_for( n, [this,&next,&eot]( size_type const k ){
+			next[ k ] = clusters_[ k ]->next();
+			eot[ k ] = clusters_[ k ]->eot();
+		} );
+		SuperdenseTime sN( infinity ); // Next item superdense time
+		for ( auto const & cluster : clusters_ ) sN = std::min( sN, cluster->next_superdense() );
+		Cluster::count( clusters_, sN, results_.n_QSS_events, results_.n_QSS_simultaneous_events ); // Passes before the next item are final
+		Time const tN( sN.t ); // Next item time
+		if ( tN > tS ) break;
+		++n_rounds_;
+		bool parallel( false );
+		for ( size_type k = 0; k < n; ++k ) {
+			Time b( infinity );
+			for ( size_type const f : clusters_[ k ]->feeders() ) b = std::min( b, eot[ f ] );
+			bound[ k ] = b;
+			if ( ( next[ k ] < b ) && ( next[ k ] <= tS ) ) parallel = true;
+		}
+		if ( parallel ) {
+			pool_->parallel_for( n, [this,&bound,tS]( size_type const k ){ clusters_[ k ]->advance( bound[ k ], tS ); } );
+		} else { // Zero lookahead: Passes before messages at the superdense time
+			size_type n_passes( 0u ); // Clusters with a pass next
+			size_type iN( n ); // Cluster with the next item
+			for ( size_type k = 0; k < n; ++k ) {
+				if ( clusters_[ k ]->pass_at( sN ) ) {
+					if ( n_passes++ == 0u ) iN = k;
+				} else if ( ( iN == n ) && ( clusters_[ k ]->next_superdense() == sN ) ) {
+					iN = k;
+				}
+			}
+			assert( iN < n );
+			if ( n_passes > 1u ) {
+				Cluster::requantize( clusters_, sN );
+			} else {
+				clusters_[ iN ]->step();
+			}
+		}
+	}
+	t_ = tS;
+}
+
+// Advance the Clusters Optimistically Through Events at or Before a Time (Clipped to the End Time)
+//
+// Each round delivers the messages and anti-messages, computes the global virtual time (GVT) as the
+// earliest unprocessed item or message time, and commits the items before it, then the clusters
+// accept their messages, rolling back for stragglers, and speculatively process up to the optimism
+// number of items each: The globally earliest item can't be rolled back so every round progresses
+// A pass found at the superdense time of another cluster's pass whose messages it exchanges rolls
+// every cluster back to that time and holds them there until the GVT reaches it, then the passes
+// at that time are processed as one pass merged across their clusters
+// Rounds don't depend on the thread count so neither do the results
+void
+Simulator::
+advance_clusters_optimistic( Time const tA )
+{
+	Time const tS( std::min( tA, tE_ ) ); // Stop time
+	size_type const n( clusters_.size() );
+	size_type const m( opts_.optimism ); // Items per cluster per round
+	Cluster & lead( *clusters_.front() ); // Holds are on every cluster
+	while ( true ) {
+		for ( auto & cluster : clusters_ ) cluster->send( clusters_ );
+		pool_->parallel_for( n, [this]( size_type const k ){ clusters_[ k ]->accept(); } );
+		SuperdenseTime sN( infinity ); // Next item superdense time
+		for ( auto const & cluster : clusters_ ) sN = std::min( sN, cluster->next_superdense() );
+		Time const gvt( sN.t ); // Global virtual time
+		pool_->parallel_for( n, [this,gvt]( size_type const k ){ clusters_[ k ]->commit( gvt ); } );
+		Cluster::count( clusters_, sN, results_.n_QSS_events, results_.n_QSS_simultaneous_events ); // Passes before the GVT are final
+		if ( gvt > tS ) break;
+		++n_rounds_;
+
+		// Shared superdense times roll back and hold the clusters
+		bool tied( false );
+		SuperdenseTime sH( lead.held() ? lead.hold() : SuperdenseTime( infinity ) ); // Hold superdense time
+		for ( auto const & cluster : clusters_ ) {
+			if ( cluster->tied() ) {
+				tied = true;
+				sH = std::min( sH, cluster->tie() );
+			}
+		}
+		if ( tied ) {
+			pool_->parallel_for( n, [this,&sH]( size_type const k ){ clusters_[ k ]->hold( sH ); } );
+			continue;
+		}
+		if ( lead.held() && ( ! ( sN < sH ) ) ) { // Every cluster reached the hold
+			bool pass( false );
+			for ( auto const & cluster : clusters_ ) pass = pass || cluster->pass_at( sH );
+			if ( pass && ( sN == sH ) ) Cluster::requantize( clusters_, sH );
+			for ( auto & cluster : clusters_ ) cluster->release();
+			continue;
+		}
+
+		pool_->parallel_for( n, [this,tS,m]( size_type const k ){ clusters_[ k ]->speculate( tS, m ); } );
+	}
+	t_ = tS;
+}
+
+} // dfn
+} // QSS
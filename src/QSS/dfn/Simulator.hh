@@ -0,0 +1,343 @@
+// QSS Defined Model Simulator
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_Simulator_hh_INCLUDED
+#define QSS_dfn_Simulator_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/Cluster.hh>
+#include <QSS/dfn/Variable.hh>
+#include <QSS/BinaryOutput.hh>
+#include <QSS/ColumnarOutput.hh>
+#include <QSS/EventQueue.hh>
+#include <QSS/options.hh>
+#include <QSS/Output.hh>
+#include <QSS/PerfCounters.hh>
+#include <QSS/SegmentOutput.hh>
+#include <QSS/ThreadPool.hh>
+#include <QSS/Tracer.hh>
+#include <QSS/VariableStats.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+
+// QSS Defined Model Simulator
+//
+// Owns a model's variables, event queue, outputs, and loop state so a process can hold several
+// simulations and step each incrementally: init() then advance_to() calls then finish()
+//
+// The variables schedule their events in the simulator's queue through their queue pointers
+// so Simulators can interleave and run on separate threads without thread-local state
+//
+// LTI QSS models can run partitioned into clusters with their own queues that advance concurrently
+// under conservative or optimistic synchronization when the per-event outputs are off
+//
+// Models are built with the simulator's QSS method, tolerances, generator settings, and end time
+// passed to the builders so concurrent builds don't touch shared state; the time step limits, output
+// format, and diagnostic output are taken from the global options, which must not change while
+// simulations run
+class Simulator
+{
+
+public: // Types
+
+	using Variables = Variable::Variables;
+	using size_type = Variables::size_type;
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+
+	// Output Selection
+	struct Selection
+	{
+		bool t{ options::output::t }; // Time events?
+		bool r{ options::output::r }; // Requantizations?
+		bool o{ options::output::o }; // Observers?
+		bool a{ options::output::a }; // All variables?
+		bool s{ options::output::s }; // Sampled output?
+		bool x{ options::output::x }; // Continuous trajectories?
+		bool q{ options::output::q }; // Quantized trajectories?
+		bool x_segments{ options::output::x_segments }; // Continuous trajectory segments?
+		bool q_segments{ options::output::q_segments }; // Quantized trajectory segments?
+		std::vector< std::string > include{ options::output::include }; // Variable name patterns to output
+		std::vector< std::string > exclude{ options::output::exclude }; // Variable name patterns not to output
+	};
+
+	// Simulation Options
+	struct Options
+	{
+		std::string model{ options::model }; // Model name
+		options::QSS qss{ options::qss }; // QSS method
+		Value rTol{ options::rTol }; // Relative tolerance
+		Value aTol{ options::aTol }; // Absolute tolerance
+		std::size_t size{ options::gen::size }; // Generated model size
+		std::size_t degree{ options::gen::degree }; // Generated model mean coupling degree
+		bool power{ options::gen::power }; // Generated model power law degree distribution?
+		std::uint64_t seed{ options::gen::seed }; // Generated model random seed
+		Time tEnd{ options::tEnd_set ? options::tEnd : std::numeric_limits< Time >::infinity() }; // End time (s): Model default if infinite
+		Time dtOut{ options::dtOut }; // Sampled output step (s)
+		std::map< std::string, Value > xIni; // Initial value overrides by variable name
+		std::size_t fanout{ options::fanout }; // Observers, simultaneous triggers, or variables for parallel advance and initialization: 0 for off
+		std::size_t threads{ options::threads }; // Parallel advance threads: 0 for hardware concurrency
+		bool deterministic{ options::deterministic }; // Deterministic parallel advance scheduling and pass ordering?
+		bool pin{ options::pin }; // Pin parallel advance threads to CPUs?
+		std::size_t clusters{ options::clusters }; // Partitioned simulation clusters: 0 or 1 for off
+		std::size_t optimism{ options::optimism }; // Optimistic partitioned simulation items per cluster per round: 0 for conservative
+		Selection out; // Output selection
+		bool outputs{ true }; // Trajectory, statistics, trace, and counter outputs?
+		bool report{ true }; // Console progress and reports?
+	};
+
+	// Simulation Results: Event Pass Counts and Final Values
+	struct Results
+	{
+		size_type n_discrete_events{ 0u }; // Discrete event passes
+		size_type n_QSS_events{ 0u }; // Requantization event passes
+		size_type n_QSS_simultaneous_events{ 0u }; // Simultaneous requantization event passes
+		size_type n_ZC_events{ 0u }; // Zero-crossing event passes
+		std::map< std::string, Value > x; // Final continuous values of the output variables by name
+		std::map< std::string, Value > q; // Final quantized values of the output variables by name
+	};
+
+private: // Types
+
+	using Events = EventQueue< Variable >::Events;
+	using Var_Idx = std::unordered_map< Variable const *, size_type >; // Map from Variables to their indexes
+
+public: // Creation
+
+	// Default Constructor: Global Options
+	Simulator();
+
+	// Options Constructor
+	explicit
+	Simulator( Options const & opts );
+
+	// Copy Constructor
+	Simulator( Simulator const & ) = delete;
+
+	// Move Constructor
+	Simulator( Simulator && ) = delete;
+
+	// Destructor
+	~Simulator();
+
+public: // Assignment
+
+	// Copy Assignment
+	Simulator &
+	operator =( Simulator const & ) = delete;
+
+	// Move Assignment
+	Simulator &
+	operator =( Simulator && ) = delete;
+
+public: // Predicates
+
+	// Initialized?
+	bool
+	initialized() const
+	{
+		return initialized_;
+	}
+
+	// Finished?
+	bool
+	finished() const
+	{
+		return finished_;
+	}
+
+	// Partitioned Simulation?
+	bool
+	partitioned() const
+	{
+		return ! clusters_.empty();
+	}
+
+public: // Properties
+
+	// Options
+	Options const &
+	opts() const
+	{
+		return opts_;
+	}
+
+	// Current Time
+	Time
+	t() const
+	{
+		return t_;
+	}
+
+	// End Time
+	Time
+	tE() const
+	{
+		return tE_;
+	}
+
+	// Results
+	Results const &
+	results() const
+	{
+		return results_;
+	}
+
+	// Partitioned Simulation Clusters
+	Cluster::Clusters const &
+	clusters() const
+	{
+		return clusters_;
+	}
+
+	// Variables
+	Variables const &
+	vars() const
+	{
+		return vars_;
+	}
+
+	// Output Variables: Selected by the Output Filter
+	Variables const &
+	out_vars() const
+	{
+		return out_vars_;
+	}
+
+	// Variable of a Name or nullptr if None
+	Variable *
+	var( std::string const & name ) const;
+
+	// Continuous Value of a Variable at the Current Time
+	Value
+	x( std::string const & name ) const;
+
+	// Quantized Value of a Variable at the Current Time
+	Value
+	q( std::string const & name ) const;
+
+public: // Methods
+
+	// Initialize: Build the Model, Initialize its Variables, and Open Outputs
+	void
+	init();
+
+	// Advance Through Events at or Before a Time (Clipped to the End Time)
+	void
+	advance_to( Time const tA );
+
+	// Finish: End Time Outputs, Output Flushes, and Reports
+	void
+	finish();
+
+private: // Methods
+
+	// Build the Model
+	void
+	build();
+
+	// Advance Through Events at or Before a Time with an Output Policy
+	template< typename Policy >
+	void
+	advance( Time const tA );
+
+	// Advance the Clusters Through Events at or Before a Time
+	void
+	advance_clusters( Time const tA );
+
+	// Advance the Clusters Optimistically Through Events at or Before a Time
+	void
+	advance_clusters_optimistic( Time const tA );
+
+private: // Data
+
+	Options opts_; // Options
+	bool initialized_{ false }; // Initialized?
+	bool finished_{ false }; // Finished?
+
+	// Model
+	Variables vars_; // Variables
+	EventQueue< Variable > events_; // Event queue of the variables
+	std::unique_ptr< ThreadPool > pool_; // Parallel initialization and advance pool
+	Cluster::Clusters clusters_; // Partitioned simulation clusters
+	size_type n_rounds_{ 0u }; // Partitioned simulation synchronization rounds
+
+	// Timing
+	Time t0_{ 0.0 }; // Start time
+	Time tE_{ 0.0 }; // End time
+	Time t_{ 0.0 }; // Current time
+	Time tOut_{ 0.0 }; // Sampling time
+	size_type iOut_{ 1u }; // Output step index
+
+	// Outputs
+	bool doSOut_{ false }; // Sampled outputs?
+	bool doTOut_{ false }; // Time event outputs?
+	bool doROut_{ false }; // Requantization outputs?
+	Variables out_vars_; // Output variables
+	Var_Idx out_idx_; // Output variable indexes
+	BinaryOutput bin_out_; // Binary output file
+	ColumnarOutput col_out_; // Columnar output file
+	std::vector< Output > x_outs_; // Continuous outputs
+	std::vector< Output > q_outs_; // Quantized outputs
+	SegmentOutput seg_out_; // Segment output
+	bool doSeg_{ false }; // Segment output?
+
+	// Instrumentation
+	VariableStats< Variable > var_stats_; // Per-variable statistics
+	bool doStats_{ false }; // Per-variable statistics?
+	Tracer tracer_; // Event pass tracer
+	bool doTrace_{ false }; // Event pass tracing?
+	PerfCounters perf_; // Hardware performance counters
+	bool doPerf_{ false }; // Hardware performance counters?
+
+	Results results_; // Results
+
+};
+
+} // dfn
+} // QSS
+
+#endif
@@ -0,0 +1,221 @@
+// Incremental Linear Sum of Quantized Representations
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/Sum_LTI.hh>
+
+namespace QSS {
+namespace dfn {
+
+// Vectorizable Sum Kernels
+//
+// Blocked SoA loops with independent partial sums per lane so the compiler can
+// vectorize the reductions: Compiled for AVX-512 and AVX2 on x86 GCC/Clang
+// builds with the best supported variant selected at first use
+namespace {
+
+using Time = Sum_LTI::Time;
+using Value = Sum_LTI::Value;
+using size_type = Sum_LTI::size_type;
+
+std::size_t const B( 8u ); // Block size: Lanes of partial sums
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define QSS_SUM_LTI_DISPATCH
+#define QSS_SUM_LTI_INLINE inline __attribute__((always_inline))
+#else
+#define QSS_SUM_LTI_INLINE inline
+#endif
+
+// Sum of Lane Partial Sums
+QSS_SUM_LTI_INLINE
+Value
+lanes_sum( Value const * a )
+{
+	return ( ( a[ 0 ] + a[ 1 ] ) + ( a[ 2 ] + a[ 3 ] ) ) + ( ( a[ 4 ] + a[ 5 ] ) + ( a[ 6 ] + a[ 7 ] ) );
+}
+
+// Quantized Value Sum at Time t
+QSS_SUM_LTI_INLINE
+Value
+q_body( size_type const n, Value const * c, Time const * tQ, Value const * q_0, Value const * q_1, Value const * q_2, Time const t )
+{
+	Value a[ B ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	size_type const m( n - ( n % B ) );
+	for ( size_type i = 0; i < m; i += B ) {
+		for ( size_type j = 0; j < B; ++j ) {
+			size_type const k( i + j );
+			Time const d( t - tQ[ k ] );
+			a[ j ] += c[ k ] * ( q_0[ k ] + ( ( q_1[ k ] + ( q_2[ k ] * d ) ) * d ) );
+		}
+	}
+	for ( size_type k = m; k < n; ++k ) {
+		Time const d( t - tQ[ k ] );
+		a[ k - m ] += c[ k ] * ( q_0[ k ] + ( ( q_1[ k ] + ( q_2[ k ] * d ) ) * d ) );
+	}
+	return lanes_sum( a );
+}
+
+// Quantized First Derivative Sum at Time t
+QSS_SUM_LTI_INLINE
+Value
+q1_body( size_type const n, Value const * c, Time const * tQ, Value const * q_1, Value const * q_2, Time const t )
+{
+	Value a[ B ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	size_type const m( n - ( n % B ) );
+	for ( size_type i = 0; i < m; i += B ) {
+		for ( size_type j = 0; j < B; ++j ) {
+			size_type const k( i + j );
+			a[ j ] += c[ k ] * ( q_1[ k ] + ( 2.0 * q_2[ k ] * ( t - tQ[ k ] ) ) );
+		}
+	}
+	for ( size_type k = m; k < n; ++k ) {
+		a[ k - m ] += c[ k ] * ( q_1[ k ] + ( 2.0 * q_2[ k ] * ( t - tQ[ k ] ) ) );
+	}
+	return lanes_sum( a );
+}
+
+// Quantized Second Derivative Sum
+QSS_SUM_LTI_INLINE
+Value
+q2_body( size_type const n, Value const * c, Value const * q_2 )
+{
+	Value a[ B ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	size_type const m( n - ( n % B ) );
+	for ( size_type i = 0; i < m; i += B ) {
+		for ( size_type j = 0; j < B; ++j ) {
+			size_type const k( i + j );
+			a[ j ] += c[ k ] * q_2[ k ];
+		}
+	}
+	for ( size_type k = m; k < n; ++k ) {
+		a[ k - m ] += c[ k ] * q_2[ k ];
+	}
+	return 2.0 * lanes_sum( a );
+}
+
+// Kernel Function Pointer Types
+using Q_Kernel = Value (*)( size_type, Value const *, Time const *, Value const *, Value const *, Value const *, Time );
+using Q1_Kernel = Value (*)( size_type, Value const *, Time const *, Value const *, Value const *, Time );
+using Q2_Kernel = Value (*)( size_type, Value const *, Value const * );
+
+// Kernel Variants
+#define QSS_SUM_LTI_KERNELS(SUFFIX,ATTR) \
+ATTR Value q_##SUFFIX( size_type const n, Value const * c, Time const * tQ, Value const * q_0, Value const * q_1, Value const * q_2, Time const t ) \
+{ return q_body( n, c, tQ, q_0, q_1, q_2, t ); } \
+ATTR Value q1_##SUFFIX( size_type const n, Value const * c, Time const * tQ, Value const * q_1, Value const * q_2, Time const t ) \
+{ return q1_body( n, c, tQ, q_1, q_2, t ); } \
+ATTR Value q2_##SUFFIX( size_type const n, Value const * c, Value const * q_2 ) \
+{ return q2_body( n, c, q_2 ); }
+
+QSS_SUM_LTI_KERNELS(generic,)
+#ifdef QSS_SUM_LTI_DISPATCH
+QSS_SUM_LTI_KERNELS(avx2,__attribute__((target("avx2,fma"))))
+QSS_SUM_LTI_KERNELS(avx512,__attribute__((target("avx512f,avx2,fma"))))
+#endif
+
+// Kernel Set
+struct Kernels
+{
+	Q_Kernel q;
+	Q1_Kernel q1;
+	Q2_Kernel q2;
+	char const * isa;
+};
+
+// Kernel Set for the Running CPU
+Kernels
+kernels_select()
+{
+#ifdef QSS_SUM_LTI_DISPATCH
+	__builtin_cpu_init();
+	if ( __builtin_cpu_supports( "avx512f" ) ) return Kernels{ q_avx512, q1_avx512, q2_avx512, "AVX-512" };
+	if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) ) return Kernels{ q_avx2, q1_avx2, q2_avx2, "AVX2" };
+#endif
+	return Kernels{ q_generic, q1_generic, q2_generic, "Generic" };
+}
+
+// Kernel Set Singleton
+Kernels const &
+kernels()
+{
+	static Kernels const k( kernels_select() );
+	return k;
+}
+
+} // Internal
+
+// Quantized Value Summed Over Terms at Time t
+Sum_LTI::Value
+Sum_LTI::q_sum( Time const t ) const
+{
+	return kernels().q( c_.size(), c_.data(), tQ_.data(), q_0_.data(), q_1_.data(), q_2_.data(), t );
+}
+
+// Quantized First Derivative Summed Over Terms at Time t
+Sum_LTI::Value
+Sum_LTI::q1_sum( Time const t ) const
+{
+	return kernels().q1( c_.size(), c_.data(), tQ_.data(), q_1_.data(), q_2_.data(), t );
+}
+
+// Quantized Second Derivative Summed Over Terms
+Sum_LTI::Value
+Sum_LTI::q2_sum() const
+{
+	return kernels().q2( c_.size(), c_.data(), q_2_.data() );
+}
+
+// Build the Sum About Reference Time tR from the Term Representations
+void
+Sum_LTI::build( Time const tR )
+{
+	tR_ = tR;
+	s_0_ = q_sum( tR );
+	s_1_ = q1_sum( tR );
+	s_2_ = one_half * q2_sum();
+	n_updates_ = 0u;
+	built_ = true;
+}
+
+// Sum Kernel Instruction Set Name
+char const *
+Sum_LTI::isa()
+{
+	return kernels().isa;
+}
+
+} // dfn
+} // QSS
@@ -0,0 +1,268 @@
+// Incremental Linear Sum of Quantized Representations
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_Sum_LTI_hh_INCLUDED
+#define QSS_dfn_Sum_LTI_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/math.hh>
+
+// C++ Headers
+#include <cassert>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+
+// Incremental Linear Sum of Quantized Representations
+//
+// Holds the sum of coefficient-weighted term quantized representations as a
+// polynomial about a reference time so requantization of a term updates it
+// with just that term's change instead of re-evaluating every term
+//
+// The term representations are held in contiguous arrays so the direct sums
+// can use vectorized kernels selected for the running CPU
+class Sum_LTI
+{
+
+public: // Types
+
+	using Time = double;
+	using Value = double;
+	using Coefficient = double;
+	using Coefficients = std::vector< Coefficient >;
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+	using size_type = Coefficients::size_type;
+
+	// Term and Sum State for Rollback
+	struct State
+	{
+		size_type i; // Term index
+		Time tQ; // Term quantized time range begin
+		Value q_0, q_1, q_2; // Term quantized rep coefficients
+		Time tR; // Sum reference time
+		Value s_0, s_1, s_2; // Sum coefficients
+		size_type n_updates; // Incremental updates since last build
+		bool built; // Sum built?
+	};
+
+public: // Predicate
+
+	// Built?
+	bool
+	built() const
+	{
+		return built_;
+	}
+
+public: // Properties
+
+	// Size
+	size_type
+	size() const
+	{
+		return c_.size();
+	}
+
+	// Quantized Value at Time t
+	Value
+	q( Time const t ) const
+	{
+		assert( built_ );
+		Time const tDel( t - tR_ );
+		return s_0_ + ( ( s_1_ + ( s_2_ * tDel ) ) * tDel );
+	}
+
+	// Quantized First Derivative at Time t
+	Value
+	q1( Time const t ) const
+	{
+		assert( built_ );
+		return s_1_ + ( two * s_2_ * ( t - tR_ ) );
+	}
+
+	// Quantized Second Derivative at Time t
+	Value
+	q2( Time const ) const
+	{
+		assert( built_ );
+		return two * s_2_;
+	}
+
+	// Quantized Value Summed Over Terms at Time t
+	Value
+	q_sum( Time t ) const;
+
+	// Quantized First Derivative Summed Over Terms at Time t
+	Value
+	q1_sum( Time t ) const;
+
+	// Quantized Second Derivative Summed Over Terms
+	Value
+	q2_sum() const;
+
+public: // Static Methods
+
+	// Sum Kernel Instruction Set Name
+	static
+	char const *
+	isa();
+
+public: // Methods
+
+	// Clear
+	void
+	clear()
+	{
+		c_.clear();
+		tQ_.clear();
+		q_0_.clear();
+		q_1_.clear();
+		q_2_.clear();
+		tR_ = s_0_ = s_1_ = s_2_ = 0.0;
+		n_updates_ = 0u;
+		built_ = false;
+	}
+
+	// Add a Term: Returns its Index
+	size_type
+	add( Coefficient const c )
+	{
+		c_.push_back( c );
+		tQ_.push_back( 0.0 );
+		q_0_.push_back( 0.0 );
+		q_1_.push_back( 0.0 );
+		q_2_.push_back( 0.0 );
+		built_ = false;
+		return c_.size() - 1u;
+	}
+
+	// Set a Term's Quantized Representation Coefficients without Updating the Sum
+	void
+	set(
+	 size_type const i,
+	 Time const tQ,
+	 Value const q_0,
+	 Value const q_1 = 0.0,
+	 Value const q_2 = 0.0
+	)
+	{
+		assert( i < c_.size() );
+		tQ_[ i ] = tQ;
+		q_0_[ i ] = q_0;
+		q_1_[ i ] = q_1;
+		q_2_[ i ] = q_2;
+	}
+
+	// Build the Sum About Reference Time tR from the Term Representations
+	void
+	build( Time tR );
+
+	// Update a Term's Quantized Representation Coefficients and the Sum
+	void
+	update(
+	 size_type const i,
+	 Time const tQ,
+	 Value const q_0,
+	 Value const q_1 = 0.0,
+	 Value const q_2 = 0.0
+	)
+	{
+		assert( i < c_.size() );
+		if ( ! built_ ) { // Sum is built from the current term representations on first use
+			set( i, tQ, q_0, q_1, q_2 );
+		} else if ( ++n_updates_ >= c_.size() ) { // Periodic full recomputation to bound drift: Amortized O(1)
+			set( i, tQ, q_0, q_1, q_2 );
+			build( tQ );
+		} else { // Apply the change in the term's contribution
+			Coefficient const c( c_[ i ] );
+			Time const dp( tR_ - tQ_[ i ] ); // Previous rep offset
+			Time const d( tR_ - tQ ); // New rep offset
+			Value const q_2p( q_2_[ i ] );
+			s_0_ += c * ( ( q_0 + ( ( q_1 + ( q_2 * d ) ) * d ) ) - ( q_0_[ i ] + ( ( q_1_[ i ] + ( q_2p * dp ) ) * dp ) ) );
+			s_1_ += c * ( ( q_1 + ( two * q_2 * d ) ) - ( q_1_[ i ] + ( two * q_2p * dp ) ) );
+			s_2_ += c * ( q_2 - q_2p );
+			set( i, tQ, q_0, q_1, q_2 );
+		}
+	}
+
+	// Save the State a Term Update Changes
+	void
+	save( size_type const i, State & state ) const
+	{
+		assert( i < c_.size() );
+		state.i = i;
+		state.tQ = tQ_[ i ];
+		state.q_0 = q_0_[ i ];
+		state.q_1 = q_1_[ i ];
+		state.q_2 = q_2_[ i ];
+		state.tR = tR_;
+		state.s_0 = s_0_;
+		state.s_1 = s_1_;
+		state.s_2 = s_2_;
+		state.n_updates = n_updates_;
+		state.built = built_;
+	}
+
+	// Restore a Saved State
+	void
+	restore( State const & state )
+	{
+		set( state.i, state.tQ, state.q_0, state.q_1, state.q_2 );
+		tR_ = state.tR;
+		s_0_ = state.s_0;
+		s_1_ = state.s_1;
+		s_2_ = state.s_2;
+		n_updates_ = state.n_updates;
+		built_ = state.built;
+	}
+
+private: // Data
+
+	Coefficients c_; // Term coefficients
+	Times tQ_; // Term quantized time range begin
+	Values q_0_, q_1_, q_2_; // Term quantized rep coefficients
+	Time tR_{ 0.0 }; // Sum reference time
+	Value s_0_{ 0.0 }, s_1_{ 0.0 }, s_2_{ 0.0 }; // Sum coefficients
+	size_type n_updates_{ 0u }; // Incremental updates since last build
+	bool built_{ false }; // Sum built?
+
+};
+
+} // dfn
+} // QSS
+
+#endif
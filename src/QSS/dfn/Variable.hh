@@ -39,17 +39,22 @@
 // QSS Headers
 #include <QSS/dfn/Variable.fwd.hh>
 #include <QSS/dfn/globals_dfn.hh>
+#include <QSS/dfn/Sum_LTI.hh>
 #include <QSS/EventQueue.hh>
 #include <QSS/math.hh>
 #include <QSS/options.hh>
+#include <QSS/ThreadPool.hh>
 
 // C++ Headers
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace QSS {
@@ -66,6 +71,56 @@ public: // Types
 	using Variables = std::vector< Variable * >;
 	using EventQ = EventQueue< Variable >;
 	using size_type = Variables::size_type;
+	using Sums = std::vector< std::pair< Sum_LTI *, Sum_LTI::size_type > >; // Incremental sums and the index of this Variable's term
+
+	// Observer or Incremental Sum Registration with an Observee Deferred by Parallel Initialization
+	struct Registration
+	{
+		Variable * observee; // Observee
+		Sum_LTI * sum; // Incremental sum or nullptr for an observer registration
+		Sum_LTI::size_type i; // Index of the observee's term in the sum
+	};
+	using Registrations = std::vector< Registration >;
+
+	// Observer Derivative Batch: Evaluates the Batched Derivatives of a Pass's Observers Together
+	class ObserverBatch
+	{
+
+	public: // Creation
+
+		// Destructor
+		virtual
+		~ObserverBatch() = default;
+
+	public: // Methods
+
+		// Add the Batched Observers of Trigger k to the Pass: Opens a Pass if None is Open
+		virtual
+		void
+		add( size_type const k ) = 0;
+
+		// Evaluate the Pass's Batched Observer Derivatives at Time t: Once per Pass
+		virtual
+		void
+		evaluate( Time const t ) = 0;
+
+		// Close the Pass
+		virtual
+		void
+		end() = 0;
+
+	};
+	using Batches = std::vector< std::pair< ObserverBatch *, size_type > >; // Observer batches and this Variable's trigger index in each
+
+	// Trajectory State for Rollback: Time Ranges, Tolerance, and Representation Coefficients
+	struct State
+	{
+		Time tQ, tX, tE; // Time ranges
+		Time dt_inf_rlx; // Relaxed time step inf
+		Value qTol; // Quantization tolerance
+		SuperdenseTime sT; // Trigger superdense time
+		Value c[ 7 ]; // Representation coefficients
+	};
 
 	// Zero Crossing Type
 	enum class Crossing {
@@ -187,6 +242,21 @@ public: // Predicate
 		return false;
 	}
 
+	// Advances Can Run Concurrently with Other Variables' Advances of the Same Stage?
+	virtual
+	bool
+	is_concurrent() const
+	{ // Default implementation
+		return false;
+	}
+
+	// Parallel Observer Advance?
+	bool
+	parallel_observers() const
+	{
+		return pool_ != nullptr;
+	}
+
 public: // Properties
 
 	// Order of Method
@@ -289,6 +359,20 @@ public: // Properties
 		return observers_;
 	}
 
+	// Incremental Sums with a Term for this Variable
+	Sums const &
+	sums() const
+	{
+		return sums_;
+	}
+
+	// Event Queue
+	EventQ &
+	queue() const
+	{
+		return *events_;
+	}
+
 	// Event Queue Iterator
 	EventQ::iterator &
 	event()
@@ -335,14 +419,19 @@ public: // Methods
 	void
 	add_observer( Variable & v )
 	{
-		if ( &v != this ) observers_.push_back( &v ); // Don't need to self-observe: Observers called at the end of self requantization
+		add_observer( &v );
 	}
 
-	// Add Observer
+	// Add Observer: Deferred to the Observer's Registrations While it Initializes in Parallel
 	void
 	add_observer( Variable * v )
 	{
-		if ( v != this ) observers_.push_back( v ); // Don't need to self-observe: Observers called at the end of self requantization
+		if ( v == this ) return; // Don't need to self-observe: Observers called at the end of self requantization
+		if ( v->deferred_ ) {
+			v->registrations_.push_back( Registration{ this, nullptr, 0u } );
+		} else {
+			observers_.push_back( v );
+		}
 	}
 
 	// Shrink Observers Collection
@@ -352,11 +441,81 @@ public: // Methods
 		observers_.shrink_to_fit();
 	}
 
+	// Set the Event Queue
+	void
+	set_queue( EventQ & q )
+	{
+		events_ = &q;
+	}
+
+	// Set Parallel Observer Advance on a Pool if the Concurrent Observers Reach a Fan-Out Threshold (0 for Off)
+	void
+	set_parallel_observers( size_type const fanout, ThreadPool * pool )
+	{
+		pool_ = nullptr;
+		if ( ( pool == nullptr ) || ( fanout == 0u ) || ( observers_.size() < fanout ) ) return;
+		size_type n_concurrent( 0u );
+		for ( Variable const * observer : observers_ ) {
+			if ( observer->is_concurrent() ) ++n_concurrent;
+		}
+		if ( n_concurrent < fanout ) return;
+		Variables sorted( observers_ );
+		std::sort( sorted.begin(), sorted.end() );
+		if ( std::adjacent_find( sorted.begin(), sorted.end() ) == sorted.end() ) pool_ = pool; // Repeat observers advance serially
+	}
+
+	// Trigger Index in an Observer Batch: Adds this Variable as a Trigger of the Batch at Index k if Not Already Present
+	size_type
+	add_batch( ObserverBatch * batch, size_type const k )
+	{
+		assert( batch != nullptr );
+		for ( auto const & b : batches_ ) {
+			if ( b.first == batch ) return b.second;
+		}
+		batches_.emplace_back( batch, k );
+		return k;
+	}
+
+	// Add Incremental Sum Term of an Observer: Deferred to the Observer's Registrations While it Initializes in Parallel
+	void
+	add_sum( Sum_LTI * sum, Sum_LTI::size_type const i, Variable * v )
+	{
+		assert( sum != nullptr );
+		assert( v != nullptr );
+		if ( v->deferred_ ) {
+			v->registrations_.push_back( Registration{ this, sum, i } );
+		} else {
+			sums_.emplace_back( sum, i );
+		}
+	}
+
+	// Defer Observer and Incremental Sum Registrations with Observees: Parallel Initialization
+	void
+	defer_registrations()
+	{
+		deferred_ = true;
+	}
+
+	// Make the Deferred Registrations with Observees in their Original Order
+	void
+	register_deferred()
+	{
+		for ( Registration const & r : registrations_ ) {
+			if ( r.sum == nullptr ) {
+				r.observee->observers_.push_back( this );
+			} else {
+				r.observee->sums_.emplace_back( r.sum, r.i );
+			}
+		}
+		Registrations().swap( registrations_ );
+		deferred_ = false;
+	}
+
 	// Add Handler Event
 	void
 	add_handler()
 	{
-		event_ = events.add_handler( this );
+		event_ = events_->add_handler( this );
 	}
 
 	// Initialization
@@ -401,6 +560,36 @@ public: // Methods
 	init_3()
 	{}
 
+	// Initialization: Parallel Stage 1: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	init_1_deferred()
+	{ // Default implementation: No deferred updates
+		init_1();
+	}
+
+	// Initialization: Parallel Stage 2: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	init_2_deferred()
+	{ // Default implementation: No deferred updates
+		init_2();
+	}
+
+	// Initialization: Parallel Stage 3: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	init_3_deferred()
+	{ // Default implementation: No deferred updates
+		init_3();
+	}
+
+	// Initialization: Deferred Quantized Coefficient Updates After Parallel Stage k
+	virtual
+	void
+	init_deferred( int const )
+	{} // Default implementation: No deferred updates
+
 	// Discrete Advance
 	virtual
 	void
@@ -473,13 +662,181 @@ public: // Methods
 	advance_QSS_3()
 	{}
 
+	// QSS Advance: Parallel Stage 1: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	advance_QSS_1_deferred()
+	{ // Default implementation: No deferred updates
+		advance_QSS_1();
+	}
+
+	// QSS Advance: Parallel Stage 2: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	advance_QSS_2_deferred()
+	{ // Default implementation: No deferred updates
+		advance_QSS_2();
+	}
+
+	// QSS Advance: Parallel Stage 3: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	advance_QSS_3_deferred()
+	{ // Default implementation: No deferred updates
+		advance_QSS_3();
+	}
+
+	// QSS Advance: Deferred Updates After Parallel Stage k
+	virtual
+	void
+	advance_QSS_deferred( int const k )
+	{ // Default implementation: Event queue update after the final stage
+		if ( k == order() ) event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Advance Incremental Sums
+	void
+	advance_sums()
+	{
+		if ( sums_.empty() ) return;
+		Value const q_0( q( tQ ) );
+		Value const q_1( q1( tQ ) );
+		Value const q_2( one_half * q2( tQ ) );
+		for ( auto & sum : sums_ ) {
+			sum.first->update( sum.second, tQ, q_0, q_1, q_2 );
+		}
+	}
+
+	// Advance the Incremental Sums of a Pass's Triggers: Each Sum's Terms in Index Order
+	//
+	// Sum updates don't commute in floating point so the order can't depend on the trigger order,
+	// which differs between the serial queue and a partitioned simulation's cluster queues
+	static
+	void
+	advance_sums( Variables const & triggers )
+	{
+		struct Term { Sum_LTI * sum; Sum_LTI::size_type i; Variable const * var; };
+		std::vector< Term > terms;
+		for ( Variable const * trigger : triggers ) {
+			for ( auto const & sum : trigger->sums_ ) {
+				terms.push_back( Term{ sum.first, sum.second, trigger } );
+			}
+		}
+		if ( terms.empty() ) return;
+		std::sort( terms.begin(), terms.end(), []( Term const & t1, Term const & t2 ){ return std::less< Sum_LTI * >()( t1.sum, t2.sum ) || ( ( t1.sum == t2.sum ) && ( t1.i < t2.i ) ); } );
+		for ( Term const & term : terms ) {
+			Variable const * var( term.var );
+			Time const tQ_( var->tQ );
+			term.sum->update( term.i, tQ_, var->q( tQ_ ), var->q1( tQ_ ), one_half * var->q2( tQ_ ) );
+		}
+	}
+
 	// Advance Observers
 	void
 	advance_observers()
 	{
-		for ( Variable * observer : observers_ ) {
-			observer->advance_observer( tQ );
+		advance_sums();
+		for ( auto const & b : batches_ ) b.first->add( b.second );
+		for ( auto const & b : batches_ ) b.first->evaluate( tQ );
+		if ( pool_ != nullptr ) {
+			advance_observers_parallel( *pool_, observers_, tQ );
+		} else {
+			for ( Variable * observer : observers_ ) {
+				observer->advance_observer( tQ );
+			}
 		}
+		for ( auto const & b : batches_ ) b.first->end();
+	}
+
+	// Advance Observers: Stage d
+	void
+	advance_observers_d() const
+	{
+		for ( Variable const * observer : observers_ ) {
+			observer->advance_observer_d();
+		}
+	}
+
+	// Open the Observer Derivative Batches of a Pass's Triggers and Evaluate their Observers at Time t
+	static
+	void
+	batch_begin( Variables const & triggers, Time const t )
+	{
+		bool batched( false );
+		for ( Variable const * trigger : triggers ) {
+			for ( auto const & b : trigger->batches_ ) {
+				b.first->add( b.second );
+				batched = true;
+			}
+		}
+		if ( ! batched ) return;
+		for ( Variable const * trigger : triggers ) {
+			for ( auto const & b : trigger->batches_ ) {
+				b.first->evaluate( t );
+			}
+		}
+	}
+
+	// Close the Observer Derivative Batches of a Pass's Triggers
+	static
+	void
+	batch_end( Variables const & triggers )
+	{
+		for ( Variable const * trigger : triggers ) {
+			for ( auto const & b : trigger->batches_ ) {
+				b.first->end();
+			}
+		}
+	}
+
+	// Advance Distinct Observers in Parallel on a Pool
+	//
+	// Observer trajectories depend only on their own state and the quantized representations,
+	// which observer advances don't change, so the concurrent observers' trajectory stages run
+	// on the pool and then the queue stages and the other observers' advances run in observer
+	// order: The queue sees the same operation sequence as the serial loop
+	static
+	void
+	advance_observers_parallel( ThreadPool & pool, Variables const & observers, Time const t )
+	{
+		size_type const grain( std::max( observers.size() / ( 4u * pool.size() ), size_type( 1u ) ) );
+		pool.parallel_for( observers.size(), [&observers,t]( size_type const i ){
+			Variable * observer( observers[ i ] );
+			if ( observer->is_concurrent() ) observer->advance_observer_1( t );
+		}, grain );
+		for ( Variable * observer : observers ) {
+			if ( observer->is_concurrent() ) {
+				observer->advance_observer_2();
+			} else {
+				observer->advance_observer( t );
+			}
+		}
+	}
+
+	// Observers of a Pass's Triggers Other than the Triggers Sorted by Order: Each Collected Once
+	//
+	// Observers are collected through a hash set so their order otherwise follows their addresses:
+	// Deterministic ordering takes them in order of first appearance and sorts stably instead
+	static
+	Variables
+	pass_observers( Variables const & triggers, bool const deterministic )
+	{
+		std::unordered_set< Variable * > const lookup( triggers.begin(), triggers.end() );
+		std::unordered_set< Variable * > observers_set;
+		Variables observers;
+		for ( Variable * trigger : triggers ) { // Collect observers to avoid duplicate advance calls
+			for ( Variable * observer : trigger->observers() ) {
+				if ( lookup.find( observer ) != lookup.end() ) continue; // Skip triggers
+				if ( observers_set.insert( observer ).second && deterministic ) observers.push_back( observer );
+			}
+		}
+		if ( deterministic ) {
+			std::stable_sort( observers.begin(), observers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort observers by order
+		} else {
+			observers.assign( observers_set.begin(), observers_set.end() );
+			std::sort( observers.begin(), observers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort observers by order
+		}
+		return observers;
 	}
 
 	// Observer Advance
@@ -490,6 +847,44 @@ public: // Methods
 		assert( false ); // Not a QSS or ZC variable
 	}
 
+	// Observer Advance: Stage 1: Trajectory and End Time
+	virtual
+	void
+	advance_observer_1( Time const )
+	{
+		assert( false ); // Not a concurrent observer
+	}
+
+	// Observer Advance: Stage 2: Event Queue
+	virtual
+	void
+	advance_observer_2()
+	{
+		assert( false ); // Not a concurrent observer
+	}
+
+	// Observer Advance: Stage d
+	void
+	advance_observer_d() const
+	{
+		print_d( ' ', tX );
+	}
+
+	// Advance: Stage d
+	void
+	advance_d( char const tag ) const
+	{
+		print_d( tag, tQ );
+	}
+
+	// Diagnostic Output: Tagged State at Time t
+	virtual
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << '\n';
+	}
+
 	// Zero-Crossing Advance
 	virtual
 	void
@@ -542,14 +937,40 @@ public: // Methods
 	void
 	shift_handler( Time const t, Value const val )
 	{
-		event_ = events.shift_handler( t, val, event_ );
+		event_ = events_->shift_handler( t, val, event_ );
 	}
 
 	// Shift Handler to Time Infinity
 	void
 	shift_handler()
 	{
-		event_ = events.shift_handler( event_ );
+		event_ = events_->shift_handler( event_ );
+	}
+
+	// Save Trajectory State for Rollback
+	virtual
+	void
+	save_state( State & state ) const
+	{
+		state.tQ = tQ;
+		state.tX = tX;
+		state.tE = tE;
+		state.dt_inf_rlx = dt_inf_rlx;
+		state.qTol = qTol;
+		state.sT = sT;
+	}
+
+	// Restore Saved Trajectory State: Event Queue Entry Restored Separately
+	virtual
+	void
+	restore_state( State const & state )
+	{
+		tQ = state.tQ;
+		tX = state.tX;
+		tE = state.tE;
+		dt_inf_rlx = state.dt_inf_rlx;
+		qTol = state.qTol;
+		sT = state.sT;
 	}
 
 protected: // Methods
@@ -603,11 +1024,18 @@ public: // Data
 	Time dt_inf_rlx{ infinity }; // Relaxed time step inf
 	SuperdenseTime sT; // Trigger superdense time
 	bool self_observer{ false }; // Variable appears in its function/derivative?
+	size_type stats_slot{ 0u }; // Per-variable statistics side array slot
 
 protected: // Data
 
 	Variables observers_; // Variables dependent on this one
+	ThreadPool * pool_{ nullptr }; // Parallel observer advance pool or nullptr
+	Sums sums_; // Incremental sums with a term for this Variable
+	Batches batches_; // Observer derivative batches with this Variable as a trigger
+	EventQ * events_{ &events }; // Event queue: The global queue outside simulations
 	EventQ::iterator event_; // Iterator to event queue entry
+	bool deferred_{ false }; // Registrations with observees deferred?
+	Registrations registrations_; // Deferred registrations with observees
 
 };
 
@@ -184,7 +184,6 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = static_cast< bool >( xIni );
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Initialization to a Value: Stage 0
@@ -194,7 +193,6 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = static_cast< bool >( x );
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Handler Advance
@@ -205,7 +203,6 @@ public: // Methods
 		tX = tQ = t;
 		x_ = static_cast< bool >( x );
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 		advance_observers();
 	}
 
@@ -217,7 +214,13 @@ public: // Methods
 		tX = tQ = t;
 		x_ = static_cast< bool >( x );
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << '\n';
 	}
 
 private: // Data
@@ -152,7 +152,6 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = xIni;
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Initialization to a Value: Stage 0
@@ -162,7 +161,6 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = x;
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Handler Advance
@@ -173,7 +171,6 @@ public: // Methods
 		tX = tQ = t;
 		x_ = x;
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 		advance_observers();
 	}
 
@@ -185,7 +182,13 @@ public: // Methods
 		tX = tQ = t;
 		x_ = x;
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << '\n';
 	}
 
 private: // Data
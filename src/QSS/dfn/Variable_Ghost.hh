@@ -0,0 +1,245 @@
+// QSS Ghost Variable
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_dfn_Variable_Ghost_hh_INCLUDED
+#define QSS_dfn_Variable_Ghost_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/Variable.hh>
+
+namespace QSS {
+namespace dfn {
+
+// QSS Ghost Variable: Copy of the Quantized Representation of a Variable in Another Cluster
+//
+// Derivatives in a cluster read ghosts instead of other clusters' variables so each cluster
+// touches only its own state: A ghost is updated from its source's requantization messages
+// and then advances its observers as its source would have
+class Variable_Ghost final : public Variable
+{
+
+public: // Types
+
+	using Super = Variable;
+
+public: // Creation
+
+	// Source + Cluster Constructor
+	Variable_Ghost(
+	 Variable const * source,
+	 size_type const cluster
+	) :
+	 Super( source->name ),
+	 source_( source ),
+	 cluster_( cluster ),
+	 order_( source->order() )
+	{
+		assert( ( 1 <= order_ ) && ( order_ <= 3 ) );
+		tE = infinity;
+		set_queue( source->queue() ); // Source's queue until its cluster schedules
+	}
+
+public: // Properties
+
+	// Source Variable
+	Variable const *
+	source() const
+	{
+		return source_;
+	}
+
+	// Cluster Index
+	size_type
+	cluster() const
+	{
+		return cluster_;
+	}
+
+	// Order of Method
+	int
+	order() const
+	{
+		return order_;
+	}
+
+	// Continuous Value at Time t
+	Value
+	x( Time const t ) const
+	{
+		return q( t );
+	}
+
+	// Continuous First Derivative at Time t
+	Value
+	x1( Time const t ) const
+	{
+		return q1( t );
+	}
+
+	// Continuous Second Derivative at Time t
+	Value
+	x2( Time const t ) const
+	{
+		return q2( t );
+	}
+
+	// Quantized Value at Time t: Same Forms as the Source Variables
+	Value
+	q( Time const t ) const
+	{
+		if ( order_ == 1 ) {
+			return q_0_;
+		} else if ( order_ == 2 ) {
+			return q_0_ + ( q_1_ * ( t - tQ ) );
+		} else {
+			Time const tDel( t - tQ );
+			return q_0_ + ( ( q_1_ + ( q_2_ * tDel ) ) * tDel );
+		}
+	}
+
+	// Quantized First Derivative at Time t
+	Value
+	q1( Time const t ) const
+	{
+		if ( order_ == 1 ) {
+			return 0.0;
+		} else if ( order_ == 2 ) {
+			return q_1_;
+		} else {
+			return q_1_ + ( two * q_2_ * ( t - tQ ) );
+		}
+	}
+
+	// Quantized Second Derivative at Time t
+	Value
+	q2( Time const ) const
+	{
+		return ( order_ == 3 ? two * q_2_ : 0.0 );
+	}
+
+	// Simultaneous Value at Time t: Never a Trigger in its Cluster's Passes
+	Value
+	s( Time const t ) const
+	{
+		return q( t );
+	}
+
+	// Simultaneous Numeric Differentiation Value at Time t
+	Value
+	sn( Time const t ) const
+	{
+		return q( t );
+	}
+
+	// Simultaneous First Derivative at Time t
+	Value
+	s1( Time const t ) const
+	{
+		return q1( t );
+	}
+
+	// Simultaneous Second Derivative at Time t
+	Value
+	s2( Time const t ) const
+	{
+		return q2( t );
+	}
+
+public: // Methods
+
+	// Update to a Quantized Representation
+	void
+	update(
+	 Time const t,
+	 Value const q_0,
+	 Value const q_1,
+	 Value const q_2
+	)
+	{
+		tQ = tX = t;
+		q_0_ = q_0;
+		q_1_ = q_1;
+		q_2_ = q_2;
+	}
+
+	// Update from the Source Variable: Initialization Stages and Merged Passes
+	void
+	refresh()
+	{
+		Time const t( source_->tQ );
+		update( t, source_->q( t ), source_->q1( t ), one_half * source_->q2( t ) );
+	}
+
+	// Update from the Source Variable's Simultaneous Representation: Between a Merged Pass's Stages
+	void
+	refresh_simultaneous( Time const t )
+	{
+		update( t, source_->s( t ), source_->s1( t ), one_half * source_->s2( t ) );
+	}
+
+	// Save Trajectory State for Rollback
+	void
+	save_state( State & state ) const
+	{
+		Super::save_state( state );
+		state.c[ 0 ] = q_0_;
+		state.c[ 1 ] = q_1_;
+		state.c[ 2 ] = q_2_;
+	}
+
+	// Restore Saved Trajectory State
+	void
+	restore_state( State const & state )
+	{
+		Super::restore_state( state );
+		q_0_ = state.c[ 0 ];
+		q_1_ = state.c[ 1 ];
+		q_2_ = state.c[ 2 ];
+	}
+
+private: // Data
+
+	Variable const * source_{ nullptr }; // Source variable
+	size_type cluster_{ 0u }; // Cluster index
+	int order_{ 1 }; // Order of the source's method
+	Value q_0_{ 0.0 }, q_1_{ 0.0 }, q_2_{ 0.0 }; // Quantized rep coefficients
+
+};
+
+} // dfn
+} // QSS
+
+#endif
@@ -170,7 +170,6 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = static_cast< Integer >( xIni );
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Initialization to a Value: Stage 0
@@ -180,7 +179,6 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = static_cast< Integer >( x );
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Handler Advance
@@ -191,7 +189,6 @@ public: // Methods
 		tX = tQ = t;
 		x_ = static_cast< Integer >( x );
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 		advance_observers();
 	}
 
@@ -203,7 +200,13 @@ public: // Methods
 		tX = tQ = t;
 		x_ = static_cast< Integer >( x );
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << '\n';
 	}
 
 private: // Data
@@ -72,6 +72,7 @@ public: // Types
 
 private: // Types
 
+	using Super::events_;
 	using Super::f_;
 
 public: // Creation
@@ -156,8 +157,7 @@ public: // Methods
 		x_1_ = f_.df1( tQ );
 		set_tE();
 		tD = f_.tD( tQ );
-		event( tE < tD ? events.add_QSS( tE, this ) : events.add_discrete( tD, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->add_QSS( tE, this ) : events_->add_discrete( tD, this ) );
 	}
 
 	// Set Current Tolerance
@@ -177,8 +177,7 @@ public: // Methods
 		x_1_ = f_.df1( tD );
 		set_tE();
 		tD = f_.tD( tD );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 		advance_observers();
 	}
 
@@ -191,8 +190,7 @@ public: // Methods
 		x_1_ = f_.df1( tD );
 		set_tE();
 		tD = f_.tD( tD );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 	}
 
 	// QSS Advance
@@ -204,8 +202,7 @@ public: // Methods
 		x_1_ = f_.df1( tE );
 		set_tE();
 		tD = f_.tD( tQ );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 		advance_observers();
 	}
 
@@ -224,8 +221,14 @@ public: // Methods
 		x_1_ = f_.df1( tE );
 		set_tE();
 		tD = f_.tD( tQ );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
 	}
 
 private: // Methods
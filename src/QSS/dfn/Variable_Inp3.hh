@@ -72,6 +72,7 @@ public: // Types
 
 private: // Types
 
+	using Super::events_;
 	using Super::f_;
 
 public: // Creation
@@ -219,8 +220,7 @@ public: // Methods
 		x_3_ = one_sixth * f_.dc3( tQ );
 		set_tE();
 		tD = f_.tD( tQ );
-		event( tE < tD ? events.add_QSS( tE, this ) : events.add_discrete( tD, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->add_QSS( tE, this ) : events_->add_discrete( tD, this ) );
 	}
 
 	// Set Current Tolerance
@@ -241,8 +241,7 @@ public: // Methods
 		x_2_ = q_2_ = one_half * f_.dc2( tD );
 		set_tE();
 		tD = f_.tD( tD );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 		advance_observers();
 	}
 
@@ -269,8 +268,7 @@ public: // Methods
 		x_3_ = one_sixth * f_.dc3( tD );
 		set_tE();
 		tD = f_.tD( tD );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 	}
 
 	// QSS Advance
@@ -284,8 +282,7 @@ public: // Methods
 		x_3_ = one_sixth * f_.dc3( tX = tE );
 		set_tE();
 		tD = f_.tD( tQ );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 		advance_observers();
 	}
 
@@ -318,8 +315,14 @@ public: // Methods
 		x_3_ = one_sixth * f_.dc3( tE );
 		set_tE();
 		tD = f_.tD( tQ );
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << "   tD=" << tD << '\n';
 	}
 
 private: // Methods
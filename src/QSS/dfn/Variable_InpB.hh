@@ -68,6 +68,7 @@ public: // Types
 
 private: // Types
 
+	using Super::events_;
 	using Super::f_;
 
 public: // Creation
@@ -189,8 +190,7 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = static_cast< bool >( f_.vs( tQ ) );
 		tD = f_.tD( tQ );
-		event( events.add_discrete( tD, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->add_discrete( tD, this ) );
 	}
 
 	// Discrete Advance
@@ -199,8 +199,7 @@ public: // Methods
 	{
 		x_ = static_cast< bool >( f_.vs( tX = tQ = tD ) );
 		tD = f_.tD( tQ );
-		event( events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->shift_discrete( tD, event() ) );
 		advance_observers();
 	}
 
@@ -210,8 +209,14 @@ public: // Methods
 	{
 		x_ = static_cast< bool >( f_.vs( tX = tQ = tD ) );
 		tD = f_.tD( tD );
-		event( events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->shift_discrete( tD, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << "   tD=" << tD << '\n';
 	}
 
 private: // Data
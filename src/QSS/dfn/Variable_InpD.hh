@@ -64,6 +64,7 @@ public: // Types
 
 private: // Types
 
+	using Super::events_;
 	using Super::f_;
 
 public: // Creation
@@ -157,8 +158,7 @@ public: // Methods
 		shrink_observers(); // Optional
 		x_ = f_.vs( tQ );
 		tD = f_.tD( tQ );
-		event( events.add_discrete( tD, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->add_discrete( tD, this ) );
 	}
 
 	// Discrete Advance
@@ -167,8 +167,7 @@ public: // Methods
 	{
 		x_ = f_.vs( tX = tQ = tD );
 		tD = f_.tD( tD );
-		event( events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->shift_discrete( tD, event() ) );
 		advance_observers();
 	}
 
@@ -178,8 +177,14 @@ public: // Methods
 	{
 		x_ = f_.vs( tX = tQ = tD );
 		tD = f_.tD( tD );
-		event( events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->shift_discrete( tD, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << "   tD=" << tD << '\n';
 	}
 
 private: // Data
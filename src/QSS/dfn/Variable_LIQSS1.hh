@@ -52,6 +52,7 @@ public: // Types
 	using Super = Variable_QSS< F >;
 	using Time = Variable::Time;
 	using Value = Variable::Value;
+	using State = Variable::State;
 	using AdvanceSpecs_LIQSS1 = typename Variable::AdvanceSpecs_LIQSS1;
 
 	using Super::name;
@@ -78,6 +79,7 @@ private: // Types
 
 	using Super::d_;
 	using Super::event_;
+	using Super::events_;
 	using Super::observers_;
 
 public: // Creation
@@ -132,14 +134,14 @@ public: // Properties
 	Value
 	s( Time const ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ : q_0_ );
+		return ( sT == events_->active_superdense_time() ? q_c_ : q_0_ );
 	}
 
 	// Simultaneous Numeric Differentiation Value at Time t
 	Value
 	sn( Time const t ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ : q_0_ );
+		return ( sT == events_->active_superdense_time() ? q_c_ : q_0_ );
 	}
 
 public: // Methods
@@ -179,6 +181,14 @@ public: // Methods
 	// Initialization: Stage 1
 	void
 	init_1()
+	{
+		init_1_deferred();
+		event( events_->add_QSS( tE, this ) );
+	}
+
+	// Initialization: Parallel Stage 1: Event Queue Insertion Deferred
+	void
+	init_1_deferred()
 	{
 		self_observer = d_.finalize( this );
 		shrink_observers(); // Optional
@@ -189,8 +199,6 @@ public: // Methods
 			q_0_ += signum( x_1_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 	// Set Current Tolerance
@@ -214,8 +222,7 @@ public: // Methods
 			q_0_ += signum( x_1_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -231,6 +238,14 @@ public: // Methods
 	// QSS Advance: Stage 1
 	void
 	advance_QSS_1()
+	{
+		advance_QSS_1_deferred();
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 1: Event Queue Update Deferred
+	void
+	advance_QSS_1_deferred()
 	{
 		if ( self_observer ) {
 			advance_s( tE ); // Simultaneous reps used to avoid cyclic dependency
@@ -239,20 +254,31 @@ public: // Methods
 			q_0_ += signum( x_1_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 	// Observer Advance
 	void
 	advance_observer( Time const t )
+	{
+		advance_observer_1( t );
+		advance_observer_2();
+	}
+
+	// Observer Advance: Stage 1
+	void
+	advance_observer_1( Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
 		x_1_ = d_.q( tX = t );
 		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+	}
+
+	// Observer Advance: Stage 2
+	void
+	advance_observer_2()
+	{
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance
@@ -264,8 +290,7 @@ public: // Methods
 		set_qTol();
 		x_1_ = d_.q( tX = tQ = t );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -285,8 +310,36 @@ public: // Methods
 	{
 		x_1_ = d_.q( tQ );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Save Trajectory State for Rollback
+	void
+	save_state( State & state ) const
+	{
+		Super::save_state( state );
+		state.c[ 0 ] = x_0_;
+		state.c[ 1 ] = x_1_;
+		state.c[ 2 ] = q_c_;
+		state.c[ 3 ] = q_0_;
+	}
+
+	// Restore Saved Trajectory State
+	void
+	restore_state( State const & state )
+	{
+		Super::restore_state( state );
+		x_0_ = state.c[ 0 ];
+		x_1_ = state.c[ 1 ];
+		q_c_ = state.c[ 2 ];
+		q_0_ = state.c[ 3 ];
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
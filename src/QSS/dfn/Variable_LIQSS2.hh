@@ -52,6 +52,7 @@ public: // Types
 	using Super = Variable_QSS< F >;
 	using Time = Variable::Time;
 	using Value = Variable::Value;
+	using State = Variable::State;
 	using AdvanceSpecs_LIQSS2 = typename Variable::AdvanceSpecs_LIQSS2;
 
 	using Super::name;
@@ -78,6 +79,7 @@ private: // Types
 
 	using Super::d_;
 	using Super::event_;
+	using Super::events_;
 	using Super::observers_;
 
 public: // Creation
@@ -147,21 +149,21 @@ public: // Properties
 	Value
 	s( Time const t ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ : q_0_ + ( q_1_ * ( t - tQ ) ) );
+		return ( sT == events_->active_superdense_time() ? q_c_ : q_0_ + ( q_1_ * ( t - tQ ) ) );
 	}
 
 	// Simultaneous Numeric Differentiation Value at Time t
 	Value
 	sn( Time const t ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ + ( s_1_ * ( t - tQ ) ) : q_0_ + ( q_1_ * ( t - tQ ) ) );
+		return ( sT == events_->active_superdense_time() ? q_c_ + ( s_1_ * ( t - tQ ) ) : q_0_ + ( q_1_ * ( t - tQ ) ) );
 	}
 
 	// Simultaneous First Derivative at Time t
 	Value
 	s1( Time const ) const
 	{
-		return ( sT == events.active_superdense_time() ? s_1_ : q_1_ );
+		return ( sT == events_->active_superdense_time() ? s_1_ : q_1_ );
 	}
 
 public: // Methods
@@ -203,15 +205,31 @@ public: // Methods
 	// Initialization: Stage 1
 	void
 	init_1()
+	{
+		init_1_deferred();
+		q_1_ = s_1_ = x_1_;
+	}
+
+	// Initialization: Parallel Stage 1: Quantized Coefficient Update Deferred
+	void
+	init_1_deferred()
 	{
 		self_observer = d_.finalize( this );
 		shrink_observers(); // Optional
-		x_1_ = q_1_ = s_1_ = d_.s( tQ ); // Simultaneous reps used to avoid cyclic dependency
+		x_1_ = d_.s( tQ ); // Simultaneous reps used to avoid cyclic dependency
 	}
 
 	// Initialization: Stage 2
 	void
 	init_2()
+	{
+		init_2_deferred();
+		event( events_->add_QSS( tE, this ) );
+	}
+
+	// Initialization: Parallel Stage 2: Event Queue Insertion Deferred
+	void
+	init_2_deferred()
 	{
 		if ( self_observer ) {
 			advance_s( tQ ); // Simultaneous reps used to avoid cyclic dependency
@@ -220,8 +238,13 @@ public: // Methods
 			q_0_ += signum( x_2_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// Initialization: Deferred Updates After Parallel Stage k
+	void
+	init_deferred( int const k )
+	{
+		if ( k == 1 ) q_1_ = s_1_ = x_1_;
 	}
 
 	// Set Current Tolerance
@@ -247,8 +270,7 @@ public: // Methods
 			q_0_ += signum( x_2_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -266,12 +288,21 @@ public: // Methods
 	void
 	advance_QSS_1()
 	{
-		x_1_ = q_1_ = s_1_ = d_.s( tE ); // Simultaneous reps used to avoid cyclic dependency
+		advance_QSS_1_deferred();
+		q_1_ = s_1_ = x_1_;
 	}
 
 	// QSS Advance: Stage 2
 	void
 	advance_QSS_2()
+	{
+		advance_QSS_2_deferred();
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 2: Event Queue Update Deferred
+	void
+	advance_QSS_2_deferred()
 	{
 		if ( self_observer ) {
 			advance_s( tE ); // Simultaneous reps used to avoid cyclic dependency
@@ -280,13 +311,38 @@ public: // Methods
 			q_0_ += signum( x_2_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// QSS Advance: Parallel Stage 1: Quantized Coefficient Update Deferred
+	void
+	advance_QSS_1_deferred()
+	{
+		x_1_ = d_.s( tE ); // Simultaneous reps used to avoid cyclic dependency
+	}
+
+	// QSS Advance: Deferred Updates After Parallel Stage k
+	void
+	advance_QSS_deferred( int const k )
+	{
+		if ( k == 1 ) {
+			q_1_ = s_1_ = x_1_;
+		} else {
+			assert( k == 2 );
+			event( events_->shift_QSS( tE, event() ) );
+		}
 	}
 
 	// Observer Advance
 	void
 	advance_observer( Time const t )
+	{
+		advance_observer_1( t );
+		advance_observer_2();
+	}
+
+	// Observer Advance: Stage 1
+	void
+	advance_observer_1( Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		Time const tDel( t - tX );
@@ -294,8 +350,13 @@ public: // Methods
 		x_1_ = d_.qs( t );
 		x_2_ = one_half * d_.qf1( tX = t );
 		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// Observer Advance: Stage 2
+	void
+	advance_observer_2()
+	{
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance
@@ -308,8 +369,7 @@ public: // Methods
 		x_1_ = q_1_ = s_1_ = d_.qs( tX = tQ = t );
 		x_2_ = one_half * d_.qf1( t );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -336,8 +396,42 @@ public: // Methods
 	{
 		x_2_ = one_half * d_.qf1( tQ );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Save Trajectory State for Rollback
+	void
+	save_state( State & state ) const
+	{
+		Super::save_state( state );
+		state.c[ 0 ] = x_0_;
+		state.c[ 1 ] = x_1_;
+		state.c[ 2 ] = x_2_;
+		state.c[ 3 ] = q_c_;
+		state.c[ 4 ] = q_0_;
+		state.c[ 5 ] = q_1_;
+		state.c[ 6 ] = s_1_;
+	}
+
+	// Restore Saved Trajectory State
+	void
+	restore_state( State const & state )
+	{
+		Super::restore_state( state );
+		x_0_ = state.c[ 0 ];
+		x_1_ = state.c[ 1 ];
+		x_2_ = state.c[ 2 ];
+		q_c_ = state.c[ 3 ];
+		q_0_ = state.c[ 4 ];
+		q_1_ = state.c[ 5 ];
+		s_1_ = state.c[ 6 ];
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
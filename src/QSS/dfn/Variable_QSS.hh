@@ -100,6 +100,13 @@ public: // Predicate
 		return true;
 	}
 
+	// Advances Can Run Concurrently with Other Variables' Advances of the Same Stage?
+	bool
+	is_concurrent() const
+	{
+		return concurrent< Derivative >( 0 );
+	}
+
 public: // Properties
 
 	// Derivative Function
@@ -116,6 +123,28 @@ public: // Properties
 		return d_;
 	}
 
+private: // Static Methods
+
+	// Derivative Safe to Evaluate Concurrently with Other Derivatives? Per its concurrent Constant
+	template< typename D >
+	static
+	constexpr
+	auto
+	concurrent( int ) -> decltype( bool( D::concurrent ) )
+	{
+		return D::concurrent;
+	}
+
+	// Derivative Safe to Evaluate Concurrently with Other Derivatives? Default Without a concurrent Constant
+	template< typename D >
+	static
+	constexpr
+	bool
+	concurrent( long )
+	{
+		return true;
+	}
+
 protected: // Data
 
 	Derivative d_; // Derivative function
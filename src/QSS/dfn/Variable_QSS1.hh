@@ -52,6 +52,7 @@ public: // Types
 	using Super = Variable_QSS< F >;
 	using Time = Variable::Time;
 	using Value = Variable::Value;
+	using State = Variable::State;
 
 	using Super::name;
 	using Super::rTol;
@@ -76,6 +77,7 @@ private: // Types
 
 	using Super::d_;
 	using Super::event_;
+	using Super::events_;
 	using Super::observers_;
 
 public: // Creation
@@ -176,13 +178,19 @@ public: // Methods
 	// Initialization: Stage 1
 	void
 	init_1()
+	{
+		init_1_deferred();
+		event( events_->add_QSS( tE, this ) );
+	}
+
+	// Initialization: Parallel Stage 1: Event Queue Insertion Deferred
+	void
+	init_1_deferred()
 	{
 		self_observer = d_.finalize( this );
 		shrink_observers(); // Optional
 		x_1_ = d_.s( tQ );
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 	// Set Current Tolerance
@@ -201,8 +209,7 @@ public: // Methods
 		set_qTol();
 		x_1_ = d_.q( tX = tE );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -218,23 +225,42 @@ public: // Methods
 	// QSS Advance: Stage 1
 	void
 	advance_QSS_1()
+	{
+		advance_QSS_1_deferred();
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 1: Event Queue Update Deferred
+	void
+	advance_QSS_1_deferred()
 	{
 		x_1_ = d_.s( tE );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 	// Observer Advance
 	void
 	advance_observer( Time const t )
+	{
+		advance_observer_1( t );
+		advance_observer_2();
+	}
+
+	// Observer Advance: Stage 1
+	void
+	advance_observer_1( Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
 		x_1_ = d_.q( tX = t );
 		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+	}
+
+	// Observer Advance: Stage 2
+	void
+	advance_observer_2()
+	{
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance
@@ -247,8 +273,7 @@ public: // Methods
 		set_qTol();
 		x_1_ = d_.q( t );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -268,8 +293,34 @@ public: // Methods
 	{
 		x_1_ = d_.q( tQ );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Save Trajectory State for Rollback
+	void
+	save_state( State & state ) const
+	{
+		Super::save_state( state );
+		state.c[ 0 ] = x_0_;
+		state.c[ 1 ] = x_1_;
+		state.c[ 2 ] = q_0_;
+	}
+
+	// Restore Saved Trajectory State
+	void
+	restore_state( State const & state )
+	{
+		Super::restore_state( state );
+		x_0_ = state.c[ 0 ];
+		x_1_ = state.c[ 1 ];
+		q_0_ = state.c[ 2 ];
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
@@ -52,6 +52,7 @@ public: // Types
 	using Super = Variable_QSS< F >;
 	using Time = Variable::Time;
 	using Value = Variable::Value;
+	using State = Variable::State;
 
 	using Super::name;
 	using Super::rTol;
@@ -76,6 +77,7 @@ private: // Types
 
 	using Super::d_;
 	using Super::event_;
+	using Super::events_;
 	using Super::observers_;
 
 public: // Creation
@@ -200,20 +202,41 @@ public: // Methods
 	// Initialization: Stage 1
 	void
 	init_1()
+	{
+		init_1_deferred();
+		q_1_ = x_1_;
+	}
+
+	// Initialization: Parallel Stage 1: Quantized Coefficient Update Deferred
+	void
+	init_1_deferred()
 	{
 		self_observer = d_.finalize( this );
 		shrink_observers(); // Optional
-		x_1_ = q_1_ = d_.ss( tQ );
+		x_1_ = d_.ss( tQ );
 	}
 
 	// Initialization: Stage 2
 	void
 	init_2()
+	{
+		init_2_deferred();
+		event( events_->add_QSS( tE, this ) );
+	}
+
+	// Initialization: Parallel Stage 2: Event Queue Insertion Deferred
+	void
+	init_2_deferred()
 	{
 		x_2_ = one_half * d_.sf1( tQ );
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// Initialization: Deferred Updates After Parallel Stage k
+	void
+	init_deferred( int const k )
+	{
+		if ( k == 1 ) q_1_ = x_1_;
 	}
 
 	// Set Current Tolerance
@@ -234,8 +257,7 @@ public: // Methods
 		x_1_ = q_1_ = d_.qs( tE );
 		x_2_ = one_half * d_.qf1( tX = tE );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -256,19 +278,52 @@ public: // Methods
 		x_1_ = q_1_ = d_.ss( tE );
 	}
 
+	// QSS Advance: Parallel Stage 1: Quantized Coefficient Update Deferred
+	void
+	advance_QSS_1_deferred()
+	{
+		x_1_ = d_.ss( tE );
+	}
+
 	// QSS Advance: Stage 2
 	void
 	advance_QSS_2()
+	{
+		advance_QSS_2_deferred();
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 2: Event Queue Update Deferred
+	void
+	advance_QSS_2_deferred()
 	{
 		x_2_ = one_half * d_.sf1( tE );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// QSS Advance: Deferred Updates After Parallel Stage k
+	void
+	advance_QSS_deferred( int const k )
+	{
+		if ( k == 1 ) {
+			q_1_ = x_1_;
+		} else {
+			assert( k == 2 );
+			event( events_->shift_QSS( tE, event() ) );
+		}
 	}
 
 	// Observer Advance
 	void
 	advance_observer( Time const t )
+	{
+		advance_observer_1( t );
+		advance_observer_2();
+	}
+
+	// Observer Advance: Stage 1
+	void
+	advance_observer_1( Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		Time const tDel( t - tX );
@@ -276,8 +331,13 @@ public: // Methods
 		x_1_ = d_.qs( t );
 		x_2_ = one_half * d_.qf1( tX = t );
 		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// Observer Advance: Stage 2
+	void
+	advance_observer_2()
+	{
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance
@@ -291,8 +351,7 @@ public: // Methods
 		x_1_ = q_1_ = d_.qs( t );
 		x_2_ = one_half * d_.qf1( t );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -319,8 +378,38 @@ public: // Methods
 	{
 		x_2_ = one_half * d_.qf1( tQ );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Save Trajectory State for Rollback
+	void
+	save_state( State & state ) const
+	{
+		Super::save_state( state );
+		state.c[ 0 ] = x_0_;
+		state.c[ 1 ] = x_1_;
+		state.c[ 2 ] = x_2_;
+		state.c[ 3 ] = q_0_;
+		state.c[ 4 ] = q_1_;
+	}
+
+	// Restore Saved Trajectory State
+	void
+	restore_state( State const & state )
+	{
+		Super::restore_state( state );
+		x_0_ = state.c[ 0 ];
+		x_1_ = state.c[ 1 ];
+		x_2_ = state.c[ 2 ];
+		q_0_ = state.c[ 3 ];
+		q_1_ = state.c[ 4 ];
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
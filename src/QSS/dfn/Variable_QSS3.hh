@@ -52,6 +52,7 @@ public: // Types
 	using Super = Variable_QSS< F >;
 	using Time = Variable::Time;
 	using Value = Variable::Value;
+	using State = Variable::State;
 
 	using Super::name;
 	using Super::rTol;
@@ -76,6 +77,7 @@ private: // Types
 
 	using Super::d_;
 	using Super::event_;
+	using Super::events_;
 	using Super::observers_;
 
 public: // Creation
@@ -228,26 +230,59 @@ public: // Methods
 	void
 	init_1()
 	{
-		self_observer = d_.finalize( this );
-		shrink_observers(); // Optional
-		x_1_ = q_1_ = d_.s( tQ );
+		init_1_deferred();
+		q_1_ = x_1_;
 	}
 
 	// Initialization: Stage 2
 	void
 	init_2()
 	{
-		x_2_ = q_2_ = one_half * d_.s1( tQ );
+		init_2_deferred();
+		q_2_ = x_2_;
 	}
 
 	// Initialization: Stage 3
 	void
 	init_3()
+	{
+		init_3_deferred();
+		event( events_->add_QSS( tE, this ) );
+	}
+
+	// Initialization: Parallel Stage 1: Quantized Coefficient Update Deferred
+	void
+	init_1_deferred()
+	{
+		self_observer = d_.finalize( this );
+		shrink_observers(); // Optional
+		x_1_ = d_.s( tQ );
+	}
+
+	// Initialization: Parallel Stage 2: Quantized Coefficient Update Deferred
+	void
+	init_2_deferred()
+	{
+		x_2_ = one_half * d_.s1( tQ );
+	}
+
+	// Initialization: Parallel Stage 3: Event Queue Insertion Deferred
+	void
+	init_3_deferred()
 	{
 		x_3_ = one_sixth * d_.s2( tQ );
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
+	}
+
+	// Initialization: Deferred Updates After Parallel Stage k
+	void
+	init_deferred( int const k )
+	{
+		if ( k == 1 ) {
+			q_1_ = x_1_;
+		} else if ( k == 2 ) {
+			q_2_ = x_2_;
+		}
 	}
 
 	// Set Current Tolerance
@@ -269,8 +304,7 @@ public: // Methods
 		x_2_ = q_2_ = one_half * d_.qc1( tE );
 		x_3_ = one_sixth * d_.qc2( tX = tE );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -298,19 +332,61 @@ public: // Methods
 		x_2_ = q_2_ = one_half * d_.sc1( tE );
 	}
 
+	// QSS Advance: Parallel Stage 1: Quantized Coefficient Update Deferred
+	void
+	advance_QSS_1_deferred()
+	{
+		x_1_ = d_.ss( tE );
+	}
+
+	// QSS Advance: Parallel Stage 2: Quantized Coefficient Update Deferred
+	void
+	advance_QSS_2_deferred()
+	{
+		x_2_ = one_half * d_.sc1( tE );
+	}
+
 	// QSS Advance: Stage 3
 	void
 	advance_QSS_3()
+	{
+		advance_QSS_3_deferred();
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 3: Event Queue Update Deferred
+	void
+	advance_QSS_3_deferred()
 	{
 		x_3_ = one_sixth * d_.sc2( tE );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
+	}
+
+	// QSS Advance: Deferred Updates After Parallel Stage k
+	void
+	advance_QSS_deferred( int const k )
+	{
+		if ( k == 1 ) {
+			q_1_ = x_1_;
+		} else if ( k == 2 ) {
+			q_2_ = x_2_;
+		} else {
+			assert( k == 3 );
+			event( events_->shift_QSS( tE, event() ) );
+		}
 	}
 
 	// Observer Advance
 	void
 	advance_observer( Time const t )
+	{
+		advance_observer_1( t );
+		advance_observer_2();
+	}
+
+	// Observer Advance: Stage 1
+	void
+	advance_observer_1( Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		Time const tDel( t - tX );
@@ -319,8 +395,13 @@ public: // Methods
 		x_2_ = one_half * d_.qc1( t );
 		x_3_ = one_sixth * d_.qc2( tX = t );
 		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
+	}
+
+	// Observer Advance: Stage 2
+	void
+	advance_observer_2()
+	{
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance
@@ -335,8 +416,7 @@ public: // Methods
 		x_2_ = q_2_ = one_half * d_.qc1( t );
 		x_3_ = one_sixth * d_.qc2( t );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
 		advance_observers();
 	}
 
@@ -370,8 +450,42 @@ public: // Methods
 	{
 		x_3_ = one_sixth * d_.qc2( tQ );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Save Trajectory State for Rollback
+	void
+	save_state( State & state ) const
+	{
+		Super::save_state( state );
+		state.c[ 0 ] = x_0_;
+		state.c[ 1 ] = x_1_;
+		state.c[ 2 ] = x_2_;
+		state.c[ 3 ] = x_3_;
+		state.c[ 4 ] = q_0_;
+		state.c[ 5 ] = q_1_;
+		state.c[ 6 ] = q_2_;
+	}
+
+	// Restore Saved Trajectory State
+	void
+	restore_state( State const & state )
+	{
+		Super::restore_state( state );
+		x_0_ = state.c[ 0 ];
+		x_1_ = state.c[ 1 ];
+		x_2_ = state.c[ 2 ];
+		x_3_ = state.c[ 3 ];
+		q_0_ = state.c[ 4 ];
+		q_1_ = state.c[ 5 ];
+		q_2_ = state.c[ 6 ];
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
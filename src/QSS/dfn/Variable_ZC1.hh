@@ -83,6 +83,7 @@ protected: // Types
 private: // Types
 
 	using Super::event_;
+	using Super::events_;
 	using Super::f_;
 	using Super::observers_;
 
@@ -153,8 +154,7 @@ public: // Methods
 		x_1_ = f_.q1( tQ );
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.add_QSS( tE, this ) : events.add_ZC( tZ, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->add_QSS( tE, this ) : events_->add_ZC( tZ, this ) );
 	}
 
 	// Set Current Tolerance
@@ -170,7 +170,6 @@ public: // Methods
 	advance_QSS()
 	{
 		advance_QSS_core();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
 	}
 
 	// QSS Advance: Simultaneous
@@ -178,7 +177,6 @@ public: // Methods
 	advance_QSS_simultaneous()
 	{
 		advance_QSS_core();
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
 	}
 
 	// Observer Advance
@@ -193,7 +191,6 @@ public: // Methods
 		x_1_ = f_.q1( t );
 		set_tE();
 		crossing_detect( sign_old, signum( x_0_ ) );
-		if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ <<  '\n';
 	}
 
 	// Zero-Crossing Advance
@@ -201,9 +198,15 @@ public: // Methods
 	advance_ZC()
 	{
 		h_( tZ, crossing ); // Handler
-		if ( options::output::d ) std::cout << "Z " << name << '(' << tZ << ')' << '\n';
 		set_tZ( tZ_prev = tZ ); // Next zero-crossing: Might be in active segment
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
 	}
 
 private: // Methods
@@ -217,7 +220,7 @@ private: // Methods
 		x_1_ = f_.q1( tE );
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 	}
 
 	// Set End Time
@@ -292,14 +295,14 @@ private: // Methods
 			if ( has( crossing_check ) ) { // Crossing type is relevant
 				crossing = crossing_check;
 				tZ = tX;
-				event( events.shift_ZC( tZ, event() ) );
+				event( events_->shift_ZC( tZ, event() ) );
 			} else {
 				set_tZ();
-				event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+				event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 			}
 		} else {
 			set_tZ();
-			event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+			event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 		}
 	}
 
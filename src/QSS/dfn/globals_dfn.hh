@@ -44,7 +44,7 @@ namespace QSS {
 namespace dfn {
 
 // QSS Globals
-extern EventQueue< Variable > events;
+extern EventQueue< Variable > events; // Queue of variables outside simulations: Simulators and clusters give their variables their own queues
 
 } // dfn
 } // QSS
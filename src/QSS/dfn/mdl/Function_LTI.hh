@@ -37,7 +37,9 @@
 #define QSS_dfn_mdl_Function_LTI_hh_INCLUDED
 
 // QSS Headers
+#include <QSS/dfn/Sum_LTI.hh>
 #include <QSS/math.hh>
+#include <QSS/options.hh>
 
 // C++ Headers
 //#include <algorithm> // std::stable_sort
@@ -140,6 +142,7 @@ public: // Properties
 	q( Time const t ) const
 	{
 		assert( c_.size() == x_.size() );
+		if ( gathered_ ) return c0_ + sum_q( t ) + ( cv_ == 0.0 ? 0.0 : cv_ * xv_->q( t ) );
 		Value v( c0_ );
 		for ( size_type i = 0, n = c_.size(); i < n; ++i ) {
 			v += c_[ i ] * x_[ i ]->q( t );
@@ -152,6 +155,7 @@ public: // Properties
 	q1( Time const t ) const
 	{
 		assert( c_.size() == x_.size() );
+		if ( gathered_ ) return sum_q1( t ) + ( cv_ == 0.0 ? 0.0 : cv_ * xv_->q1( t ) );
 		Value s( 0.0 );
 		for ( size_type i = iBeg[ 2 ], n = c_.size(); i < n; ++i ) {
 			s += c_[ i ] * x_[ i ]->q1( t );
@@ -164,6 +168,7 @@ public: // Properties
 	q2( Time const t ) const
 	{
 		assert( c_.size() == x_.size() );
+		if ( gathered_ ) return sum_q2( t ) + ( cv_ == 0.0 ? 0.0 : cv_ * xv_->q2( t ) );
 		Value c( 0.0 );
 		for ( size_type i = iBeg[ 3 ], n = c_.size(); i < n; ++i ) {
 			c += c_[ i ] * x_[ i ]->q2( t );
@@ -293,8 +298,12 @@ public: // Properties
 
 		// Value at +/- del
 		Value v( c0_ );
-		for ( size_type i = 0, n = co_.size(); i < n; ++i ) {
-			v += co_[ i ] * xo_[ i ]->q( t );
+		if ( gathered_ ) {
+			v += sum_q( t );
+		} else {
+			for ( size_type i = 0, n = co_.size(); i < n; ++i ) {
+				v += co_[ i ] * xo_[ i ]->q( t );
+			}
 		}
 		Value const vc( cv_ == 0.0 ? v : v + ( cv_ * xv_->q( t ) ) );
 		Value const cv_del( cv_ * del );
@@ -369,8 +378,12 @@ public: // Properties
 
 		// Value at +/- del
 		Value v( c0_ );
-		for ( size_type i = 0, n = co_.size(); i < n; ++i ) {
-			v += co_[ i ] * xo_[ i ]->q( t );
+		if ( gathered_ ) {
+			v += sum_q( t );
+		} else {
+			for ( size_type i = 0, n = co_.size(); i < n; ++i ) {
+				v += co_[ i ] * xo_[ i ]->q( t );
+			}
 		}
 		Value const vc( cv_ == 0.0 ? v : v + ( cv_ * xv_->q( t ) ) );
 		Value const cv_del( cv_ * del );
@@ -379,8 +392,12 @@ public: // Properties
 
 		// Derivative at +/- del
 		Value s( 0.0 );
-		for ( size_type i = ioBeg[ 2 ], n = co_.size(); i < n; ++i ) {
-			s += co_[ i ] * xo_[ i ]->q1( t );
+		if ( gathered_ ) {
+			s += sum_q1( t );
+		} else {
+			for ( size_type i = ioBeg[ 2 ], n = co_.size(); i < n; ++i ) {
+				s += co_[ i ] * xo_[ i ]->q1( t );
+			}
 		}
 		Value const sl( s + ( cv_ * vl ) );
 		Value const su( s + ( cv_ * vu ) );
@@ -425,6 +442,27 @@ public: // Properties
 		return AdvanceSpecs_LIQSS2{ vl, vu, z1, sl, su, z2 };
 	}
 
+	// Constant Term
+	Coefficient
+	constant() const
+	{
+		return c0_;
+	}
+
+	// Coefficients: Ordered by Variable QSS Order Once Finalized
+	Coefficients const &
+	coefficients() const
+	{
+		return c_;
+	}
+
+	// Variables: Ordered by QSS Order Once Finalized
+	Variables const &
+	variables() const
+	{
+		return x_;
+	}
+
 public: // Methods
 
 	// Add Constant
@@ -513,6 +551,18 @@ public: // Methods
 		return *this;
 	}
 
+	// Replace a Variable: Before Finalize
+	void
+	replace(
+	 Variable const * x,
+	 Variable * y
+	)
+	{
+		for ( Variable * & v : x_ ) {
+			if ( v == x ) v = y;
+		}
+	}
+
 	// Finalize Function Representation
 	bool
 	finalize( Variable * v )
@@ -561,6 +611,16 @@ public: // Methods
 				x->add_observer( v );
 			}
 		}
+
+		// Incremental or vectorized quantized sum of non-self variables
+		incremental_ = options::incremental;
+		gathered_ = incremental_ || options::simd;
+		sum_.clear();
+		if ( gathered_ ) {
+			for ( size_type i = 0, n = co_.size(); i < n; ++i ) {
+				xo_[ i ]->add_sum( &sum_, sum_.add( co_[ i ] ), v );
+			}
+		}
 		return self_observer;
 	}
 
@@ -571,6 +631,45 @@ public: // Methods
 		return finalize( &v );
 	}
 
+private: // Methods
+
+	// Quantized Sum of non-self Variables: Built on first use
+	Sum_LTI const &
+	sum() const
+	{
+		if ( ! sum_.built() ) {
+			assert( sum_.size() == xo_.size() );
+			for ( size_type i = 0, n = xo_.size(); i < n; ++i ) {
+				Variable const * x( xo_[ i ] );
+				Time const tQ( x->tQ );
+				sum_.set( i, tQ, x->q( tQ ), x->q1( tQ ), one_half * x->q2( tQ ) );
+			}
+			sum_.build( xv_->tQ );
+		}
+		return sum_;
+	}
+
+	// Quantized Value Sum of non-self Variables at Time t
+	Value
+	sum_q( Time const t ) const
+	{
+		return ( incremental_ ? sum().q( t ) : sum().q_sum( t ) );
+	}
+
+	// Quantized First Derivative Sum of non-self Variables at Time t
+	Value
+	sum_q1( Time const t ) const
+	{
+		return ( incremental_ ? sum().q1( t ) : sum().q1_sum( t ) );
+	}
+
+	// Quantized Second Derivative Sum of non-self Variables at Time t
+	Value
+	sum_q2( Time const t ) const
+	{
+		return ( incremental_ ? sum().q2( t ) : sum().q2_sum() );
+	}
+
 public: // Static Data
 
 	static int const max_order = 3; // Max QSS order supported
@@ -587,6 +686,9 @@ private: // Data
 	Variable * xv_{ nullptr }; // Self Variable
 	Coefficients co_; // Coefficients for Variables other than self Variable
 	Variables xo_; // Variables other than self Variable
+	bool incremental_{ false }; // Use incremental quantized sum?
+	bool gathered_{ false }; // Use gathered (incremental or vectorized) quantized sum?
+	mutable Sum_LTI sum_; // Quantized sum of Variables other than self Variable
 
 };
 
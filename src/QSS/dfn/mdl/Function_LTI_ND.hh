@@ -403,6 +403,7 @@ public: // Methods
 public: // Static Data
 
 	static int const max_order = 3; // Max QSS order supported
+	static bool const concurrent = false; // Numeric differentiation reads observees off the stage time: No parallel stages
 
 private: // Data
 
@@ -420,6 +421,9 @@ private: // Data
 
 };
 
+	// Static Data Member Template Definitions
+	template< typename V > bool const Function_LTI_ND< V >::concurrent;
+
 } // mdl
 } // dfn
 } // QSS
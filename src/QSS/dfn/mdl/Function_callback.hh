@@ -0,0 +1,699 @@
+// Compiled Callback Derivative Function
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_mdl_Function_callback_hh_INCLUDED
+#define QSS_dfn_mdl_Function_callback_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/math.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+extern "C" {
+
+// Derivative Callback: Value at Time t given the observee values x in the order added
+typedef double (*QSS_dfn_callback)( double t, double const * x, void * data );
+
+// Batch Derivative Callback: Derivative outputs i[0:n] at Time t into d[0:n] given each output's observee values packed contiguously in x in output order
+typedef void (*QSS_dfn_callback_batch)( double t, std::size_t n, std::size_t const * i, double const * x, double * d, void * data );
+
+}
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+// Batch Callback Derivatives of a Model
+//
+// Evaluates the derivative outputs of a pass's observers with one callback per
+// evaluation time over contiguous input and output arrays: A trigger opens a
+// pass, its observers' quantized derivatives at t and t +/- dtn are evaluated
+// together, and the observer advances read them while the pass stamp matches
+template< typename V > // Template to avoid cyclic inclusion with Variable
+class Callback_batch final : public V::ObserverBatch
+{
+
+public: // Types
+
+	using Variable = V;
+	using Variables = typename V::Variables;
+	using Time = typename Variable::Time;
+	using Value = typename Variable::Value;
+	using Values = std::vector< Value >;
+	using size_type = typename Variables::size_type;
+	using Indexes = std::vector< size_type >;
+
+private: // Types
+
+	// Derivative Output
+	struct Output
+	{
+		Variable * observer{ nullptr }; // Observer Variable
+		Variables const * x{ nullptr }; // Observee Variables in callback argument order
+		size_type stamp{ 0u }; // Pass stamp of the evaluated values
+		Value d[ 3 ]; // Derivative values at t, t + dtn, and t - dtn
+	};
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Callback_batch(
+	 QSS_dfn_callback_batch const f = nullptr,
+	 void * data = nullptr
+	) :
+	 f_( f ),
+	 data_( data )
+	{}
+
+public: // Properties
+
+	// Size
+	size_type
+	size() const
+	{
+		return outputs_.size();
+	}
+
+	// Pass Stamp
+	size_type
+	stamp() const
+	{
+		return stamp_;
+	}
+
+	// Derivative i Value at Time t Evaluated by the Open Pass?
+	bool
+	cached( size_type const i, Time const t, Value & d ) const
+	{
+		assert( i < outputs_.size() );
+		if ( ! evaluated_ ) return false;
+		Output const & output( outputs_[ i ] );
+		if ( output.stamp != stamp_ ) return false;
+		int const order( output.observer->order() );
+		if ( t == t_ ) {
+			d = output.d[ 0 ];
+		} else if ( ( order >= 2 ) && ( t == t_ + dtn_ ) ) {
+			d = output.d[ 1 ];
+		} else if ( ( order >= 3 ) && ( t == t_ - dtn_ ) ) {
+			d = output.d[ 2 ];
+		} else {
+			return false;
+		}
+		return true;
+	}
+
+	// Derivative i Value at Time t Given its Observee Values
+	Value
+	d( size_type const i, Time const t, Value const * x ) const
+	{
+		assert( f_ != nullptr );
+		assert( i < outputs_.size() );
+		Value v;
+		f_( t, 1u, &i, x, &v, data_ );
+		return v;
+	}
+
+public: // Methods
+
+	// Set Callback
+	void
+	callback( QSS_dfn_callback_batch const f, void * data = nullptr )
+	{
+		f_ = f;
+		data_ = data;
+	}
+
+	// Add n Outputs
+	Callback_batch &
+	add_outputs( size_type const n )
+	{
+		outputs_.resize( outputs_.size() + n );
+		return *this;
+	}
+
+	// Attach Output i's Observer Variable and its Observees: The Observees Become Triggers of the Output
+	void
+	attach( size_type const i, Variable * observer, Variables const & x )
+	{
+		assert( i < outputs_.size() );
+		assert( observer != nullptr );
+		Output & output( outputs_[ i ] );
+		output.observer = observer;
+		output.x = &x;
+		Variables xs( x );
+		std::sort( xs.begin(), xs.end() );
+		xs.erase( std::unique( xs.begin(), xs.end() ), xs.end() );
+		for ( Variable * trigger : xs ) {
+			if ( trigger == observer ) continue; // Self requantization isn't an observer pass
+			size_type const k( trigger->add_batch( this, triggers_.size() ) );
+			if ( k == triggers_.size() ) triggers_.emplace_back();
+			triggers_[ k ].push_back( i );
+		}
+	}
+
+	// Add the Outputs Observing Trigger k to the Pass: Opens a Pass if None is Open
+	void
+	add( size_type const k ) override
+	{
+		assert( k < triggers_.size() );
+		if ( ! open_ ) {
+			open_ = true;
+			evaluated_ = false;
+			++stamp_;
+			pass_.clear();
+		}
+		for ( size_type const i : triggers_[ k ] ) {
+			Output & output( outputs_[ i ] );
+			if ( output.stamp != stamp_ ) {
+				output.stamp = stamp_;
+				pass_.push_back( i );
+			}
+		}
+	}
+
+	// Evaluate the Pass's Outputs at Time t and at t +/- dtn for the Observer Orders that Use Them
+	void
+	evaluate( Time const t ) override
+	{
+		assert( open_ );
+		if ( evaluated_ ) return;
+		t_ = t;
+		evaluate_at( 0, t );
+		evaluate_at( 2, t + dtn_ );
+		evaluate_at( 3, t - dtn_ );
+		evaluated_ = true;
+	}
+
+	// Close the Pass
+	void
+	end() override
+	{
+		open_ = false;
+		evaluated_ = false;
+	}
+
+	// Set Differentiation Time Step: Match the Observers' Function Time Step
+	void
+	dtn( Time const dtn )
+	{
+		assert( dtn > 0.0 );
+		dtn_ = dtn;
+	}
+
+private: // Methods
+
+	// Evaluate the Pass's Outputs of Observers of at Least a Given Order at Time t into Slot j
+	void
+	evaluate_at( int const order, Time const t )
+	{
+		size_type const j( order == 0 ? 0u : static_cast< size_type >( order - 1 ) );
+		is_.clear();
+		xs_.clear();
+		for ( size_type const i : pass_ ) {
+			Output const & output( outputs_[ i ] );
+			if ( output.observer->order() < order ) continue;
+			is_.push_back( i );
+			for ( Variable const * x : *output.x ) xs_.push_back( x->q( t ) );
+		}
+		if ( is_.empty() ) return;
+		ds_.resize( is_.size() );
+		f_( t, is_.size(), is_.data(), xs_.data(), ds_.data(), data_ );
+		for ( size_type k = 0, n = is_.size(); k < n; ++k ) {
+			outputs_[ is_[ k ] ].d[ j ] = ds_[ k ];
+		}
+	}
+
+private: // Data
+
+	QSS_dfn_callback_batch f_{ nullptr }; // Callback
+	void * data_{ nullptr }; // Callback user data
+	std::vector< Output > outputs_; // Derivative outputs
+	std::vector< Indexes > triggers_; // Outputs observing each trigger
+	Indexes pass_; // Outputs of the open pass
+	size_type stamp_{ 0u }; // Pass stamp
+	bool open_{ false }; // Pass open?
+	bool evaluated_{ false }; // Open pass evaluated?
+	Time t_{ 0.0 }; // Pass time
+	Time dtn_{ options::dtNum }; // Differentiation time step
+	Indexes is_; // Output indexes of an evaluation
+	Values xs_; // Packed observee values of an evaluation
+	Values ds_; // Derivative values of an evaluation
+
+};
+
+// Compiled Callback Derivative Function
+//
+// Calls a compiled C function (e.g., from generated model code loaded with
+// dlopen) or one output of a Callback_batch: Derivatives use numeric
+// differentiation and LIQSS zero points assume linearity in the self Variable
+template< typename V > // Template to avoid cyclic inclusion with Variable
+class Function_callback
+{
+
+public: // Types
+
+	using Variable = V;
+	using Variables = typename V::Variables;
+	using Time = typename Variable::Time;
+	using Value = typename Variable::Value;
+	using Values = std::vector< Value >;
+	using Coefficient = double;
+	using AdvanceSpecs_LIQSS1 = typename Variable::AdvanceSpecs_LIQSS1;
+	using AdvanceSpecs_LIQSS2 = typename Variable::AdvanceSpecs_LIQSS2;
+	using Batch = Callback_batch< V >;
+	using Rep = Value (Variable::*)( Time const ) const; // Variable representation member
+	using size_type = typename Variables::size_type;
+
+public: // Creation
+
+	// Default Constructor
+	Function_callback()
+	{}
+
+	// Callback Constructor
+	explicit
+	Function_callback(
+	 QSS_dfn_callback const f,
+	 void * data = nullptr
+	) :
+	 f_( f ),
+	 data_( data )
+	{}
+
+public: // Properties
+
+	// Continuous Value at Time t
+	Value
+	operator ()( Time const t ) const
+	{
+		return v( t, &Variable::x );
+	}
+
+	// Continuous Value at Time t
+	Value
+	x( Time const t ) const
+	{
+		return v( t, &Variable::x );
+	}
+
+	// Continuous First Derivative at Time t
+	Value
+	x1( Time const t ) const
+	{
+		return dtn_inv_2_ * ( v( t + dtn_, &Variable::x ) - v( t - dtn_, &Variable::x ) );
+	}
+
+	// Continuous Second Derivative at Time t
+	Value
+	x2( Time const t ) const
+	{
+		return dtn_inv_sq_ * ( v( t + dtn_, &Variable::x ) - ( 2.0 * v( t, &Variable::x ) ) + v( t - dtn_, &Variable::x ) );
+	}
+
+	// Quantized Value at Time t
+	Value
+	q( Time const t ) const
+	{
+		return v( t, &Variable::q );
+	}
+
+	// Quantized First Derivative at Time t
+	Value
+	q1( Time const t ) const
+	{
+		return dtn_inv_2_ * ( v( t + dtn_, &Variable::q ) - v( t - dtn_, &Variable::q ) );
+	}
+
+	// Quantized Second Derivative at Time t
+	Value
+	q2( Time const t ) const
+	{
+		return dtn_inv_sq_ * ( v( t + dtn_, &Variable::q ) - ( 2.0 * v( t, &Variable::q ) ) + v( t - dtn_, &Variable::q ) );
+	}
+
+	// Quantized Sequential Value at Time t
+	Value
+	qs( Time const t ) const
+	{
+		return v_t_ = v( t, &Variable::q );
+	}
+
+	// Quantized Forward-Difference Sequential First Derivative at Time t
+	Value
+	qf1( Time const t ) const
+	{
+		return dtn_inv_ * ( v( t + dtn_, &Variable::q ) - v_t_ );
+	}
+
+	// Quantized Centered-Difference Sequential First Derivative at Time t
+	Value
+	qc1( Time const t ) const
+	{
+		return dtn_inv_2_ * ( ( v_p_ = v( t + dtn_, &Variable::q ) ) - ( v_m_ = v( t - dtn_, &Variable::q ) ) );
+	}
+
+	// Quantized Centered-Difference Sequential Second Derivative at Time t
+	Value
+	qc2( Time const t ) const
+	{
+		return dtn_inv_sq_ * ( v_p_ - ( 2.0 * v_t_ ) + v_m_ );
+	}
+
+	// Simultaneous Value at Time t
+	Value
+	s( Time const t ) const
+	{
+		return v( t, &Variable::s );
+	}
+
+	// Simultaneous Numeric Differentiation Value at Time t
+	Value
+	sn( Time const t ) const
+	{
+		return v( t, &Variable::sn );
+	}
+
+	// Simultaneous First Derivative at Time t
+	Value
+	s1( Time const t ) const
+	{
+		return dtn_inv_2_ * ( sn( t + dtn_ ) - sn( t - dtn_ ) );
+	}
+
+	// Simultaneous Second Derivative at Time t
+	Value
+	s2( Time const t ) const
+	{
+		return dtn_inv_sq_ * ( sn( t + dtn_ ) - ( 2.0 * s( t ) ) + sn( t - dtn_ ) );
+	}
+
+	// Simultaneous Sequential Value at Time t
+	Value
+	ss( Time const t ) const
+	{
+		return v_t_ = s( t );
+	}
+
+	// Simultaneous Forward-Difference Sequential First Derivative at Time t
+	Value
+	sf1( Time const t ) const
+	{
+		return dtn_inv_ * ( sn( t + dtn_ ) - v_t_ );
+	}
+
+	// Simultaneous Centered-Difference Sequential First Derivative at Time t
+	Value
+	sc1( Time const t ) const
+	{
+		return dtn_inv_2_ * ( ( v_p_ = sn( t + dtn_ ) ) - ( v_m_ = sn( t - dtn_ ) ) );
+	}
+
+	// Simultaneous Centered-Difference Sequential Second Derivative at Time t
+	Value
+	sc2( Time const t ) const
+	{
+		return dtn_inv_sq_ * ( v_p_ - ( 2.0 * v_t_ ) + v_m_ );
+	}
+
+	// Continuous Values at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS1
+	xlu1( Time const t, Value const del ) const
+	{
+		return lu1( t, del, &Variable::x );
+	}
+
+	// Quantized Values at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS1
+	qlu1( Time const t, Value const del ) const
+	{
+		return lu1( t, del, &Variable::q );
+	}
+
+	// Simultaneous Values at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS1
+	slu1( Time const t, Value const del ) const
+	{
+		return lu1( t, del, &Variable::s );
+	}
+
+	// Continuous Values and Derivatives at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS2
+	xlu2( Time const t, Value const del ) const
+	{
+		return lu2( t, del, &Variable::x, &Variable::x );
+	}
+
+	// Quantized Values and Derivatives at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS2
+	qlu2( Time const t, Value const del ) const
+	{
+		return lu2( t, del, &Variable::q, &Variable::q );
+	}
+
+	// Simultaneous Values and Derivatives at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS2
+	slu2( Time const t, Value const del ) const
+	{
+		return lu2( t, del, &Variable::s, &Variable::sn );
+	}
+
+	// Differentiation Time Step
+	Time
+	dtn() const
+	{
+		return dtn_;
+	}
+
+public: // Methods
+
+	// Set Callback
+	Function_callback &
+	callback( QSS_dfn_callback const f, void * data = nullptr )
+	{
+		f_ = f;
+		data_ = data;
+		batch_ = nullptr;
+		return *this;
+	}
+
+	// Set Batch Callback Output
+	Function_callback &
+	callback( Batch & batch, size_type const i )
+	{
+		assert( i < batch.size() );
+		f_ = nullptr;
+		data_ = nullptr;
+		batch_ = &batch;
+		i_ = i;
+		return *this;
+	}
+
+	// Add an Observee Variable: Order Matches the Callback Argument Array
+	Function_callback &
+	add( Variable * x )
+	{
+		assert( x != nullptr );
+		x_.push_back( x );
+		xv_.resize( x_.size() );
+		return *this;
+	}
+
+	// Add an Observee Variable: Order Matches the Callback Argument Array
+	Function_callback &
+	add( Variable & x )
+	{
+		return add( &x );
+	}
+
+	// Finalize Function Representation
+	bool
+	finalize( Variable * v )
+	{
+		assert( v != nullptr );
+		assert( ( f_ != nullptr ) || ( batch_ != nullptr ) );
+
+		// Sort observees and remove duplicates for observer registration
+		Variables xs( x_ );
+		std::sort( xs.begin(), xs.end() );
+		xs.erase( std::unique( xs.begin(), xs.end() ), xs.end() );
+
+		// Observers
+		bool self_observer( false );
+		for ( auto x : xs ) {
+			if ( x == v ) {
+				self_observer = true;
+			} else {
+				x->add_observer( v );
+			}
+		}
+
+		// Self Variable index
+		self_ = v;
+		iSelf_ = npos;
+		auto const i( std::find( x_.begin(), x_.end(), v ) );
+		if ( i != x_.end() ) iSelf_ = static_cast< size_type >( i - x_.begin() );
+
+		// Batch output: Observees' passes evaluate this output with the others they trigger
+		if ( batch_ != nullptr ) batch_->attach( i_, v, x_ );
+
+		return self_observer;
+	}
+
+	// Finalize Function Representation
+	bool
+	finalize( Variable & v )
+	{
+		return finalize( &v );
+	}
+
+	// Set Differentiation Time Step
+	void
+	dtn( Time const dtn )
+	{
+		assert( dtn > 0.0 );
+		dtn_ = dtn;
+		dtn_inv_ = 1.0 / dtn_;
+		dtn_inv_2_ = 0.5 / dtn_;
+		dtn_inv_sq_ = dtn_inv_ * dtn_inv_;
+	}
+
+private: // Methods
+
+	// Value at Time t Using a Variable Representation with Optional Self Value Override
+	Value
+	v( Time const t, Rep const rep, size_type const iv = npos, Value const xv = 0.0 ) const
+	{
+		if ( batch_ != nullptr ) {
+			Value d;
+			if ( ( iv == npos ) && ( rep == &Variable::q ) && batch_->cached( i_, t, d ) ) return d; // Evaluated by the trigger's pass
+		} else {
+			assert( f_ != nullptr );
+		}
+		for ( size_type i = 0, n = x_.size(); i < n; ++i ) {
+			xv_[ i ] = ( i == iv ? xv : (x_[ i ]->*rep)( t ) );
+		}
+		return ( batch_ != nullptr ? batch_->d( i_, t, xv_.data() ) : f_( t, xv_.data(), data_ ) );
+	}
+
+	// Values at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS1
+	lu1( Time const t, Value const del, Rep const rep ) const
+	{
+		assert( self_ != nullptr );
+		assert( iSelf_ != npos );
+
+		// Value at +/- del
+		Value const y( (self_->*rep)( t ) );
+		Value const vl( v( t, rep, iSelf_, y - del ) );
+		Value const vu( v( t, rep, iSelf_, y + del ) );
+
+		// Zero point: Linear interpolation in self Variable
+		Value const z( signum( vl ) != signum( vu ) ? y + ( del * ( vl + vu ) / ( vl - vu ) ) : 0.0 );
+
+		return AdvanceSpecs_LIQSS1{ vl, vu, z };
+	}
+
+	// Values and Derivatives at Time t and at Variable +/- Delta
+	AdvanceSpecs_LIQSS2
+	lu2( Time const t, Value const del, Rep const rep, Rep const rep_n ) const
+	{
+		assert( self_ != nullptr );
+		assert( iSelf_ != npos );
+
+		// Value at +/- del
+		Value const y( (self_->*rep)( t ) );
+		Value const yl( y - del );
+		Value const yu( y + del );
+		Value const vl( v( t, rep, iSelf_, yl ) );
+		Value const vu( v( t, rep, iSelf_, yu ) );
+
+		// Derivative at +/- del: Self Variable slope is the function value
+		Time const tm( t - dtn_ );
+		Time const tp( t + dtn_ );
+		Value const sl( dtn_inv_2_ * ( v( tp, rep_n, iSelf_, yl + ( vl * dtn_ ) ) - v( tm, rep_n, iSelf_, yl - ( vl * dtn_ ) ) ) );
+		Value const su( dtn_inv_2_ * ( v( tp, rep_n, iSelf_, yu + ( vu * dtn_ ) ) - v( tm, rep_n, iSelf_, yu - ( vu * dtn_ ) ) ) );
+
+		// Zero point: Linear interpolation in self Variable
+		bool const signs_differ( signum( sl ) != signum( su ) );
+		Value const f( signs_differ ? sl / ( sl - su ) : 0.0 );
+		Value const z1( signs_differ ? vl + ( ( vu - vl ) * f ) : 0.0 );
+		Value const z2( signs_differ ? yl + ( 2.0 * del * f ) : 0.0 );
+
+		return AdvanceSpecs_LIQSS2{ vl, vu, z1, sl, su, z2 };
+	}
+
+public: // Static Data
+
+	static bool const concurrent = false; // Callbacks and shared batch caches aren't thread-safe: No parallel observer advance
+
+private: // Static Data
+
+	static size_type const npos = static_cast< size_type >( -1 ); // No self Variable index
+
+private: // Data
+
+	QSS_dfn_callback f_{ nullptr }; // Callback
+	void * data_{ nullptr }; // Callback user data
+	Batch * batch_{ nullptr }; // Batch callback
+	size_type i_{ 0u }; // Batch callback output index
+	Variables x_; // Observee Variables in callback argument order
+	mutable Values xv_; // Observee values for callback
+	Variable * self_{ nullptr }; // Self Variable
+	size_type iSelf_{ npos }; // Self Variable index in callback arguments
+	mutable Value v_t_{ 0.0 }; // Last value(t) computed
+	mutable Value v_p_{ 0.0 }; // Last value(t+dtn) computed
+	mutable Value v_m_{ 0.0 }; // Last value(t-dtn) computed
+	Time dtn_{ options::dtNum }; // Differentiation time step
+	Time dtn_inv_{ 1.0 / options::dtNum }; // Differentiation time step inverse
+	Time dtn_inv_2_{ 0.5 / options::dtNum }; // Differentiation time step half inverse
+	Time dtn_inv_sq_{ 1.0 / ( options::dtNum * options::dtNum ) }; // Differentiation time step inverse squared
+
+};
+
+	// Static Data Member Template Definitions
+	template< typename V > bool const Function_callback< V >::concurrent;
+	template< typename V > typename Function_callback< V >::size_type const Function_callback< V >::npos;
+
+} // mdl
+} // dfn
+} // QSS
+
+#endif
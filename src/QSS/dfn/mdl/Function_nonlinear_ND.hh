@@ -397,6 +397,10 @@ private: // Static Methods
 		return ( 1.0 + ( 2.0 * t ) ) / ( y2 + del );
 	}
 
+public: // Static Data
+
+	static bool const concurrent = false; // Numeric differentiation reads observees off the stage time: No parallel stages
+
 private: // Data
 
 	Variable * y_{ nullptr };
@@ -410,6 +414,9 @@ private: // Data
 
 };
 
+	// Static Data Member Template Definitions
+	template< typename V > bool const Function_nonlinear_ND< V >::concurrent;
+
 } // mdl
 } // dfn
 } // QSS
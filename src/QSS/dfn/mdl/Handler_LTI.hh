@@ -0,0 +1,102 @@
+// Zero-Crossing Handler Applying Affine Resets
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_mdl_Handler_LTI_hh_INCLUDED
+#define QSS_dfn_mdl_Handler_LTI_hh_INCLUDED
+
+// C++ Headers
+#include <cassert>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+// Zero-Crossing Handler Applying Affine Resets
+template< typename V > // Template to avoid cyclic inclusion with Variable
+class Handler_LTI
+{
+
+public: // Types
+
+	using Variable = V;
+	using Time = typename Variable::Time;
+	using Value = typename Variable::Value;
+	using Crossing = typename Variable::Crossing;
+
+private: // Types
+
+	// Reset: x := a * x + b
+	struct Reset
+	{
+		Variable * x;
+		Value a;
+		Value b;
+	};
+
+	using Resets = std::vector< Reset >;
+
+public: // Properties
+
+	// Apply at Time t
+	void
+	operator ()( Time const t, Crossing const )
+	{
+		for ( Reset const & reset : resets_ ) {
+			reset.x->shift_handler( t, ( reset.a * reset.x->x( t ) ) + reset.b );
+		}
+	}
+
+public: // Methods
+
+	// Add a Reset
+	void
+	add( Variable * x, Value const a, Value const b )
+	{
+		assert( x != nullptr );
+		resets_.push_back( Reset{ x, a, b } );
+	}
+
+private: // Data
+
+	Resets resets_;
+
+};
+
+} // mdl
+} // dfn
+} // QSS
+
+#endif
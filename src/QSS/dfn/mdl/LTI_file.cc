@@ -0,0 +1,596 @@
+// Linear Time-Invariant Model File Setup
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/mdl/LTI_file.hh>
+#include <QSS/dfn/mdl/Function_Inp_sin.hh>
+#include <QSS/dfn/mdl/Function_Inp_step.hh>
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/mdl/Handler_LTI.hh>
+#include <QSS/dfn/mdl/QSS_LTI.hh>
+#include <QSS/dfn/Variable_Inp1.hh>
+#include <QSS/dfn/Variable_Inp2.hh>
+#include <QSS/dfn/Variable_Inp3.hh>
+#include <QSS/dfn/Variable_InpD.hh>
+#include <QSS/dfn/Variable_ZC1.hh>
+#include <QSS/dfn/Variable_ZC2.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+// POSIX Headers
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+namespace { // Internal
+
+using V = Variable_QSS< Function_LTI >;
+using Z = Variable_ZC< Function_LTI, Handler_LTI >;
+
+// Memory Mapped Read-Only File Contents
+class File_map
+{
+
+public: // Creation
+
+	// Constructor
+	explicit
+	File_map( std::string const & path )
+	{
+#ifdef _WIN32
+		std::ifstream stream( path, std::ios_base::binary );
+		if ( ! stream ) return;
+		buf_.assign( std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() );
+		beg_ = buf_.data();
+		end_ = beg_ + buf_.size();
+		ok_ = true;
+#else
+		int const fd( ::open( path.c_str(), O_RDONLY ) );
+		if ( fd < 0 ) return;
+		struct stat st;
+		if ( ::fstat( fd, &st ) == 0 ) {
+			size_ = static_cast< std::size_t >( st.st_size );
+			if ( size_ == 0u ) {
+				ok_ = true;
+			} else {
+				void * p( ::mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 ) );
+				if ( p != MAP_FAILED ) {
+					::madvise( p, size_, MADV_SEQUENTIAL );
+					beg_ = static_cast< char const * >( p );
+					end_ = beg_ + size_;
+					ok_ = true;
+				}
+			}
+		}
+		::close( fd );
+#endif
+	}
+
+	// Copy Constructor
+	File_map( File_map const & ) = delete;
+
+	// Destructor
+	~File_map()
+	{
+#ifndef _WIN32
+		if ( ( beg_ != nullptr ) && ( size_ > 0u ) ) ::munmap( const_cast< char * >( beg_ ), size_ );
+#endif
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	File_map &
+	operator =( File_map const & ) = delete;
+
+public: // Properties
+
+	// Opened?
+	bool
+	ok() const
+	{
+		return ok_;
+	}
+
+	// Begin
+	char const *
+	begin() const
+	{
+		return beg_;
+	}
+
+	// End
+	char const *
+	end() const
+	{
+		return end_;
+	}
+
+private: // Data
+
+	char const * beg_{ nullptr };
+	char const * end_{ nullptr };
+	bool ok_{ false };
+#ifdef _WIN32
+	std::vector< char > buf_;
+#else
+	std::size_t size_{ 0u };
+#endif
+
+};
+
+// Streaming Record Parser
+class Parser
+{
+
+public: // Creation
+
+	// Constructor
+	Parser(
+	 std::string const & path,
+	 char const * beg,
+	 char const * end
+	) :
+	 path_( path ),
+	 p_( beg ),
+	 end_( end )
+	{}
+
+public: // Properties
+
+	// Line Number
+	std::size_t
+	line() const
+	{
+		return line_;
+	}
+
+public: // Methods
+
+	// Advance to Next Record: Returns false at End
+	bool
+	next()
+	{
+		while ( p_ < end_ ) {
+			le_ = static_cast< char const * >( std::memchr( p_, '\n', end_ - p_ ) );
+			if ( le_ == nullptr ) le_ = end_;
+			++line_;
+			char const * c( static_cast< char const * >( std::memchr( p_, '#', le_ - p_ ) ) );
+			tend_ = ( c == nullptr ? le_ : c );
+			skip_space();
+			if ( p_ < tend_ ) return true; // Non-blank record
+			p_ = ( le_ < end_ ? le_ + 1 : end_ );
+		}
+		return false;
+	}
+
+	// More Tokens in Record?
+	bool
+	more()
+	{
+		skip_space();
+		return p_ < tend_;
+	}
+
+	// Next Token
+	std::pair< char const *, char const * >
+	token()
+	{
+		skip_space();
+		if ( p_ >= tend_ ) error( "Missing field" );
+		char const * b( p_ );
+		while ( ( p_ < tend_ ) && ! is_space( *p_ ) ) ++p_;
+		return std::make_pair( b, p_ );
+	}
+
+	// Next Token as String
+	std::string
+	string()
+	{
+		auto const t( token() );
+		return std::string( t.first, t.second );
+	}
+
+	// Next Token as Number
+	double
+	number()
+	{
+		auto const t( token() );
+		std::size_t const n( t.second - t.first );
+		char buf[ 64 ];
+		if ( n >= sizeof( buf ) ) error( "Number field too long" );
+		std::memcpy( buf, t.first, n );
+		buf[ n ] = '\0';
+		char * e( nullptr );
+		double const v( std::strtod( buf, &e ) );
+		if ( e != buf + n ) error( "Invalid number: " + std::string( buf ) );
+		return v;
+	}
+
+	// End of Record: Error if Extra Fields
+	void
+	done()
+	{
+		if ( more() ) error( "Extra fields" );
+		p_ = ( le_ < end_ ? le_ + 1 : end_ );
+	}
+
+	// Report Error and Exit
+	void
+	error( std::string const & msg ) const
+	{
+		std::cerr << "Error: " << msg << " in LTI model file " << path_ << " at line " << line_ << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+
+private: // Methods
+
+	// Space Character?
+	static
+	bool
+	is_space( char const c )
+	{
+		return ( c == ' ' ) || ( c == '\t' ) || ( c == '\r' ) || ( c == '\v' ) || ( c == '\f' );
+	}
+
+	// Skip Spaces
+	void
+	skip_space()
+	{
+		while ( ( p_ < tend_ ) && is_space( *p_ ) ) ++p_;
+	}
+
+private: // Data
+
+	std::string path_; // File path
+	char const * p_{ nullptr }; // Position
+	char const * end_{ nullptr }; // File end
+	char const * le_{ nullptr }; // Line end
+	char const * tend_{ nullptr }; // Record token end
+	std::size_t line_{ 0u }; // Line number
+
+};
+
+// Open-Addressing Map from Names in the Mapped File to Values
+//
+// Short names are held in the slots and long names point into the file
+// contents so lookups need no allocation and rarely leave the slot array
+template< typename T >
+class Name_map
+{
+
+private: // Types
+
+	// Slot
+	struct Slot
+	{
+		std::size_t h{ 0u }; // Name hash
+		std::uint32_t n{ 0u }; // Name length: 0 for empty slots
+		char k[ 20 ]; // Short name
+		char const * b{ nullptr }; // Name begin in file
+		T value;
+
+		// Name Matches?
+		bool
+		matches( std::size_t const h_, char const * b_, std::size_t const n_ ) const
+		{
+			return ( h == h_ ) && ( n == n_ ) && ( std::memcmp( n_ <= sizeof( k ) ? k : b, b_, n_ ) == 0 );
+		}
+	};
+
+	using Slots = std::vector< Slot >;
+
+public: // Creation
+
+	// Default Constructor
+	Name_map() :
+	 slots_( 1024u )
+	{}
+
+public: // Properties
+
+	// Find by Name: Returns nullptr if Not Present
+	T const *
+	find( char const * b, char const * e ) const
+	{
+		std::size_t const n( e - b );
+		std::size_t const h( hash( b, e ) );
+		std::size_t const mask( slots_.size() - 1u );
+		for ( std::size_t i = h & mask; slots_[ i ].n != 0u; i = ( i + 1u ) & mask ) {
+			Slot const & slot( slots_[ i ] );
+			if ( slot.matches( h, b, n ) ) return &slot.value;
+		}
+		return nullptr;
+	}
+
+public: // Methods
+
+	// Insert: Returns false if Name is Already Present
+	bool
+	insert( char const * b, char const * e, T const & value )
+	{
+		assert( b < e );
+		if ( 2u * ( size_ + 1u ) > slots_.size() ) grow();
+		std::size_t const n( e - b );
+		std::size_t const h( hash( b, e ) );
+		std::size_t const mask( slots_.size() - 1u );
+		std::size_t i( h & mask );
+		for ( ; slots_[ i ].n != 0u; i = ( i + 1u ) & mask ) {
+			if ( slots_[ i ].matches( h, b, n ) ) return false;
+		}
+		Slot & slot( slots_[ i ] );
+		slot.h = h;
+		slot.n = static_cast< std::uint32_t >( n );
+		if ( n <= sizeof( slot.k ) ) std::memcpy( slot.k, b, n );
+		slot.b = b;
+		slot.value = value;
+		++size_;
+		return true;
+	}
+
+private: // Methods
+
+	// Double the Capacity
+	void
+	grow()
+	{
+		Slots old( 2u * slots_.size() );
+		old.swap( slots_ );
+		std::size_t const mask( slots_.size() - 1u );
+		for ( Slot const & slot : old ) {
+			if ( slot.n == 0u ) continue;
+			std::size_t i( slot.h & mask );
+			while ( slots_[ i ].n != 0u ) i = ( i + 1u ) & mask;
+			slots_[ i ] = slot;
+		}
+	}
+
+	// FNV-1a Hash of Name
+	static
+	std::size_t
+	hash( char const * b, char const * const e )
+	{
+		std::uint64_t h( 14695981039346656037ull );
+		while ( b < e ) {
+			h ^= static_cast< unsigned char >( *b++ );
+			h *= 1099511628211ull;
+		}
+		return static_cast< std::size_t >( h ^ ( h >> 32 ) );
+	}
+
+private: // Data
+
+	Slots slots_; // Slots: Size is a power of 2
+	std::size_t size_{ 0u }; // Names held
+
+};
+
+} // Internal
+
+// LTI Model File?
+bool
+is_LTI_file( std::string const & path )
+{
+	return ( path.length() >= 5 ) && ( path.rfind( ".lti" ) == path.length() - 4u );
+}
+
+// Linear Time-Invariant Model File Setup
+void
+LTI_file( Variables & vars, std::string const & path, Parameters & params )
+{
+	using namespace options;
+	options::QSS const qss( params.qss );
+	int const qss_order( params.qss_order() );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
+
+	File_map const file( path );
+	if ( ! file.ok() ) {
+		std::cerr << "Error: LTI model file open failed: " << path << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+
+	// Lookup of Variables by name
+	struct Entry
+	{
+		Variable * v; // Variable
+		V * x; // QSS state variable or nullptr
+		Z * z; // Zero-crossing variable or nullptr
+	};
+	Name_map< Entry > lookup;
+
+	// Variable lookup
+	vars.clear();
+	Parser parser( path, file.begin(), file.end() );
+	std::pair< char const *, char const * > name; // Name of variable being declared
+	auto name_string = [&]() -> std::string {
+		return std::string( name.first, name.second );
+	};
+	auto entry = [&]() -> Entry const & {
+		auto const t( parser.token() );
+		Entry const * e( lookup.find( t.first, t.second ) );
+		if ( e == nullptr ) parser.error( "Undeclared variable: " + std::string( t.first, t.second ) );
+		return *e;
+	};
+	auto variable = [&]() -> Variable * {
+		return entry().v;
+	};
+	auto state = [&]() -> V * {
+		Entry const & e( entry() );
+		if ( e.x == nullptr ) parser.error( "Not a state variable: " + e.v->name );
+		return e.x;
+	};
+	auto declare = [&]( Variable * v, V * x, Z * z ) {
+		if ( ! lookup.insert( name.first, name.second, Entry{ v, x, z } ) ) parser.error( "Duplicate variable: " + v->name );
+		vars.push_back( v );
+	};
+	auto terms = [&]( Function_LTI< Variable > & f ) {
+		while ( parser.more() ) {
+			double const c( parser.number() );
+			f.add( c, variable() );
+		}
+	};
+
+	// Records
+	while ( parser.next() ) {
+		std::string const kind( parser.string() );
+		if ( kind == "tEnd" ) {
+			double const t( parser.number() );
+			if ( ! params.tEnd_set ) params.tEnd = t;
+		} else if ( kind == "var" ) {
+			name = parser.token();
+			double const x0( parser.number() );
+			QSS method( qss );
+			if ( parser.more() ) {
+				std::string const m( parser.string() );
+				if ( m == "QSS1" ) {
+					method = QSS::QSS1;
+				} else if ( m == "QSS2" ) {
+					method = QSS::QSS2;
+				} else if ( m == "QSS3" ) {
+					method = QSS::QSS3;
+				} else if ( m == "LIQSS1" ) {
+					method = QSS::LIQSS1;
+				} else if ( m == "LIQSS2" ) {
+					method = QSS::LIQSS2;
+				} else if ( m != "-" ) {
+					parser.error( "Unsupported QSS method: " + m );
+				}
+			}
+			double const r( parser.more() ? parser.number() : rTol );
+			double const a( parser.more() ? parser.number() : aTol );
+			V * v( new_QSS_LTI( method, name_string(), r, a, x0 ) );
+			declare( v, v, nullptr );
+		} else if ( kind == "inp" ) {
+			name = parser.token();
+			std::string const f( parser.string() );
+			if ( f == "sin" ) {
+				double const c( parser.number() );
+				double const s( parser.number() );
+				Variable_Inp< Function_Inp_sin > * u( nullptr );
+				if ( qss_order == 1 ) {
+					u = new Variable_Inp1< Function_Inp_sin >( name_string(), rTol, aTol );
+				} else if ( qss_order == 2 ) {
+					u = new Variable_Inp2< Function_Inp_sin >( name_string(), rTol, aTol );
+				} else {
+					u = new Variable_Inp3< Function_Inp_sin >( name_string(), rTol, aTol );
+				}
+				u->f().c( c ).s( s );
+				if ( parser.more() ) u->set_dt_max( parser.number() );
+				declare( u, nullptr, nullptr );
+			} else if ( f == "step" ) {
+				double const h_0( parser.number() );
+				double const h( parser.number() );
+				double const d( parser.number() );
+				if ( d <= 0.0 ) parser.error( "Step input time delta must be positive" );
+				Variable_InpD< Function_Inp_step > * u( new Variable_InpD< Function_Inp_step >( name_string() ) );
+				u->f().h_0( h_0 ).h( h ).d( d );
+				declare( u, nullptr, nullptr );
+			} else {
+				parser.error( "Unsupported input function: " + f );
+			}
+		} else if ( kind == "der" ) {
+			V * v( state() );
+			v->d().add( parser.number() );
+			terms( v->d() );
+		} else if ( kind == "zc" ) {
+			name = parser.token();
+			std::string const dir( parser.string() );
+			Z * z( nullptr );
+			if ( qss_order == 1 ) {
+				z = new Variable_ZC1< Function_LTI, Handler_LTI >( name_string(), rTol, aTol );
+			} else {
+				z = new Variable_ZC2< Function_LTI, Handler_LTI >( name_string(), rTol, aTol );
+			}
+			declare( z, nullptr, z );
+			if ( dir == "Dn" ) {
+				z->add_crossings_Dn();
+			} else if ( dir == "Up" ) {
+				z->add_crossings_Up();
+			} else if ( dir == "DnUp" ) {
+				z->add_crossings_non_Flat();
+			} else if ( dir == "All" ) {
+				z->add_crossings_all();
+			} else {
+				parser.error( "Unsupported zero-crossing direction: " + dir );
+			}
+			z->f().add( parser.number() );
+			terms( z->f() );
+		} else if ( kind == "term" ) {
+			Entry const & e( entry() );
+			if ( e.x != nullptr ) {
+				terms( e.x->d() );
+			} else if ( e.z != nullptr ) {
+				terms( e.z->f() );
+			} else {
+				parser.error( "Not a state or zero-crossing variable: " + e.v->name );
+			}
+		} else if ( kind == "reset" ) {
+			Entry const & e( entry() );
+			if ( e.z == nullptr ) parser.error( "Not a zero-crossing variable: " + e.v->name );
+			Z * z( e.z );
+			V * x( state() );
+			double const a( parser.number() );
+			double const b( parser.number() );
+			z->h().add( x, a, b );
+		} else {
+			parser.error( "Unknown record: " + kind );
+		}
+		parser.done();
+	}
+	if ( vars.empty() ) {
+		std::cerr << "Error: LTI model file has no variables: " << path << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+}
+
+} // mdl
+} // dfn
+} // QSS
@@ -0,0 +1,76 @@
+// Linear Time-Invariant Model File Setup
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_mdl_LTI_file_hh_INCLUDED
+#define QSS_dfn_mdl_LTI_file_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+using Variables = std::vector< Variable * >;
+
+// LTI Model File?
+bool
+is_LTI_file( std::string const & path );
+
+// Linear Time-Invariant Model File Setup
+//
+// Line-oriented text records, # starts a comment:
+//  tEnd TIME
+//  var NAME X0 [METHOD|- [RTOL [ATOL]]]     State variable: METHOD is (LI)QSS1|2|3 or - for --qss
+//  inp NAME sin C S [DTMAX]                 Input c * sin( s * t )
+//  inp NAME step H0 H D                     Input h0 + h * floor( t / d )
+//  der NAME C0 [COEF VAR]...                State derivative: Constant and terms
+//  zc NAME Dn|Up|DnUp|All C0 [COEF VAR]...  Zero-crossing function
+//  term NAME COEF VAR [COEF VAR]...         More terms for a der or zc function
+//  reset ZC VAR A B                         On ZC crossing set VAR to A * VAR + B
+// Variables must be declared before they are referenced
+void
+LTI_file( Variables & vars, std::string const & path, Parameters & params );
+
+} // mdl
+} // dfn
+} // QSS
+
+#endif
@@ -0,0 +1,86 @@
+// Model Build Parameters
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_dfn_mdl_Parameters_hh_INCLUDED
+#define QSS_dfn_mdl_Parameters_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+// Model Build Parameters: Per-Simulation Settings the Model Builders Take Instead of the Global Options
+struct Parameters
+{
+	options::QSS qss{ options::qss }; // QSS method
+	double rTol{ options::rTol }; // Relative tolerance
+	double aTol{ options::aTol }; // Absolute tolerance
+	std::size_t size{ options::gen::size }; // Generated model size
+	std::size_t degree{ options::gen::degree }; // Generated model mean coupling degree
+	bool power{ options::gen::power }; // Generated model power law degree distribution?
+	std::uint64_t seed{ options::gen::seed }; // Generated model random seed
+	double tEnd{ options::tEnd }; // End time (s): Set to the model default by the builder unless tEnd_set
+	bool tEnd_set{ options::tEnd_set }; // End time set?
+
+	// QSS Method Order
+	int
+	qss_order() const
+	{
+		switch ( qss ) {
+		case options::QSS::QSS1:
+		case options::QSS::LIQSS1:
+			return 1;
+		case options::QSS::QSS3:
+		case options::QSS::LIQSS3:
+			return 3;
+		default:
+			return 2;
+		}
+	}
+
+};
+
+} // mdl
+} // dfn
+} // QSS
+
+#endif
@@ -0,0 +1,89 @@
+// QSS State Variable with LTI Derivative Factory
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_mdl_QSS_LTI_hh_INCLUDED
+#define QSS_dfn_mdl_QSS_LTI_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/Variable_LIQSS1.hh>
+#include <QSS/dfn/Variable_LIQSS2.hh>
+#include <QSS/dfn/Variable_QSS1.hh>
+#include <QSS/dfn/Variable_QSS2.hh>
+#include <QSS/dfn/Variable_QSS3.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+// New QSS State Variable of a Given Method with LTI Derivative
+inline
+Variable_QSS< Function_LTI > *
+new_QSS_LTI(
+ options::QSS const qss,
+ std::string const & name,
+ double const rTol,
+ double const aTol,
+ double const xIni
+)
+{
+	switch ( qss ) {
+	case options::QSS::QSS1:
+		return new Variable_QSS1< Function_LTI >( name, rTol, aTol, xIni );
+	case options::QSS::QSS2:
+		return new Variable_QSS2< Function_LTI >( name, rTol, aTol, xIni );
+	case options::QSS::QSS3:
+		return new Variable_QSS3< Function_LTI >( name, rTol, aTol, xIni );
+	case options::QSS::LIQSS1:
+		return new Variable_LIQSS1< Function_LTI >( name, rTol, aTol, xIni );
+	case options::QSS::LIQSS2:
+		return new Variable_LIQSS2< Function_LTI >( name, rTol, aTol, xIni );
+	default:
+		std::cerr << "Error: Unsupported QSS method" << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+}
+
+} // mdl
+} // dfn
+} // QSS
+
+#endif
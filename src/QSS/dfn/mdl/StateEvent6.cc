@@ -300,12 +300,15 @@ public: // Static Data
 
 // StateEvent6 Example Setup
 void
-StateEvent6( Variables & vars )
+StateEvent6( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 10.0;
+	if ( ! params.tEnd_set ) params.tEnd = 10.0;
 
 	vars.clear();
 	vars.reserve( 5 );
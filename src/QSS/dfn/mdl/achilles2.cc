@@ -53,12 +53,15 @@ using Variables = std::vector< Variable * >;
 //
 // Symmetric duplicate variables to test simultaneous triggering
 void
-achilles2( Variables & vars )
+achilles2( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 10.0;
+	if ( ! params.tEnd_set ) params.tEnd = 10.0;
 
 	// Variables
 	using V = Variable_QSS< Function_LTI >;
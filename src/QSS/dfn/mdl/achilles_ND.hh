@@ -38,6 +38,7 @@
 
 // QSS Headers
 #include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
 
 // C++ Headers
 #include <vector>
@@ -50,7 +51,7 @@ using Variables = std::vector< Variable * >;
 
 // Achilles and the Tortoise Numeric Differentiation Example Setup
 void
-achilles_ND( Variables & vars );
+achilles_ND( Variables & vars, Parameters & params );
 
 } // mdl
 } // dfn
@@ -110,12 +110,15 @@ private: // Data
 
 // Bouncing Ball Example Setup
 void
-bball( Variables & vars )
+bball( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 3.0;
+	if ( ! params.tEnd_set ) params.tEnd = 3.0;
 
 	// QSS variables
 	using V = Variable_QSS< Function_LTI >;
@@ -38,6 +38,7 @@
 
 // QSS Headers
 #include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
 
 // C++ Headers
 #include <vector>
@@ -50,7 +51,7 @@ using Variables = std::vector< Variable * >;
 
 // Exponential Decay Example Setup
 void
-exponential_decay( Variables & vars );
+exponential_decay( Variables & vars, Parameters & params );
 
 } // mdl
 } // dfn
@@ -55,12 +55,15 @@ using Variables = std::vector< Variable * >;
 
 // Exponential Decay with Sine Input Example Setup
 void
-exponential_decay_sine( Variables & vars )
+exponential_decay_sine( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 50.0;
+	if ( ! params.tEnd_set ) params.tEnd = 50.0;
 
 	// Variables
 	using V = Variable_QSS< Function_LTI >;
@@ -38,6 +38,7 @@
 
 // QSS Headers
 #include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
 
 // C++ Headers
 #include <vector>
@@ -50,7 +51,7 @@ using Variables = std::vector< Variable * >;
 
 // Exponential Decay with Sine Input and Numeric Differentiation Example Setup
 void
-exponential_decay_sine_ND( Variables & vars );
+exponential_decay_sine_ND( Variables & vars, Parameters & params );
 
 } // mdl
 } // dfn
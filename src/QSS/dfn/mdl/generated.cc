@@ -0,0 +1,352 @@
+// Generated Scalable Benchmark Model Setup
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/mdl/generated.hh>
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/mdl/Handler_LTI.hh>
+#include <QSS/dfn/mdl/QSS_LTI.hh>
+#include <QSS/dfn/Variable_ZC1.hh>
+#include <QSS/dfn/Variable_ZC2.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+namespace { // Internal
+
+using V = Variable_QSS< Function_LTI >;
+using Z = Variable_ZC< Function_LTI, Handler_LTI >;
+using size_type = std::size_t;
+
+// Seeded Random Numbers: Platform-Independent Sequence
+class Random
+{
+
+public: // Creation
+
+	// Seed Constructor
+	explicit
+	Random( std::uint64_t const seed ) :
+	 g_( seed )
+	{}
+
+public: // Methods
+
+	// Uniform on [0,1)
+	double
+	uniform()
+	{
+		return ( g_() >> 11 ) * ( 1.0 / 9007199254740992.0 ); // 2^53
+	}
+
+	// Uniform on [a,b)
+	double
+	uniform( double const a, double const b )
+	{
+		return a + ( ( b - a ) * uniform() );
+	}
+
+	// Uniform Index on [0,n)
+	size_type
+	index( size_type const n )
+	{
+		return std::min( static_cast< size_type >( uniform() * n ), n - 1u );
+	}
+
+private: // Data
+
+	std::mt19937_64 g_;
+
+};
+
+// Indexed Name
+std::string
+name_of( char const * const prefix, size_type const i )
+{
+	return prefix + std::to_string( i );
+}
+
+// State Variables with Random Initial Values on [0,1)
+void
+states( Variables & vars, std::vector< V * > & x, size_type const n, Random & random, Parameters const & params )
+{
+	x.reserve( n );
+	vars.reserve( vars.size() + n );
+	for ( size_type i = 0; i < n; ++i ) {
+		V * v( new_QSS_LTI( params.qss, name_of( "x", i ), params.rTol, params.aTol, random.uniform() ) );
+		x.push_back( v );
+		vars.push_back( v );
+	}
+}
+
+// Nearest Integer d-th Root of n: At Least 1
+size_type
+side_of( size_type const n, int const d )
+{
+	return std::max( size_type( 1u ), static_cast< size_type >( std::llround( std::pow( double( n ), 1.0 / d ) ) ) );
+}
+
+// Heat Conduction Grid of Dimension d
+void
+grid( Variables & vars, int const d, Parameters & params )
+{
+	if ( ! params.tEnd_set ) params.tEnd = 1.0;
+	size_type const m( side_of( params.size, d ) );
+	size_type n( 1u );
+	for ( int k = 0; k < d; ++k ) n *= m;
+	Random random( params.seed );
+	std::vector< V * > x;
+	states( vars, x, n, random, params );
+	size_type stride[ 3 ] = { 1u, m, m * m };
+	for ( size_type i = 0; i < n; ++i ) {
+		Function_LTI< Variable > & f( x[ i ]->d() );
+		f.add( -2.0 * d, x[ i ] );
+		for ( int k = 0; k < d; ++k ) {
+			size_type const s( stride[ k ] );
+			size_type const c( ( i / s ) % m ); // Coordinate along dimension k
+			if ( c > 0u ) f.add( 1.0, x[ i - s ] );
+			if ( c + 1u < m ) f.add( 1.0, x[ i + s ] );
+		}
+	}
+}
+
+// Random Sparse Stable System
+//
+// Each row gets degree distinct off-diagonal couplings on [-1,1] with targets drawn uniformly
+// or, for the power distribution, with Zipf weights 1/k over a shuffled ranking so that
+// in-degrees follow a power law with a few heavily observed hub variables.
+// The diagonal -(sum|a|+1) makes the matrix strictly diagonally dominant and hence stable.
+void
+random_sparse( Variables & vars, Parameters & params )
+{
+	if ( ! params.tEnd_set ) params.tEnd = 1.0;
+	size_type const n( params.size );
+	size_type const degree( std::min( params.degree, n - 1u ) );
+	Random random( params.seed );
+	std::vector< V * > x;
+	states( vars, x, n, random, params );
+
+	// Power law target ranking and cumulative weights
+	std::vector< size_type > rank;
+	std::vector< double > cdf;
+	if ( params.power ) {
+		rank.resize( n );
+		for ( size_type i = 0; i < n; ++i ) rank[ i ] = i;
+		for ( size_type i = n - 1u; i > 0u; --i ) std::swap( rank[ i ], rank[ random.index( i + 1u ) ] );
+		cdf.resize( n );
+		double s( 0.0 );
+		for ( size_type k = 0; k < n; ++k ) cdf[ k ] = ( s += 1.0 / ( k + 1u ) );
+	}
+	auto target = [&]() -> size_type {
+		if ( params.power ) {
+			double const u( random.uniform() * cdf.back() );
+			size_type const k( std::min( static_cast< size_type >( std::upper_bound( cdf.begin(), cdf.end(), u ) - cdf.begin() ), n - 1u ) );
+			return rank[ k ];
+		} else {
+			return random.index( n );
+		}
+	};
+
+	std::vector< size_type > cols;
+	cols.reserve( degree );
+	for ( size_type i = 0; i < n; ++i ) {
+		cols.clear();
+		size_type tries( 0u ), max_tries( 64u * ( degree + 1u ) ); // Bounded so hub-saturated rows terminate
+		while ( ( cols.size() < degree ) && ( tries++ < max_tries ) ) {
+			size_type const j( target() );
+			if ( ( j != i ) && ( std::find( cols.begin(), cols.end(), j ) == cols.end() ) ) cols.push_back( j );
+		}
+		Function_LTI< Variable > & f( x[ i ]->d() );
+		double s( 0.0 );
+		for ( size_type const j : cols ) {
+			double const a( random.uniform( -1.0, 1.0 ) );
+			f.add( a, x[ j ] );
+			s += std::abs( a );
+		}
+		f.add( -( s + 1.0 ), x[ i ] );
+	}
+}
+
+// Driven Chain
+void
+chain( Variables & vars, Parameters & params )
+{
+	if ( ! params.tEnd_set ) params.tEnd = 10.0;
+	size_type const n( params.size );
+	Random random( params.seed );
+	std::vector< V * > x;
+	states( vars, x, n, random, params );
+	x[ 0 ]->d().add( 1.0 ).add( -1.0, x[ 0 ] );
+	for ( size_type i = 1; i < n; ++i ) {
+		x[ i ]->d().add( 1.0, x[ i - 1 ] ).add( -1.0, x[ i ] );
+	}
+}
+
+// Star Graph
+void
+star( Variables & vars, Parameters & params )
+{
+	if ( ! params.tEnd_set ) params.tEnd = 1.0;
+	size_type const n( params.size );
+	Random random( params.seed );
+	std::vector< V * > x;
+	states( vars, x, n, random, params );
+	if ( n == 1u ) return; // Lone hub: Zero derivative
+	double const w( 1.0 / ( n - 1u ) );
+	Function_LTI< Variable > & f( x[ 0 ]->d() );
+	f.add( -1.0, x[ 0 ] );
+	for ( size_type i = 1; i < n; ++i ) {
+		f.add( w, x[ i ] );
+		x[ i ]->d().add( 1.0, x[ 0 ] ).add( -1.0, x[ i ] );
+	}
+}
+
+// Thermostat Grid
+//
+// Room temperature T' = -0.1 T + 0.1 sum( Tn - T ) + 3 h with heater h switched on below 18
+// and off above 22: The heater's equilibrium of 30 and the ambient of 0 keep every room cycling.
+void
+thermostat( Variables & vars, Parameters & params )
+{
+	using namespace options;
+	options::QSS const qss( params.qss );
+	int const qss_order( params.qss_order() );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
+	if ( ! params.tEnd_set ) params.tEnd = 10.0;
+	size_type const m( side_of( params.size, 2 ) );
+	size_type const n( m * m );
+	Random random( params.seed );
+	std::vector< V * > T, h;
+	T.reserve( n );
+	h.reserve( n );
+	vars.reserve( 4u * n );
+	for ( size_type i = 0; i < n; ++i ) {
+		double const T0( random.uniform( 18.5, 21.5 ) );
+		double const h0( random.uniform() < 0.5 ? 0.0 : 1.0 );
+		V * t( new_QSS_LTI( qss, name_of( "T", i ), rTol, aTol, T0 ) );
+		V * u( new_QSS_LTI( qss, name_of( "h", i ), rTol, aTol, h0 ) ); // Zero derivative: Changed only by handlers
+		T.push_back( t );
+		h.push_back( u );
+		vars.push_back( t );
+		vars.push_back( u );
+	}
+	auto new_ZC = [&]( std::string const & name ) -> Z * {
+		Z * z( nullptr );
+		if ( qss_order == 1 ) {
+			z = new Variable_ZC1< Function_LTI, Handler_LTI >( name, rTol, aTol );
+		} else {
+			z = new Variable_ZC2< Function_LTI, Handler_LTI >( name, rTol, aTol );
+		}
+		vars.push_back( z );
+		return z;
+	};
+	for ( size_type i = 0; i < n; ++i ) {
+		size_type const r( i / m ), c( i % m );
+		Function_LTI< Variable > & f( T[ i ]->d() );
+		size_type neighbors( 0u );
+		if ( c > 0u ) { f.add( 0.1, T[ i - 1u ] ); ++neighbors; }
+		if ( c + 1u < m ) { f.add( 0.1, T[ i + 1u ] ); ++neighbors; }
+		if ( r > 0u ) { f.add( 0.1, T[ i - m ] ); ++neighbors; }
+		if ( r + 1u < m ) { f.add( 0.1, T[ i + m ] ); ++neighbors; }
+		f.add( -0.1 * ( neighbors + 1u ), T[ i ] ).add( 3.0, h[ i ] );
+
+		Z * lo( new_ZC( name_of( "zLo", i ) ) );
+		lo->add_crossings_Dn();
+		lo->f().add( -18.0 ).add( T[ i ] );
+		lo->h().add( h[ i ], 0.0, 1.0 );
+
+		Z * hi( new_ZC( name_of( "zHi", i ) ) );
+		hi->add_crossings_Up();
+		hi->f().add( -22.0 ).add( T[ i ] );
+		hi->h().add( h[ i ], 0.0, 0.0 );
+	}
+}
+
+} // Internal
+
+// Generated Model Name?
+bool
+is_generated( std::string const & name )
+{
+	return
+	 ( name == "gen_grid1d" ) ||
+	 ( name == "gen_grid2d" ) ||
+	 ( name == "gen_grid3d" ) ||
+	 ( name == "gen_random" ) ||
+	 ( name == "gen_chain" ) ||
+	 ( name == "gen_star" ) ||
+	 ( name == "gen_thermostat" );
+}
+
+// Generated Scalable Benchmark Model Setup
+void
+generated( Variables & vars, std::string const & name, Parameters & params )
+{
+	vars.clear();
+	if ( name == "gen_grid1d" ) {
+		grid( vars, 1, params );
+	} else if ( name == "gen_grid2d" ) {
+		grid( vars, 2, params );
+	} else if ( name == "gen_grid3d" ) {
+		grid( vars, 3, params );
+	} else if ( name == "gen_random" ) {
+		random_sparse( vars, params );
+	} else if ( name == "gen_chain" ) {
+		chain( vars, params );
+	} else if ( name == "gen_star" ) {
+		star( vars, params );
+	} else if ( name == "gen_thermostat" ) {
+		thermostat( vars, params );
+	} else {
+		std::cerr << "Error: Unknown generated model: " << name << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+}
+
+} // mdl
+} // dfn
+} // QSS
@@ -0,0 +1,74 @@
+// Generated Scalable Benchmark Model Setup
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_dfn_mdl_generated_hh_INCLUDED
+#define QSS_dfn_mdl_generated_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+namespace QSS {
+namespace dfn {
+namespace mdl {
+
+using Variables = std::vector< Variable * >;
+
+// Generated Model Name?
+bool
+is_generated( std::string const & name );
+
+// Generated Scalable Benchmark Model Setup
+//
+// Sized by --size, coupled by --degree and --dist, seeded by --seed:
+//  gen_grid1d     1-D heat conduction: Laplacian with zero Dirichlet boundaries
+//  gen_grid2d     2-D heat conduction: Side is the nearest integer square root of size
+//  gen_grid3d     3-D heat conduction: Side is the nearest integer cube root of size
+//  gen_random     Random sparse stable system: degree couplings per row, diagonally dominant
+//  gen_chain      Chain driven at its head: x[i]' = x[i-1] - x[i]
+//  gen_star       Star graph: Hub observes every leaf and every leaf observes the hub
+//  gen_thermostat 2-D grid of rooms each with a heater switched by low/high zero-crossings
+void
+generated( Variables & vars, std::string const & name, Parameters & params );
+
+} // mdl
+} // dfn
+} // QSS
+
+#endif
@@ -55,12 +55,15 @@ using Variables = std::vector< Variable * >;
 
 // Nonlinear Derivative Example Setup
 void
-nonlinear( Variables & vars )
+nonlinear( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 5.0;
+	if ( ! params.tEnd_set ) params.tEnd = 5.0;
 
 	// Variables
 	using V = Variable_QSS< Function_nonlinear >;
@@ -89,7 +92,7 @@ nonlinear( Variables & vars )
 	std::ofstream e_stream( "y.e.out" );
 	std::size_t iOut( 0 );
 	double tOut( 0.0 );
-	while ( tOut <= options::tEnd * ( 1.0 + 1.0e-14 ) ) {
+	while ( tOut <= params.tEnd * ( 1.0 + 1.0e-14 ) ) {
 		e_stream << tOut << '\t' << y->d().e( tOut ) << '\n';
 		tOut = ( ++iOut ) * options::dtOut;
 	}
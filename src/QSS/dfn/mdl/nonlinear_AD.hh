@@ -1,4 +1,4 @@
-// FMU-Based QSS Globals
+// Nonlinear Derivative with Automatic Differentiation Example Setup
 //
 // Project: QSS Solver
 //
@@ -33,20 +33,28 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
 // ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-#ifndef QSS_fmu_globals_hh_INCLUDED
-#define QSS_fmu_globals_hh_INCLUDED
+#ifndef QSS_dnf_mdl_nonlinear_AD_hh_INCLUDED
+#define QSS_dnf_mdl_nonlinear_AD_hh_INCLUDED
 
 // QSS Headers
-#include <QSS/fmu/Variable.fwd.hh>
-#include <QSS/EventQueue.fwd.hh>
+#include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
+
+// C++ Headers
+#include <vector>
 
 namespace QSS {
-namespace fmu {
+namespace dfn {
+namespace mdl {
+
+using Variables = std::vector< Variable * >;
 
-// QSS Globals
-extern EventQueue< Variable > events;
+// Nonlinear Derivative with Automatic Differentiation Example Setup
+void
+nonlinear_AD( Variables & vars, Parameters & params );
 
-} // fmu
+} // mdl
+} // dfn
 } // QSS
 
 #endif
@@ -38,6 +38,7 @@
 
 // QSS Headers
 #include <QSS/dfn/Variable.fwd.hh>
+#include <QSS/dfn/mdl/Parameters.hh>
 
 // C++ Headers
 #include <vector>
@@ -50,7 +51,7 @@ using Variables = std::vector< Variable * >;
 
 // Nonlinear Derivative with Numeric Differentiation Example Setup
 void
-nonlinear_ND( Variables & vars );
+nonlinear_ND( Variables & vars, Parameters & params );
 
 } // mdl
 } // dfn
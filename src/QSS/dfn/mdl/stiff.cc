@@ -53,12 +53,15 @@ using Variables = std::vector< Variable * >;
 //
 // Demonstrates LIQSS benefits for stiff systems
 void
-stiff( Variables & vars )
+stiff( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 600.0;
+	if ( ! params.tEnd_set ) params.tEnd = 600.0;
 
 	// Variables
 	using V = Variable_QSS< Function_LTI >;
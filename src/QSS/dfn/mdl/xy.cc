@@ -57,12 +57,15 @@ using Variables = std::vector< Variable * >;
 //	 Q      = 1
 //	 order  = 1
 void
-xy( Variables & vars )
+xy( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 10.0;
+	if ( ! params.tEnd_set ) params.tEnd = 10.0;
 
 	// Variables
 	using V = Variable_QSS< Function_LTI >;
@@ -51,12 +51,15 @@ using Variables = std::vector< Variable * >;
 
 // Simple xyz Example Setup
 void
-xyz( Variables & vars )
+xyz( Variables & vars, Parameters & params )
 {
 	using namespace options;
+	options::QSS const qss( params.qss );
+	double const rTol( params.rTol );
+	double const aTol( params.aTol );
 
 	// Timing
-	if ( ! options::tEnd_set ) options::tEnd = 2.0;
+	if ( ! params.tEnd_set ) params.tEnd = 2.0;
 
 	// Variables
 	using V = Variable_QSS< Function_LTI >;
@@ -0,0 +1,246 @@
+// QSS FMU Ensemble Runner
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/fmu/Ensemble.hh>
+#include <QSS/fmu/simulate_fmu.hh>
+#include <QSS/OutputFilter.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace QSS {
+namespace fmu {
+
+namespace { // Internal
+
+// string is Readable as a Nonnegative double?
+bool
+is_nonnegative_double( std::string const & s, double & v )
+{
+	if ( s.empty() || std::isspace( s[ 0 ] ) ) return false;
+	char * end( nullptr );
+	v = std::strtod( s.c_str(), &end );
+	return ( *end == '\0' ) && ( v >= 0.0 );
+}
+
+// Run a Scenario with the FMU Unpacked to a Directory
+void
+simulate( Ensemble::Scenario const & scenario, std::string const & dir, Ensemble::Result & result, bool const out_values )
+{
+	Simulator::Options opts( scenario.opts );
+	opts.dir = dir;
+	opts.outputs = false; // Scenarios would collide on the output files
+	opts.report = false;
+	std::chrono::steady_clock::time_point const time0( std::chrono::steady_clock::now() );
+	Simulator sim( opts );
+	sim.init();
+	sim.advance_to( sim.tE() );
+	sim.finish();
+	result.seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - time0 ).count();
+	result.results = sim.results();
+	result.rTol = sim.opts().rTol;
+	result.tE = sim.tE();
+	if ( out_values ) {
+		for ( Variable const * var : sim.out_vars() ) {
+			result.names.push_back( var->name );
+			result.x.push_back( var->x( sim.t() ) );
+		}
+	}
+}
+
+} // Internal
+
+// Run the Scenarios on a Number of Threads (0 for Hardware Concurrency)
+void
+Ensemble::
+run( size_type n_threads )
+{
+	size_type const n( scenarios_.size() );
+	results_.assign( n, Result() );
+	bool const out_values( OutputFilter( options::output::include, options::output::exclude ).is_active() ); // Final values only of selected variables
+	if ( n_threads == 0u ) n_threads = std::max( std::thread::hardware_concurrency(), 1u );
+	n_threads_ = std::max( std::min( n_threads, n ), size_type( 1u ) );
+
+	// Workers take the next scenario until none are left: Results are stored by scenario index so their order doesn't depend on scheduling
+	std::atomic< size_type > next( 0u );
+	auto const worker( [this,n,out_values,&next](){
+		std::string const dir( FMU_ME::mk_temp_dir( Simulator::default_dir() ) ); // Worker's unpack directory
+		if ( dir.empty() ) {
+			std::cerr << "Error: Ensemble FMU unpack directory creation failed in " << Simulator::default_dir() << std::endl;
+			std::exit( EXIT_FAILURE );
+		}
+		for ( size_type i = next++; i < n; i = next++ ) {
+			simulate( scenarios_[ i ], dir, results_[ i ], out_values );
+		}
+		FMU_ME::rm_temp_dir( dir );
+	} );
+	std::vector< std::thread > threads;
+	threads.reserve( n_threads_ - 1u );
+	for ( size_type k = 1u; k < n_threads_; ++k ) threads.emplace_back( worker );
+	worker(); // Calling thread is a worker too
+	for ( std::thread & thread : threads ) thread.join();
+}
+
+// Write Summary CSV
+void
+Ensemble::
+write( std::ostream & stream ) const
+{
+	stream << std::setprecision( 16 );
+	stream << "scenario,rTol,aTol,tEnd,discrete_events,QSS_events,QSS_simultaneous_events,ZC_events,seconds";
+	if ( ! results_.empty() ) {
+		for ( std::string const & name : results_.front().names ) stream << ',' << name;
+	}
+	stream << '\n';
+	for ( size_type i = 0, n = std::min( scenarios_.size(), results_.size() ); i < n; ++i ) {
+		Scenario const & scenario( scenarios_[ i ] );
+		Result const & result( results_[ i ] );
+		Simulator::Results const & r( result.results );
+		stream << scenario.name << ',' << result.rTol << ',' << scenario.opts.aTol << ',' << result.tE << ',';
+		stream << r.n_discrete_events << ',' << r.n_QSS_events << ',' << r.n_QSS_simultaneous_events << ',' << r.n_ZC_events << ',' << result.seconds;
+		for ( Value const x : result.x ) stream << ',' << x;
+		stream << '\n';
+	}
+}
+
+// Write Summary CSV File
+bool
+Ensemble::
+write( std::string const & file_name ) const
+{
+	std::ofstream csv( file_name, std::ios_base::binary | std::ios_base::out );
+	if ( ! csv ) {
+		std::cerr << "Error: Ensemble summary file open failed: " << file_name << std::endl;
+		return false;
+	}
+	write( csv );
+	return true;
+}
+
+// Read Scenarios File: One Scenario per Line of name= rTol= aTol= tEnd= Settings
+bool
+Ensemble::
+read( std::string const & file_name, Scenarios & scenarios )
+{
+	std::ifstream in( file_name );
+	if ( ! in ) {
+		std::cerr << "Error: Ensemble file open failed: " << file_name << std::endl;
+		return false;
+	}
+	scenarios.clear();
+	std::string line;
+	size_type n_line( 0u );
+	while ( std::getline( in, line ) ) {
+		++n_line;
+		std::string::size_type const iComment( line.find( '#' ) );
+		if ( iComment != std::string::npos ) line.erase( iComment );
+		std::istringstream settings( line );
+		std::string setting;
+		Scenario scenario;
+		bool any( false );
+		while ( settings >> setting ) {
+			any = true;
+			std::string::size_type const iEq( setting.find( '=' ) );
+			std::string const key( setting.substr( 0u, iEq ) );
+			std::string const val( iEq == std::string::npos ? std::string() : setting.substr( iEq + 1u ) );
+			double v( 0.0 );
+			bool valid( true );
+			if ( key == "name" ) {
+				scenario.name = val;
+				valid = ! val.empty();
+			} else if ( key == "rTol" ) {
+				if ( ( valid = is_nonnegative_double( val, v ) ) ) scenario.opts.rTol = v;
+			} else if ( key == "aTol" ) {
+				if ( ( valid = is_nonnegative_double( val, v ) && ( v > 0.0 ) ) ) scenario.opts.aTol = v;
+			} else if ( key == "tEnd" ) {
+				if ( ( valid = is_nonnegative_double( val, v ) ) ) scenario.opts.tEnd = v;
+			} else { // Generator seeds and initial value overrides are for defined models
+				valid = false;
+			}
+			if ( ! valid ) {
+				std::cerr << "Error: Ensemble file " << file_name << " line " << n_line << ": Invalid FMU setting: " << setting << std::endl;
+				return false;
+			}
+		}
+		if ( ! any ) continue; // Blank or comment line
+		if ( scenario.name.empty() ) scenario.name = std::to_string( scenarios.size() + 1u );
+		scenarios.push_back( scenario );
+	}
+	return true;
+}
+
+// Simulate an FMU Ensemble from the Global Options
+void
+simulate_ensemble()
+{
+	Ensemble::Scenarios scenarios;
+	if ( ! Ensemble::read( options::ensemble, scenarios ) ) std::exit( EXIT_FAILURE );
+	if ( scenarios.empty() ) {
+		std::cerr << "Error: No scenarios in ensemble file: " << options::ensemble << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	Ensemble ensemble( scenarios );
+	std::chrono::steady_clock::time_point const time0( std::chrono::steady_clock::now() );
+	ensemble.run( options::threads );
+	double const seconds( std::chrono::duration< double >( std::chrono::steady_clock::now() - time0 ).count() );
+	if ( ! ensemble.write( "ensemble.csv" ) ) std::exit( EXIT_FAILURE );
+
+	// Reporting
+	double seconds_sum( 0.0 );
+	Simulator::size_type n_QSS_events( 0u );
+	for ( Ensemble::Result const & result : ensemble.results() ) {
+		seconds_sum += result.seconds;
+		n_QSS_events += result.results.n_QSS_events;
+	}
+	std::cout << "\nEnsemble =====" << std::endl;
+	std::cout << scenarios.size() << " FMU scenarios on " << ensemble.n_threads() << " threads" << std::endl;
+	std::cout << n_QSS_events << " total requantization event passes" << std::endl;
+	std::cout << seconds << " s wall time: " << seconds_sum << " s summed over scenarios" << std::endl;
+	if ( seconds_sum > 0.0 ) std::cout << n_QSS_events / seconds_sum << " requantizations per scenario-second" << std::endl;
+}
+
+} // fmu
+} // QSS
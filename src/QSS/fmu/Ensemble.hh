@@ -0,0 +1,153 @@
+// QSS FMU Ensemble Runner
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_fmu_Ensemble_hh_INCLUDED
+#define QSS_fmu_Ensemble_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/fmu/Simulator.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace QSS {
+namespace fmu {
+
+// QSS FMU Ensemble Runner
+//
+// Runs independent scenarios of an FMU concurrently on a pool of threads, each scenario in its
+// own Simulator and FMU instance without file outputs, and collects their event counts, timings,
+// and the final values of the variables selected by the output filter
+//
+// Each thread unpacks the FMU to its own directory so the threads load separate copies of the
+// model library and FMUs with library-level state don't share it across scenarios
+class Ensemble
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = Simulator::Time;
+	using Value = Simulator::Value;
+
+	// Scenario: Options Not Given Take the Global Options
+	struct Scenario
+	{
+		std::string name; // Name
+		Simulator::Options opts; // Simulator options
+	};
+
+	using Scenarios = std::vector< Scenario >;
+
+	// Scenario Result
+	struct Result
+	{
+		Simulator::Results results; // Event pass counts
+		Value rTol{ 0.0 }; // Relative tolerance: The FMU's if not set
+		Time tE{ 0.0 }; // End time
+		double seconds{ 0.0 }; // Wall time (s)
+		std::vector< std::string > names; // Output variable names
+		std::vector< Value > x; // Output variable final continuous values
+	};
+
+	using Results = std::vector< Result >;
+
+public: // Creation
+
+	// Scenarios Constructor
+	explicit
+	Ensemble( Scenarios const & scenarios ) :
+	 scenarios_( scenarios )
+	{}
+
+public: // Properties
+
+	// Scenarios
+	Scenarios const &
+	scenarios() const
+	{
+		return scenarios_;
+	}
+
+	// Results: Same Order as the Scenarios
+	Results const &
+	results() const
+	{
+		return results_;
+	}
+
+	// Threads Used by the Last Run
+	size_type
+	n_threads() const
+	{
+		return n_threads_;
+	}
+
+public: // Methods
+
+	// Run the Scenarios on a Number of Threads (0 for Hardware Concurrency)
+	void
+	run( size_type n_threads = 0u );
+
+	// Write Summary CSV
+	void
+	write( std::ostream & stream ) const;
+
+	// Write Summary CSV File
+	bool
+	write( std::string const & file_name ) const;
+
+public: // Static Methods
+
+	// Read Scenarios File: One Scenario per Line of name= rTol= aTol= tEnd= Settings
+	static
+	bool
+	read( std::string const & file_name, Scenarios & scenarios );
+
+private: // Data
+
+	Scenarios scenarios_; // Scenarios
+	Results results_; // Results
+	size_type n_threads_{ 0u }; // Threads used by the last run
+
+};
+
+} // fmu
+} // QSS
+
+#endif
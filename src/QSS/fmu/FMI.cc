@@ -36,13 +36,153 @@
 // QSS Headers
 #include <QSS/fmu/FMI.hh>
 
+// C++ Headers
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
 namespace QSS {
 namespace fmu {
 
-// Globals
-fmi2_import_t * fmu( nullptr ); // FMU instance
-std::size_t n_ders( 0 ); // Number of derivatives
-fmi2_real_t * derivatives( nullptr ); // Derivatives
+// Destructor
+FMU_ME::
+~FMU_ME()
+{
+	if ( instantiated_ ) {
+		fmi2_import_terminate( fmu_ );
+		fmi2_import_free_instance( fmu_ );
+	}
+	if ( dll_ ) fmi2_import_destroy_dllfmu( fmu_ );
+	if ( fmu_ != nullptr ) fmi2_import_free( fmu_ );
+	if ( context_ != nullptr ) fmi_import_free_context( context_ );
+}
+
+// Load: Unpack the FMU into a Directory, Parse its XML, and Load its Library
+void
+FMU_ME::
+load( std::string const & path, std::string const & dir )
+{
+	assert( context_ == nullptr );
+
+	default_callbacks( callbacks_ );
+	context_ = fmi_import_allocate_context( &callbacks_ );
+	fmi_version_enu_t const fmi_version( fmi_import_get_fmi_version( context_, path.c_str(), dir.c_str() ) );
+	if ( fmi_version != fmi_version_2_0_enu ) {
+		std::cerr << "Error: Only FMI version 2.0 is supported" << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	fmi2_xml_callbacks_t * xml_callbacks( nullptr );
+	fmu_ = fmi2_import_parse_xml( context_, dir.c_str(), xml_callbacks );
+	if ( !fmu_ ) {
+		std::cerr << "Error: FMU XML parsing error" << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	if ( fmi2_import_get_fmu_kind( fmu_ ) == fmi2_fmu_kind_cs ) {
+		std::cerr << "Error: Only FMU ME is supported: Supplied FMU is CS" << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+
+	callBackFunctions_.logger = fmi2_log_forwarding;
+	callBackFunctions_.allocateMemory = std::calloc;
+	callBackFunctions_.freeMemory = std::free;
+	callBackFunctions_.componentEnvironment = fmu_;
+
+	if ( fmi2_import_create_dllfmu( fmu_, fmi2_fmu_kind_me, &callBackFunctions_ ) == jm_status_error ) {
+		std::cerr << "Error: Could not create the FMU library loading mechanism" << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	dll_ = true;
+}
+
+// Instantiate the Model
+void
+FMU_ME::
+instantiate()
+{
+	assert( dll_ );
+	assert( ! instantiated_ );
+	if ( fmi2_import_instantiate( fmu_, "FMU ME model instance", fmi2_model_exchange, 0, 0 ) == jm_status_error ) {
+		std::cerr << "Error: fmi2_import_instantiate failed" << std::endl;
+		std::exit( EXIT_FAILURE );
+	}
+	instantiated_ = true;
+	fmi2_import_set_debug_logging( fmu_, fmi2_false, 0, 0 );
+}
+
+// Initialize: Set Up the Experiment, Run Initialization Mode and the Initial Event Iteration, and Enter Continuous Time Mode
+void
+FMU_ME::
+initialize( Time const tStart, Time const tStop, Value const relativeTolerance, fmi2_event_info_t * eventInfo )
+{
+	assert( instantiated_ );
+	fmi2_boolean_t const toleranceControlled( fmi2_false ); // FMIL says tolerance control not supported for ME
+	fmi2_boolean_t const stopTimeDefined( fmi2_true );
+	fmi2_import_setup_experiment( fmu_, toleranceControlled, relativeTolerance, tStart, stopTimeDefined, tStop );
+
+	fmi2_import_enter_initialization_mode( fmu_ );
+	fmi2_import_exit_initialization_mode( fmu_ );
+
+	eventInfo->newDiscreteStatesNeeded           = fmi2_false;
+	eventInfo->terminateSimulation               = fmi2_false;
+	eventInfo->nominalsOfContinuousStatesChanged = fmi2_false;
+	eventInfo->valuesOfContinuousStatesChanged   = fmi2_true;
+	eventInfo->nextEventTimeDefined              = fmi2_false;
+	eventInfo->nextEventTime                     = -0.0;
+
+	do_event_iteration( eventInfo );
+	fmi2_import_enter_continuous_time_mode( fmu_ );
+}
+
+// Event Iteration: New Discrete States Until None are Needed or Simulation Terminates
+void
+FMU_ME::
+do_event_iteration( fmi2_event_info_t * eventInfo )
+{
+	QSS_INSTRUMENT_PHASE( event_iteration );
+	eventInfo->newDiscreteStatesNeeded = fmi2_true;
+	eventInfo->terminateSimulation     = fmi2_false;
+	while ( eventInfo->newDiscreteStatesNeeded && !eventInfo->terminateSimulation ) {
+		fmi2_import_new_discrete_states( fmu_, eventInfo );
+	}
+}
+
+// Make a New Unpack Directory Under a Directory: Empty if it Can't be Made
+std::string
+FMU_ME::
+mk_temp_dir( std::string const & dir )
+{
+	jm_callbacks callbacks;
+	default_callbacks( callbacks );
+	char * const temp( fmi_import_mk_temp_dir( &callbacks, dir.c_str(), "QSS_" ) );
+	if ( temp == nullptr ) return std::string();
+	std::string const temp_dir( temp );
+	callbacks.free( temp );
+	return temp_dir;
+}
+
+// Remove an Unpack Directory and its Contents
+void
+FMU_ME::
+rm_temp_dir( std::string const & dir )
+{
+	jm_callbacks callbacks;
+	default_callbacks( callbacks );
+	fmi_import_rmdir( &callbacks, dir.c_str() );
+}
+
+// Default FMI Library Callbacks
+void
+FMU_ME::
+default_callbacks( jm_callbacks & callbacks )
+{
+	callbacks.malloc = std::malloc;
+	callbacks.calloc = std::calloc;
+	callbacks.realloc = std::realloc;
+	callbacks.free = std::free;
+	callbacks.logger = jm_default_logger;
+	callbacks.log_level = jm_log_level_warning;
+	callbacks.context = 0;
+}
 
 } // fmu
 } // QSS
@@ -36,12 +36,17 @@
 #ifndef QSS_fmu_FMI_hh_INCLUDED
 #define QSS_fmu_FMI_hh_INCLUDED
 
+// QSS Headers
+#include <QSS/Instrument.hh>
+
 // FMI Library Headers
 #include <fmilib.h>
 
 // C++ Headers
 #include <cassert>
 #include <cstddef>
+#include <string>
+#include <vector>
 
 namespace QSS {
 namespace fmu {
@@ -50,117 +55,209 @@ using Time = double;
 using Value = double;
 using Integer = int;
 
-// Globals
-extern fmi2_import_t * fmu; // FMU instance
-extern std::size_t n_ders; // Number of derivatives
-extern fmi2_real_t * derivatives; // Derivatives
-
-// Set FMU Time
-inline
-void
-set_time( Time const t )
-{
-	assert( fmu != nullptr );
-	fmi2_import_set_time( fmu, t ); //Do Check status returned
-}
-
-// Initialize Derivatives Array Size
-inline
-void
-init_derivatives( std::size_t const n_derivatives )
-{
-	if ( derivatives != nullptr ) delete derivatives;
-	n_ders = n_derivatives;
-	derivatives = new fmi2_real_t[ n_ders ]; // Call cleanup() before exit to prevent apparent "leak"
-}
-
-// Get a Real FMU Variable Value
-inline
-Value
-get_real( fmi2_value_reference_t const ref )
-{
-	assert( fmu != nullptr );
-	Value val;
-	fmi2_import_get_real( fmu, &ref, std::size_t( 1u ), &val ); //Do Check status returned
-	return val;
-}
-
-// Set a Real FMU Variable Value
-inline
-void
-set_real( fmi2_value_reference_t const ref, Value const val )
-{
-	assert( fmu != nullptr );
-	fmi2_import_set_real( fmu, &ref, std::size_t( 1u ), &val ); //Do Check status returned
-}
-
-// Get All Derivatives Array: FMU Time and Variable Values Must be Set First
-inline
-void
-get_derivatives()
-{
-	assert( derivatives != nullptr );
-	fmi2_import_get_derivatives( fmu, derivatives, n_ders );
-}
-
-// Get a Derivative: First call get_derivatives
-inline
-Value
-get_derivative( std::size_t const der_idx )
-{
-	assert( der_idx - 1 < n_ders );
-	return derivatives[ der_idx - 1 ];
-}
-
-// Get an Integer FMU Variable Value
-inline
-Integer
-get_integer( fmi2_value_reference_t const ref )
-{
-	assert( fmu != nullptr );
-	Integer val;
-	fmi2_import_get_integer( fmu, &ref, std::size_t( 1u ), &val ); //Do Check status returned
-	return val;
-}
-
-// Set an Integer FMU Variable Value
-inline
-void
-set_integer( fmi2_value_reference_t const ref, Integer const val )
-{
-	assert( fmu != nullptr );
-	fmi2_import_set_integer( fmu, &ref, std::size_t( 1u ), &val ); //Do Check status returned
-}
-
-// Get an Boolean FMU Variable Value
-inline
-bool
-get_boolean( fmi2_value_reference_t const ref )
-{
-	assert( fmu != nullptr );
-	int val; // FMI2 uses int for booleans
-	fmi2_import_get_boolean( fmu, &ref, std::size_t( 1u ), &val ); //Do Check status returned
-	return static_cast< bool >( val );
-}
-
-// Set an Boolean FMU Variable Value
-inline
-void
-set_boolean( fmi2_value_reference_t const ref, bool const val )
-{
-	assert( fmu != nullptr );
-	int const ival( static_cast< int >( val ) ); // FMI2 uses int for booleans
-	fmi2_import_set_boolean( fmu, &ref, std::size_t( 1u ), &ival ); //Do Check status returned
-}
-
-// Cleanup Allocations
-inline
-void
-cleanup()
+// FMU Model Exchange Instance: FMI Library Context, FMU Handle, and Derivatives
+//
+// Each simulation owns its instance so several FMU simulations can run in one process
+// Instances of one FMU unpack to separate directories so their loads don't collide
+class FMU_ME
 {
-	delete derivatives;
-	derivatives = nullptr;
-}
+
+public: // Creation
+
+	// Default Constructor
+	FMU_ME() = default;
+
+	// Copy Constructor
+	FMU_ME( FMU_ME const & ) = delete;
+
+	// Move Constructor
+	FMU_ME( FMU_ME && ) = delete;
+
+	// Destructor
+	~FMU_ME();
+
+public: // Assignment
+
+	// Copy Assignment
+	FMU_ME &
+	operator =( FMU_ME const & ) = delete;
+
+	// Move Assignment
+	FMU_ME &
+	operator =( FMU_ME && ) = delete;
+
+public: // Predicates
+
+	// Loaded?
+	bool
+	loaded() const
+	{
+		return fmu_ != nullptr;
+	}
+
+public: // Properties
+
+	// FMU Handle
+	fmi2_import_t *
+	fmu() const
+	{
+		return fmu_;
+	}
+
+	// Number of Derivatives
+	std::size_t
+	n_ders() const
+	{
+		return derivatives_.size();
+	}
+
+public: // Methods
+
+	// Load: Unpack the FMU into a Directory, Parse its XML, and Load its Library
+	void
+	load( std::string const & path, std::string const & dir );
+
+	// Instantiate the Model
+	void
+	instantiate();
+
+	// Initialize: Set Up the Experiment, Run Initialization Mode and the Initial Event Iteration, and Enter Continuous Time Mode
+	void
+	initialize( Time const tStart, Time const tStop, Value const relativeTolerance, fmi2_event_info_t * eventInfo );
+
+	// Event Iteration: New Discrete States Until None are Needed or Simulation Terminates
+	void
+	do_event_iteration( fmi2_event_info_t * eventInfo );
+
+	// Set FMU Time
+	void
+	set_time( Time const t )
+	{
+		QSS_INSTRUMENT_PHASE( set_time );
+		assert( fmu_ != nullptr );
+		fmi2_import_set_time( fmu_, t ); //Do Check status returned
+	}
+
+	// Initialize Derivatives Array Size
+	void
+	init_derivatives( std::size_t const n_derivatives )
+	{
+		derivatives_.assign( n_derivatives, fmi2_real_t( 0.0 ) );
+	}
+
+	// Get a Real FMU Variable Value
+	Value
+	get_real( fmi2_value_reference_t const ref ) const
+	{
+		QSS_INSTRUMENT_PHASE( get_real );
+		assert( fmu_ != nullptr );
+		Value val;
+		fmi2_import_get_real( fmu_, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+		return val;
+	}
+
+	// Set a Real FMU Variable Value
+	void
+	set_real( fmi2_value_reference_t const ref, Value const val )
+	{
+		QSS_INSTRUMENT_PHASE( set_real );
+		assert( fmu_ != nullptr );
+		fmi2_import_set_real( fmu_, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+	}
+
+	// Get All Derivatives Array: FMU Time and Variable Values Must be Set First
+	void
+	get_derivatives()
+	{
+		QSS_INSTRUMENT_PHASE( get_derivatives );
+		assert( fmu_ != nullptr );
+		fmi2_import_get_derivatives( fmu_, derivatives_.data(), derivatives_.size() );
+	}
+
+	// Get Event Indicators
+	fmi2_status_t
+	get_event_indicators( fmi2_real_t * const event_indicators, std::size_t const n_event_indicators )
+	{
+		QSS_INSTRUMENT_PHASE( get_event_indicators );
+		assert( fmu_ != nullptr );
+		return fmi2_import_get_event_indicators( fmu_, event_indicators, n_event_indicators );
+	}
+
+	// Get a Derivative: First call get_derivatives
+	Value
+	get_derivative( std::size_t const der_idx ) const
+	{
+		assert( der_idx - 1 < derivatives_.size() );
+		return derivatives_[ der_idx - 1 ];
+	}
+
+	// Get an Integer FMU Variable Value
+	Integer
+	get_integer( fmi2_value_reference_t const ref ) const
+	{
+		assert( fmu_ != nullptr );
+		Integer val;
+		fmi2_import_get_integer( fmu_, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+		return val;
+	}
+
+	// Set an Integer FMU Variable Value
+	void
+	set_integer( fmi2_value_reference_t const ref, Integer const val )
+	{
+		assert( fmu_ != nullptr );
+		fmi2_import_set_integer( fmu_, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+	}
+
+	// Get an Boolean FMU Variable Value
+	bool
+	get_boolean( fmi2_value_reference_t const ref ) const
+	{
+		assert( fmu_ != nullptr );
+		int val; // FMI2 uses int for booleans
+		fmi2_import_get_boolean( fmu_, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+		return static_cast< bool >( val );
+	}
+
+	// Set an Boolean FMU Variable Value
+	void
+	set_boolean( fmi2_value_reference_t const ref, bool const val )
+	{
+		assert( fmu_ != nullptr );
+		int const ival( static_cast< int >( val ) ); // FMI2 uses int for booleans
+		fmi2_import_set_boolean( fmu_, &ref, std::size_t( 1u ), &ival ); //Do Check status returned
+	}
+
+public: // Static Methods
+
+	// Make a New Unpack Directory Under a Directory: Empty if it Can't be Made
+	static
+	std::string
+	mk_temp_dir( std::string const & dir );
+
+	// Remove an Unpack Directory and its Contents
+	static
+	void
+	rm_temp_dir( std::string const & dir );
+
+private: // Static Methods
+
+	// Default FMI Library Callbacks
+	static
+	void
+	default_callbacks( jm_callbacks & callbacks );
+
+private: // Data
+
+	jm_callbacks callbacks_; // FMI Library callbacks: The context holds their address
+	fmi2_callback_functions_t callBackFunctions_; // FMU callbacks
+	fmi_import_context_t * context_{ nullptr }; // FMI Library context
+	fmi2_import_t * fmu_{ nullptr }; // FMU handle
+	bool dll_{ false }; // FMU library loaded?
+	bool instantiated_{ false }; // Model instantiated?
+	std::vector< fmi2_real_t > derivatives_; // Derivatives
+
+};
 
 } // fmu
 } // QSS
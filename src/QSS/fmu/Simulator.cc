@@ -0,0 +1,2056 @@
+// QSS FMU Simulator
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/fmu/Simulator.hh>
+#include <QSS/fmu/Function_Inp_constant.hh>
+#include <QSS/fmu/Function_Inp_sin.hh>
+#include <QSS/fmu/Function_Inp_step.hh>
+#include <QSS/fmu/Function_Inp_toggle.hh>
+#include <QSS/fmu/Variable_B.hh>
+#include <QSS/fmu/Variable_D.hh>
+#include <QSS/fmu/Variable_I.hh>
+#include <QSS/fmu/Variable_Inp1.hh>
+#include <QSS/fmu/Variable_Inp2.hh>
+#include <QSS/fmu/Variable_InpB.hh>
+#include <QSS/fmu/Variable_InpD.hh>
+#include <QSS/fmu/Variable_InpI.hh>
+#include <QSS/fmu/Variable_LIQSS1.hh>
+#include <QSS/fmu/Variable_LIQSS2.hh>
+#include <QSS/fmu/Variable_QSS1.hh>
+#include <QSS/fmu/Variable_QSS2.hh>
+#include <QSS/fmu/Variable_ZC1.hh>
+#include <QSS/fmu/Variable_ZC2.hh>
+#include <QSS/Instrument.hh>
+#include <QSS/math.hh>
+#include <QSS/OutputFilter.hh>
+#include <QSS/OutputPolicy.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace QSS {
+namespace fmu {
+
+namespace { // Internal
+
+// Run a Stage on Variables [b,n) on a Pool
+template< typename Stage >
+void
+parallel_stage( ThreadPool & pool, Variable::Variables const & vars, std::size_t const b, Stage const & stage )
+{
+	assert( b <= vars.size() );
+	std::size_t const n( vars.size() - b );
+	std::size_t const grain( std::max( n / ( 4u * pool.size() ), std::size_t( 1u ) ) );
+	Variable * const * const v( vars.data() + b );
+	pool.parallel_for( n, [v,&stage]( std::size_t const i ){
+		stage( v[ i ] );
+	}, grain );
+}
+
+// Variables Can All Run Concurrently?
+bool
+all_concurrent( Variable::Variables const & vars )
+{
+	return std::all_of( vars.begin(), vars.end(), []( Variable const * v ){ return v->is_concurrent(); } );
+}
+
+// FMU Variable Pointer Union
+union FMUVarPtr { // Support FMU real, integer, and boolean variables
+	fmi2_import_real_variable_t * rvr; // FMU real variable pointer
+	fmi2_import_integer_variable_t * ivr; // FMU integer variable pointer
+	fmi2_import_bool_variable_t * bvr; // FMU boolean variable pointer
+
+	FMUVarPtr( fmi2_import_real_variable_t * rvr ) :
+	 rvr( rvr )
+	{}
+
+	FMUVarPtr( fmi2_import_integer_variable_t * ivr ) :
+	 ivr( ivr )
+	{}
+
+	FMUVarPtr( fmi2_import_bool_variable_t * bvr ) :
+	 bvr( bvr )
+	{}
+
+	friend
+	bool
+	operator ==( FMUVarPtr const & p1, FMUVarPtr const & p2 )
+	{
+		return p1.rvr == p2.rvr;
+	}
+};
+
+// Hash for FMUVarPtr
+struct FMUVarPtrHash
+{
+	std::size_t
+	operator ()( FMUVarPtr const & p ) const
+	{
+		return std::hash< fmi2_import_real_variable_t * >{}( p.rvr );
+	}
+};
+
+} // Internal
+
+// Default Constructor: Global Options
+Simulator::
+Simulator() :
+ Simulator( Options() )
+{}
+
+// Options Constructor
+Simulator::
+Simulator( Options const & opts ) :
+ opts_( opts ),
+ tE_( opts.tEnd )
+{}
+
+// Destructor
+Simulator::
+~Simulator()
+{
+	for ( auto & var : vars_ ) delete var;
+	pool_.reset();
+	worker_fmu_mes_.clear(); // Unload the worker FMU libraries before removing their directories
+	for ( std::string const & dir : worker_dirs_ ) FMU_ME::rm_temp_dir( dir );
+}
+
+// Variable of a Name or nullptr if None
+Variable *
+Simulator::
+var( std::string const & name ) const
+{
+	for ( Variable * var : vars_ ) {
+		if ( var->name == name ) return var;
+	}
+	return nullptr;
+}
+
+// Continuous Value of a Variable at the Current Time
+Simulator::Value
+Simulator::
+x( std::string const & name ) const
+{
+	Variable const * v( var( name ) );
+	if ( v == nullptr ) throw std::invalid_argument( "Unknown variable: " + name );
+	return v->x( t_ );
+}
+
+// Quantized Value of a Variable at the Current Time
+Simulator::Value
+Simulator::
+q( std::string const & name ) const
+{
+	Variable const * v( var( name ) );
+	if ( v == nullptr ) throw std::invalid_argument( "Unknown variable: " + name );
+	return v->q( t_ );
+}
+
+// Initialize: Load the FMU, Build its Variables, Initialize Them, and Open Outputs
+void
+Simulator::
+init()
+{
+	assert( ! initialized_ );
+
+	// I/o setup
+	if ( opts_.report ) {
+		std::cout << std::setprecision( 16 );
+		std::cerr << std::setprecision( 16 );
+	}
+	std::ostream null_out( nullptr ); // Discards setup reports
+	std::ostream & report( opts_.report ? std::cout : null_out );
+
+	// FMU setup
+	fmu_me_.load( opts_.model, opts_.dir );
+	fmi2_import_t * const fmu( fmu_me_.fmu() );
+
+	// Check SI units
+	fmi2_import_unit_definitions_t * unit_defs( fmi2_import_get_unit_definitions( fmu ) );
+	if ( unit_defs != nullptr ) {
+		size_type const n_units( fmi2_import_get_unit_definitions_number( unit_defs ) );
+		report << n_units << " units defined" << std::endl;
+		bool units_error( false );
+		for ( size_type i = 0; i < n_units; ++i ) {
+			fmi2_import_unit_t * unit( fmi2_import_get_unit( unit_defs, static_cast< unsigned >( i ) ) );
+			if ( unit != nullptr ) {
+				double const scl( fmi2_import_get_SI_unit_factor( unit ) );
+				double const del( fmi2_import_get_SI_unit_offset( unit ) );
+				if ( ( scl != 1.0 ) || ( del != 0.0 ) ) {
+					std::cerr << "Error: Non-SI unit present: " << fmi2_import_get_unit_name( unit ) << std::endl;
+					units_error = true;
+				}
+			}
+		}
+		if ( units_error ) std::exit( EXIT_FAILURE );
+	}
+
+	n_states_ = fmi2_import_get_number_of_continuous_states( fmu );
+	report << n_states_ << " continuous variables" << std::endl;
+	n_event_indicators_ = fmi2_import_get_number_of_event_indicators( fmu );
+	report << n_event_indicators_ << " event indicators" << std::endl;
+
+	states_.assign( n_states_, fmi2_real_t( 0.0 ) );
+	event_indicators_.assign( n_event_indicators_, fmi2_real_t( 0.0 ) );
+	event_indicators_prev_.assign( n_event_indicators_, fmi2_real_t( 0.0 ) );
+
+	fmu_me_.instantiate();
+
+	// Don't see an FMIL call to see if DefaultExperiment is present
+	//  The defaults for these 3 values are: 0, 1.0, and 0.0001
+	//  Should provide the user a way to override them along with other controls
+	fmi2_real_t const tstart( fmi2_import_get_default_experiment_start( fmu ) ); // [0.0]
+	fmi2_real_t const tstop( fmi2_import_get_default_experiment_stop( fmu ) ); // [1.0]
+	report << "\nSimulation Time Range:  Start: " << tstart << "  Stop: " << tstop << std::endl;
+	fmi2_real_t const relativeTolerance( fmi2_import_get_default_experiment_tolerance( fmu ) ); // [0.0001]
+	report << "\nRelative Tolerance in FMU: " << relativeTolerance << std::endl;
+
+	// QSS time and tolerance run controls
+	t0_ = tstart; // Simulation start time
+	if ( tE_ == std::numeric_limits< Time >::infinity() ) tE_ = tstop; // Simulation end time
+	t_ = t0_; // Simulation current time
+	tOut_ = t0_ + opts_.dtOut; // Sampling time
+	iOut_ = 1u; // Output step index
+	if ( opts_.rTol == std::numeric_limits< Value >::infinity() ) opts_.rTol = relativeTolerance; // Quantization relative tolerance (FMU doesn't have an absolute tolerance)
+	report << "Relative Tolerance: " << opts_.rTol << std::endl;
+	report << "Absolute Tolerance: " << opts_.aTol << std::endl;
+
+	fmu_me_.initialize( tstart, tstop, relativeTolerance, &eventInfo_ );
+	fmi2_import_get_continuous_states( fmu, states_.data(), n_states_ ); // Should get initial values
+	fmu_me_.get_event_indicators( event_indicators_.data(), n_event_indicators_ );
+
+	// Parallel simultaneous stages: Pool threads 1+ get their own FMU instances initialized like the simulator's
+	if ( ( opts_.fanout > 0u ) && ( ! options::output::d ) ) {
+		if ( n_event_indicators_ > 0u ) { // Event handling changes FMU state that the worker instances wouldn't see
+			report << "Parallel simultaneous stages off: FMU has event indicators" << std::endl;
+		} else {
+			pool_.reset( new ThreadPool( opts_.threads, opts_.deterministic, opts_.pin ) );
+			if ( pool_->size() > 1u ) {
+				for ( size_type k = 1u; k < pool_->size(); ++k ) {
+					std::string const dir( FMU_ME::mk_temp_dir( opts_.dir ) ); // Separate directories so the workers load their own library copies
+					if ( dir.empty() ) {
+						std::cerr << "Error: Worker FMU unpack directory creation failed in " << opts_.dir << std::endl;
+						std::exit( EXIT_FAILURE );
+					}
+					worker_dirs_.push_back( dir );
+					worker_fmu_mes_.emplace_back( new FMU_ME() );
+					FMU_ME & worker_fmu_me( *worker_fmu_mes_.back() );
+					worker_fmu_me.load( opts_.model, dir );
+					worker_fmu_me.instantiate();
+					fmi2_event_info_t worker_eventInfo;
+					worker_fmu_me.initialize( tstart, tstop, relativeTolerance, &worker_eventInfo );
+				}
+				report << "Parallel simultaneous stages on " << pool_->size() << " threads with worker FMU instances" << std::endl;
+			} else {
+				pool_.reset();
+			}
+		}
+	}
+
+	// FMU Query: Model
+	report << "\nModel name: " << fmi2_import_get_model_name( fmu ) << std::endl;
+	report << "Model identifier: " << fmi2_import_get_model_identifier_ME( fmu ) << std::endl;
+
+	// Model setup
+	build();
+	for ( auto var : vars_ ) { // Variables schedule in the simulator's queue and call its FMU instance
+		var->set_queue( events_ );
+		var->set_fmu_me( fmu_me_ );
+	}
+
+	// Size setup
+	size_type const n_vars( vars_.size() );
+	size_type const n_outs( outs_.size() );
+	size_type const n_fmu_outs( fmu_outs_.size() );
+
+	// Output variables and variable-index map setup: Only selected variables pay for output
+	OutputFilter const out_filter( opts_.out.include, opts_.out.exclude );
+	std::unordered_set< Variable * > const fmu_out_vars( outs_.begin(), outs_.end() ); // FMU output causality QSS variables
+	for ( auto var : vars_ ) {
+		if ( ( ( ! opts_.out.fmu_outputs ) || ( fmu_out_vars.find( var ) != fmu_out_vars.end() ) ) && out_filter( var->name ) ) {
+			out_idx_[ var ] = out_vars_.size();
+			out_vars_.push_back( var );
+		}
+	}
+	if ( out_filter.is_active() || opts_.out.fmu_outputs ) report << out_vars_.size() << " of " << n_vars << " variables selected for output" << std::endl;
+
+	// Output selections
+	bool const doOut( opts_.outputs && ( opts_.out.x || opts_.out.q ) ); // Trajectory outputs?
+	doFOut_ = opts_.outputs && opts_.out.f && ( n_outs + n_fmu_outs > 0u );
+	doSOut_ = ( doOut && opts_.out.s ) || doFOut_;
+	doTOut_ = doOut && opts_.out.t;
+	doROut_ = doOut && opts_.out.r;
+	doStats_ = opts_.outputs && options::stats;
+	doSeg_ = opts_.outputs && ( opts_.out.x_segments || opts_.out.q_segments );
+	doTrace_ = opts_.outputs && ( ! options::trace.empty() );
+
+	// Containers of ZC and non-ZC variables
+	Variables vars_ZC;
+	Variables vars_nonZC;
+	int max_QSS_order( 0 );
+	for ( auto var : vars_ ) {
+		if ( var->is_ZC() ) { // ZC variable
+			vars_ZC.push_back( var );
+		} else { // Non-ZC variable
+			vars_nonZC.push_back( var );
+			max_QSS_order = std::max( max_QSS_order, var->order() ); // Max QSS order of non-ZC variables to avoid unnec loop stages
+		}
+	}
+	int const QSS_order_max( max_QSS_order ); // Highest QSS order in use
+	assert( QSS_order_max <= 3 );
+
+	// Variable initialization
+	report << "\nInitialization =====" << std::endl;
+	fmu_me_.set_time( t0_ );
+	for ( auto var : vars_nonZC ) {
+		var->init_0();
+	}
+	for ( auto var : vars_nonZC ) {
+		var->init_1();
+	}
+	if ( QSS_order_max >= 2 ) {
+		fmu_me_.set_time( t_ = t0_ + options::dtNum );
+		for ( auto var : vars_nonZC ) {
+			if ( ! var->is_Discrete() ) var->fmu_set_sn( t_ );
+		}
+		for ( auto var : vars_nonZC ) {
+			var->init_2();
+		}
+	}
+	if ( ! vars_ZC.empty() ) { // ZC variables after to get actual LIQSS2+ quantized reps
+		fmu_me_.set_time( t0_ );
+		for ( auto var : vars_ZC ) {
+			var->init_0();
+		}
+		for ( auto var : vars_ZC ) {
+			var->init_1();
+		}
+		if ( QSS_order_max >= 2 ) {
+			fmu_me_.set_time( t0_ + options::dtNum );
+			for ( auto var : vars_ZC ) {
+				var->init_2();
+			}
+		}
+	}
+	fmu_me_.set_time( t_ = t0_ ); // Probably don't need this
+	if ( options::output::d ) { // Diagnostic output
+		for ( Variable const * var : vars_nonZC ) var->advance_d( '!' );
+		for ( Variable const * var : vars_ZC ) var->advance_d( '!' );
+	}
+
+	// Output initialization
+	if ( opts_.outputs && ( options::format == options::Format::binary ) ) { // Binary output file
+		if ( ! bin_out_.open( "out.bin" ) ) std::exit( EXIT_FAILURE );
+	} else if ( opts_.outputs && ( options::format == options::Format::columnar ) ) { // Columnar output file
+		if ( ! col_out_.open( "out.col" ) ) std::exit( EXIT_FAILURE );
+	}
+	if ( doOut && ( opts_.out.t || opts_.out.r || opts_.out.s ) ) { // t0 QSS outputs
+		for ( auto var : out_vars_ ) { // QSS outputs
+			if ( opts_.out.x ) {
+				x_outs_.emplace_back( var->name + ".x.out", &bin_out_, &col_out_ );
+				x_outs_.back().append( t_, var->x( t_ ) );
+			}
+			if ( opts_.out.q ) {
+				q_outs_.emplace_back( var->name + ".q.out", &bin_out_, &col_out_ );
+				q_outs_.back().append( t_, var->q( t_ ) );
+			}
+		}
+	}
+	if ( doFOut_ ) { // t0 FMU outputs
+		for ( auto const & var : outs_ ) { // FMU QSS variable outputs
+			f_outs_.emplace_back( std::string( fmi2_import_get_variable_name( var->var.var ) ) + ".f.out", &bin_out_, &col_out_ );
+			f_outs_.back().append( t_, var->x( t_ ) );
+		}
+		for ( FMU_Variable const & var : fmu_outs_ ) { // FMU (non-QSS) variable (non-QSS) outputs
+			f_outs_.emplace_back( std::string( fmi2_import_get_variable_name( var.var ) ) + ".f.out", &bin_out_, &col_out_ );
+			f_outs_.back().append( t_, fmu_me_.get_real( var.ref ) );
+		}
+	}
+
+	// Per-variable statistics setup
+	if ( doStats_ ) var_stats_.init( vars_, t0_ );
+
+	// Segment output setup
+	if ( doSeg_ ) {
+		if ( ! seg_out_.open( "out.seg", t0_, opts_.out.x_segments, opts_.out.q_segments ) ) std::exit( EXIT_FAILURE );
+		seg_out_.add_all( out_vars_ );
+	}
+
+	// Event pass tracer setup
+	if ( doTrace_ ) tracer_.open( options::trace );
+
+	// Hardware performance counters setup: Last to count only the simulation loop
+	doPerf_ = opts_.outputs && options::perf && perf_.open();
+
+	initialized_ = true;
+	report << "\nSimulation Loop =====" << std::endl;
+}
+
+// Advance Through Events at or Before a Time (Clipped to the End Time)
+void
+Simulator::
+advance_to( Time const tA )
+{
+	assert( initialized_ );
+	assert( ! finished_ );
+	if ( terminated_ ) return; // FMU requested termination
+	bool const doDOut( options::output::d );
+	if ( OutputPolicy_None::covers( doSOut_, doTOut_, doROut_, doDOut ) ) { // Output-specialized loops
+		advance< OutputPolicy_None >( tA );
+	} else if ( OutputPolicy_Sampled::covers( doSOut_, doTOut_, doROut_, doDOut ) ) {
+		advance< OutputPolicy_Sampled >( tA );
+	} else if ( OutputPolicy_Events::covers( doSOut_, doTOut_, doROut_, doDOut ) ) {
+		advance< OutputPolicy_Events >( tA );
+	} else {
+		advance< OutputPolicy_Diagnostic >( tA );
+	}
+}
+
+// Finish: End Time Outputs, Output Flushes, and Reports
+void
+Simulator::
+finish()
+{
+	assert( initialized_ );
+	assert( ! finished_ );
+
+	// End time outputs and streams close
+	if ( opts_.outputs && ( opts_.out.r || opts_.out.s ) && ( opts_.out.x || opts_.out.q ) ) {
+		QSS_INSTRUMENT_PHASE( output );
+		for ( size_type i = 0, n = out_vars_.size(); i < n; ++i ) {
+			Variable const * var( out_vars_[ i ] );
+			if ( var->tQ < tE_ ) {
+				if ( opts_.out.x ) {
+					x_outs_[ i ].append( tE_, var->x( tE_ ) );
+					x_outs_[ i ].close();
+				}
+				if ( opts_.out.q ) {
+					q_outs_[ i ].append( tE_, var->q( tE_ ) );
+					q_outs_[ i ].close();
+				}
+			}
+		}
+	}
+
+	// tE FMU outputs and streams close
+	if ( doFOut_ ) {
+		size_type const n_outs( outs_.size() );
+		for ( size_type i = 0; i < n_outs; ++i ) { // FMU QSS variable outputs
+			Variable * var( outs_[ i ] );
+			f_outs_[ i ].append( tE_, var->x( tE_ ) );
+			f_outs_[ i ].close();
+		}
+		if ( ! fmu_outs_.empty() ) { // FMU (non-QSS) variable outputs
+			set_states( tE_ );
+			size_type i( n_outs );
+			for ( FMU_Variable const & var : fmu_outs_ ) {
+				f_outs_[ i ].append( tE_, fmu_me_.get_real( var.ref ) );
+				f_outs_[ i++ ].close();
+			}
+		}
+	}
+
+	// Final values
+	for ( Variable const * var : out_vars_ ) {
+		results_.x[ var->name ] = var->x( t_ );
+		results_.q[ var->name ] = var->q( t_ );
+	}
+
+	bin_out_.close(); // Binary output flush
+	col_out_.close(); // Columnar output flush
+	if ( doSeg_ ) seg_out_.close( tE_ ); // Segment output flush
+
+	// Reporting
+	if ( opts_.report ) {
+		std::cout << "\nSimulation Complete =====" << std::endl;
+		if ( results_.n_discrete_events > 0 ) std::cout << results_.n_discrete_events << " discrete event passes" << std::endl;
+		if ( results_.n_QSS_events > 0 ) std::cout << results_.n_QSS_events << " requantization event passes" << std::endl;
+		if ( results_.n_QSS_simultaneous_events > 0 ) std::cout << results_.n_QSS_simultaneous_events << " simultaneous requantization event passes" << std::endl;
+		if ( results_.n_ZC_events > 0 ) std::cout << results_.n_ZC_events << " zero-crossing event passes" << std::endl;
+	}
+	if ( doStats_ ) { // Per-variable statistics
+		if ( opts_.report ) var_stats_.report( std::cout );
+		var_stats_.write( "stats.csv" );
+	}
+	if ( opts_.outputs ) {
+		QSS_INSTRUMENT_REPORT( "instrument.csv" );
+	}
+	if ( doTrace_ ) tracer_.close(); // Trace flush
+	if ( doPerf_ && opts_.report ) perf_.report( std::cout );
+
+	finished_ = true;
+}
+
+// Default FMU Unpack Directory
+std::string
+Simulator::
+default_dir()
+{
+#ifdef _WIN32
+	char const * TEMP( std::getenv( "TEMP" ) );
+	return std::string( TEMP != nullptr ? TEMP : "." );
+#else
+	return std::string( "/tmp" );
+#endif
+}
+
+// Build the Variables and their Dependencies from the FMU
+void
+Simulator::
+build()
+{
+	// Types
+	using FMU_Vars = std::unordered_map< FMUVarPtr, FMU_Variable, FMUVarPtrHash >; // Map from FMU variables to FMU_Variable objects
+	using FMU_Idxs = std::unordered_map< size_type, Variable * >; // Map from FMU variable indexes to QSS Variables
+	using Function = std::function< SmoothToken const &( Time const ) >;
+
+	std::ostream null_out( nullptr ); // Discards setup reports
+	std::ostream & report( opts_.report ? std::cout : null_out );
+	fmi2_import_t * const fmu( fmu_me_.fmu() );
+
+	// Collections
+	FMU_Vars fmu_vars;
+	FMU_Vars fmu_outs;
+	FMU_Vars fmu_ders; // FMU variable to derivative map
+	FMU_Vars fmu_dvrs; // FMU derivative to variable map
+	FMU_Idxs fmu_idxs; // Map from FMU variable index to QSS variable
+
+	// Process FMU variables
+	fmi2_import_variable_list_t * var_list( fmi2_import_get_variable_list( fmu, 0 ) ); // sort order = 0 for original order
+	size_type const n_fmu_vars( fmi2_import_get_variable_list_size( var_list ) );
+	report << "\nFMU Variable Processing: Num FMU Variables: " << n_fmu_vars << " =====" << std::endl;
+	fmi2_value_reference_t const * vrs( fmi2_import_get_value_referece_list( var_list ) ); // reference is misspelled in FMIL API
+	for ( size_type i = 0; i < n_fmu_vars; ++i ) {
+		report << "\nVariable  Index: " << i+1 << " Ref: " << vrs[ i ] << std::endl;
+		fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
+		std::string const var_name( fmi2_import_get_variable_name( var ) );
+		report << " Name: " << var_name << std::endl;
+		report << " Desc: " << ( fmi2_import_get_variable_description( var ) ? fmi2_import_get_variable_description( var ) : "" ) << std::endl;
+		report << " Ref: " << fmi2_import_get_variable_vr( var ) << std::endl;
+		bool const var_has_start( fmi2_import_get_variable_has_start( var ) == 1 );
+		report << " Start? " << var_has_start << std::endl;
+		fmi2_base_type_enu_t var_base_type( fmi2_import_get_variable_base_type( var ) );
+		fmi2_variability_enu_t const var_variability( fmi2_import_get_variability( var ) );
+		fmi2_causality_enu_t const var_causality( fmi2_import_get_causality( var ) );
+		switch ( var_base_type ) {
+		case fmi2_base_type_real:
+			report << " Type: Real" << std::endl;
+			{
+			fmi2_import_real_variable_t * var_real( fmi2_import_get_variable_as_real( var ) );
+			fmi2_real_t const var_start( var_has_start ? fmi2_import_get_real_variable_start( var_real ) : 0.0 );
+			if ( var_has_start ) report << " Start: " << var_start << std::endl;
+			if ( var_causality == fmi2_causality_enu_output ) {
+				report << " Type: Real: Output" << std::endl;
+				fmu_outs[ var_real ] = FMU_Variable( var, var_real, fmi2_import_get_variable_vr( var ), i+1 );
+			}
+			if ( var_variability == fmi2_variability_enu_continuous ) {
+				report << " Type: Real: Continuous" << std::endl;
+				FMU_Variable const fmu_var( var, var_real, fmi2_import_get_variable_vr( var ), i+1 );
+				fmu_vars[ var_real ] = fmu_var;
+				if ( var_causality == fmi2_causality_enu_input ) {
+					report << " Type: Real: Continuous: Input" << std::endl;
+//					Function inp_fxn = Function_Inp_constant( var_start ); // Constant start value
+					Function inp_fxn = Function_Inp_step( 1.0, 1.0, 0.1 ); // Step up by 1 every 0.1 s via discrete events
+//					Function inp_fxn = Function_Inp_sin( 2.0, 10.0, 1.0 ); // 2 * sin( 10 * t ) + 1
+					if ( var_has_start && var_start != inp_fxn( 0.0 ).x_0 ) {
+						std::cerr << "Error: Specified start value does not match function value at t=0 for " << var_name << std::endl;
+						std::exit( EXIT_FAILURE );
+					}
+					Variable_Inp * qss_var( nullptr );
+					if ( ( opts_.qss == options::QSS::QSS1 ) || ( opts_.qss == options::QSS::LIQSS1 ) ) {
+						qss_var = new Variable_Inp1( var_name, opts_.rTol, opts_.aTol, fmu_var, inp_fxn );
+					} else if ( ( opts_.qss == options::QSS::QSS2 ) || ( opts_.qss == options::QSS::LIQSS2 ) ) {
+						qss_var = new Variable_Inp2( var_name, opts_.rTol, opts_.aTol, fmu_var, inp_fxn );
+					} else {
+						std::cerr << "Error: Specified QSS method is not yet supported for FMUs" << std::endl;
+						std::exit( EXIT_FAILURE );
+					}
+					vars_.push_back( qss_var ); // Add to QSS variables
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				}
+			} else if ( var_variability == fmi2_variability_enu_discrete ) {
+				report << " Type: Real: Discrete" << std::endl;
+				FMU_Variable const fmu_var( var, var_real, fmi2_import_get_variable_vr( var ), i+1 );
+				fmu_vars[ var_real ] = fmu_var;
+				if ( var_causality == fmi2_causality_enu_input ) {
+					report << " Type: Real: Discrete: Input" << std::endl;
+//					Function inp_fxn = Function_Inp_constant( var_start ); // Constant start value
+					Function inp_fxn = Function_Inp_step( 1.0, 1.0, 0.1 ); // Step up by 1 every 0.1 s via discrete events
+					Variable_InpD * qss_var( new Variable_InpD( var_name, fmu_var, inp_fxn ) );
+					vars_.push_back( qss_var ); // Add to QSS variables
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				} else {
+					Variable_D * qss_var( new Variable_D( var_name, var_start, fmu_var ) );
+					vars_.push_back( qss_var ); // Add to QSS variables
+					if ( var_causality == fmi2_causality_enu_output ) { // Add to FMU QSS variable outputs
+						outs_.push_back( qss_var );
+						fmu_outs.erase( var_real ); // Remove it from non-QSS FMU outputs
+					}
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				}
+			}
+			}
+			break;
+		case fmi2_base_type_int:
+			report << " Type: Integer" << std::endl;
+			{
+			fmi2_import_integer_variable_t * var_int( fmi2_import_get_variable_as_integer( var ) );
+			int const var_start( var_has_start ? fmi2_import_get_integer_variable_start( var_int ) : 0 );
+			if ( var_has_start ) report << " Start: " << var_start << std::endl;
+			if ( var_variability == fmi2_variability_enu_discrete ) {
+				FMU_Variable const fmu_var( var, var_int, fmi2_import_get_variable_vr( var ), i+1 );
+				fmu_vars[ var_int ] = fmu_var;
+				if ( var_causality == fmi2_causality_enu_input ) {
+					report << " Type: Integer: Discrete: Input" << std::endl;
+//					Function inp_fxn = Function_Inp_constant( var_start ); // Constant start value
+					Function inp_fxn = Function_Inp_step( 1.0, 1.0, 0.1 ); // Step up by 1 every 0.1 s via discrete events
+					Variable_InpI * qss_var( new Variable_InpI( var_name, fmu_var, inp_fxn ) );
+					vars_.push_back( qss_var ); // Add to QSS variables
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				} else {
+					report << " Type: Integer: Discrete" << std::endl;
+					Variable_I * qss_var( new Variable_I( var_name, var_start, fmu_var ) );
+					vars_.push_back( qss_var ); // Add to QSS variables
+					if ( var_causality == fmi2_causality_enu_output ) { // Add to FMU QSS variable outputs
+						outs_.push_back( qss_var );
+						fmu_outs.erase( var_int ); // Remove it from non-QSS FMU outputs
+					}
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				}
+			}
+			}
+			break;
+		case fmi2_base_type_bool:
+			report << " Type: Boolean" << std::endl;
+			{
+			fmi2_import_bool_variable_t * var_bool( fmi2_import_get_variable_as_boolean( var ) );
+			bool const var_start( var_has_start ? fmi2_import_get_boolean_variable_start( var_bool ) : 0 );
+			if ( var_has_start ) report << " Start: " << var_start << std::endl;
+			if ( var_variability == fmi2_variability_enu_discrete ) {
+				FMU_Variable const fmu_var( var, var_bool, fmi2_import_get_variable_vr( var ), i+1 );
+				fmu_vars[ var_bool ] = fmu_var;
+				if ( var_causality == fmi2_causality_enu_input ) {
+					report << " Type: Boolean: Discrete: Input" << std::endl;
+					Function inp_fxn = Function_Inp_toggle( 1.0, 1.0, 0.1 ); // Toggle 0-1 every 0.1 s via discrete events
+					Variable_InpB * qss_var( new Variable_InpB( var_name, fmu_var, inp_fxn ) );
+					vars_.push_back( qss_var ); // Add to QSS variables
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				} else {
+					report << " Type: Boolean: Discrete" << std::endl;
+					Variable_B * qss_var( new Variable_B( var_name, var_start, fmu_var ) );
+					vars_.push_back( qss_var ); // Add to QSS variables
+					if ( var_causality == fmi2_causality_enu_output ) { // Add to FMU QSS variable outputs
+						outs_.push_back( qss_var );
+						fmu_outs.erase( var_bool ); // Remove it from non-QSS FMU outputs
+					}
+					fmu_idxs[ i+1 ] = qss_var; // Add to map from FMU variable index to QSS variable
+					report << " FMU idx: " << i+1 << " maps to QSS var: " << qss_var->name << std::endl;
+				}
+			}
+			}
+			break;
+		case fmi2_base_type_str:
+			report << " Type: String" << std::endl;
+			if ( var_has_start ) report << " Start: " << fmi2_import_get_string_variable_start( fmi2_import_get_variable_as_string( var ) ) << std::endl;
+			break;
+		case fmi2_base_type_enum:
+			report << " Type: Enum" << std::endl;
+			if ( var_has_start ) report << " Start: " << fmi2_import_get_enum_variable_start( fmi2_import_get_variable_as_enum( var ) ) << std::endl;
+			break;
+		default:
+			report << " Type: Unknown" << std::endl;
+			break;
+		}
+		if ( var_variability == fmi2_variability_enu_constant ) {
+			report << " Variability: Constant" << std::endl;
+		} else if ( var_variability == fmi2_variability_enu_fixed ) {
+			report << " Variability: Fixed" << std::endl;
+		} else if ( var_variability == fmi2_variability_enu_tunable ) {
+			report << " Variability: Tunable" << std::endl;
+		} else if ( var_variability == fmi2_variability_enu_discrete ) {
+			report << " Variability: Discrete" << std::endl;
+		} else if ( var_variability == fmi2_variability_enu_continuous ) {
+			report << " Variability: Continuous" << std::endl;
+		} else if ( var_variability == fmi2_variability_enu_unknown ) {
+			report << " Variability: Unknown" << std::endl;
+		}
+		if ( var_causality == fmi2_causality_enu_parameter ) {
+			report << " Causality: Parameter" << std::endl;
+		} else if ( var_causality == fmi2_causality_enu_calculated_parameter ) {
+			report << " Causality: Calculated Parameter" << std::endl;
+		} else if ( var_causality == fmi2_causality_enu_input ) {
+			report << " Causality: Input" << std::endl;
+		} else if ( var_causality == fmi2_causality_enu_output ) {
+			report << " Causality: Output" << std::endl;
+		} else if ( var_causality == fmi2_causality_enu_local ) {
+			report << " Causality: Local" << std::endl;
+		} else if ( var_causality == fmi2_causality_enu_independent ) {
+			report << " Causality: Independent" << std::endl;
+		} else if ( var_causality == fmi2_causality_enu_unknown ) {
+			report << " Causality: Unknown" << std::endl;
+		}
+		fmi2_initial_enu_t const var_initial( fmi2_import_get_initial( var ) );
+		if ( var_initial == fmi2_initial_enu_exact ) {
+			report << " Initial: Exact" << std::endl;
+		} else if ( var_initial == fmi2_initial_enu_approx ) {
+			report << " Initial: Approx" << std::endl;
+		} else if ( var_initial == fmi2_initial_enu_calculated ) {
+			report << " Initial: Calculated" << std::endl;
+		} else if ( var_initial == fmi2_initial_enu_unknown ) {
+			report << " Initial: Unknown" << std::endl;
+		}
+	}
+
+	// Process FMU derivatives
+	fmi2_import_variable_list_t * der_list( fmi2_import_get_derivatives_list( fmu ) );
+	size_type const n_ders( fmi2_import_get_variable_list_size( der_list ) );
+	report << "\nFMU Derivative Processing: Num FMU Derivatives: " << n_ders << " =====" << std::endl;
+	fmi2_value_reference_t const * drs( fmi2_import_get_value_referece_list( der_list ) ); // reference is spelled wrong in FMIL API
+	for ( size_type i = 0, ics = 0; i < n_ders; ++i ) {
+		report << "\nDerivative  Ref: " << drs[ i ] << std::endl;
+		fmi2_import_variable_t * der( fmi2_import_get_variable( der_list, i ) );
+		std::string const der_name( fmi2_import_get_variable_name( der ) );
+		report << " Name: " << der_name << std::endl;
+		report << " Desc: " << ( fmi2_import_get_variable_description( der ) ? fmi2_import_get_variable_description( der ) : "" ) << std::endl;
+		report << " Ref: " << fmi2_import_get_variable_vr( der ) << std::endl;
+		fmi2_base_type_enu_t der_base_type( fmi2_import_get_variable_base_type( der ) );
+		bool const der_start( fmi2_import_get_variable_has_start( der ) == 1 );
+		report << " Start? " << der_start << std::endl;
+		switch ( der_base_type ) {
+		case fmi2_base_type_real:
+			{
+			report << " Type: Real" << std::endl;
+			fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
+			if ( der_start ) report << " Start: " << fmi2_import_get_real_variable_start( der_real ) << std::endl;
+			fmi2_import_real_variable_t * var_real( fmi2_import_get_real_variable_derivative_of( der_real ) );
+			if ( var_real != nullptr ) { // Add to Variable to Derivative Map
+				FMU_Variable & fmu_der( fmu_vars[ der_real ] );
+				FMU_Variable & fmu_var( fmu_vars[ var_real ] );
+				Value const states_initial( states_[ ics ] ); // Initial value from fmi2_import_get_continuous_states()
+				fmu_der.ics = fmu_var.ics = ++ics;
+				fmu_ders[ var_real ] = fmu_der;
+				fmu_dvrs[ der_real ] = fmu_var;
+				std::string const var_name( fmi2_import_get_variable_name( fmu_var.var ) );
+				report << " Initial value of " << var_name << " = " << states_initial << std::endl;
+				bool const start( fmi2_import_get_variable_has_start( fmu_var.var ) == 1 );
+				if ( start ) {
+					Value const var_initial( fmi2_import_get_real_variable_start( var_real ) );
+					if ( var_initial != states_initial ) {
+						std::cerr << "Warning: Initial value from xml specs: " << var_initial << " is not equal to initial value from fmi2GetContinuousStates(): " << states_initial << '\n';
+						std::cerr << "         Using initial value from fmi2GetContinuousStates()" << std::endl;
+					}
+				}
+				Variable_QSS * qss_var( nullptr );
+				if ( opts_.qss == options::QSS::QSS1 ) {
+					qss_var = new Variable_QSS1( var_name, opts_.rTol, opts_.aTol, states_initial, fmu_var, fmu_der );
+				} else if ( opts_.qss == options::QSS::QSS2 ) {
+					qss_var = new Variable_QSS2( var_name, opts_.rTol, opts_.aTol, states_initial, fmu_var, fmu_der );
+				} else if ( opts_.qss == options::QSS::LIQSS1 ) {
+					qss_var = new Variable_LIQSS1( var_name, opts_.rTol, opts_.aTol, states_initial, fmu_var, fmu_der );
+				} else if ( opts_.qss == options::QSS::LIQSS2 ) {
+					qss_var = new Variable_LIQSS2( var_name, opts_.rTol, opts_.aTol, states_initial, fmu_var, fmu_der );
+				} else {
+					std::cerr << "Error: Specified QSS method is not yet supported for FMUs" << std::endl;
+					std::exit( EXIT_FAILURE );
+				}
+				vars_.push_back( qss_var ); // Add to QSS variables
+				if ( fmi2_import_get_causality( fmu_var.var ) == fmi2_causality_enu_output ) { // Add to FMU QSS variable outputs
+					outs_.push_back( qss_var );
+					fmu_outs.erase( fmu_var.rvr ); // Remove it from non-QSS FMU outputs
+				}
+				fmu_idxs[ fmu_var.idx ] = qss_var; // Add to map from FMU variable index to QSS variable
+				report << " FMU idx: " << fmu_var.idx << " maps to QSS var: " << qss_var->name << std::endl;
+			} else {
+				std::cerr << "Error: Derivative missing associated variable: " << der_name << std::endl;
+				std::exit( EXIT_FAILURE );
+			}
+			}
+			break;
+		case fmi2_base_type_int:
+			report << " Type: Integer" << std::endl;
+			if ( der_start ) report << " Start: " << fmi2_import_get_integer_variable_start( fmi2_import_get_variable_as_integer( der ) ) << std::endl;
+			break;
+		case fmi2_base_type_bool:
+			report << " Type: Boolean" << std::endl;
+			if ( der_start ) report << " Start: " << fmi2_import_get_boolean_variable_start( fmi2_import_get_variable_as_boolean( der ) ) << std::endl;
+			break;
+		case fmi2_base_type_str:
+			report << " Type: String" << std::endl;
+			if ( der_start ) report << " Start: " << fmi2_import_get_string_variable_start( fmi2_import_get_variable_as_string( der ) ) << std::endl;
+			break;
+		case fmi2_base_type_enum:
+			report << " Type: Enum" << std::endl;
+			if ( der_start ) report << " Start: " << fmi2_import_get_enum_variable_start( fmi2_import_get_variable_as_enum( der ) ) << std::endl;
+			break;
+		default:
+			report << " Type: Unknown" << std::endl;
+			break;
+		}
+	}
+
+	// Process FMU zero-crossing variables
+	report << "\nFMU Zero Crossing Processing =====" << std::endl;
+	for ( size_type i = 0; i < n_fmu_vars; ++i ) {
+		fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
+		fmi2_base_type_enu_t var_base_type( fmi2_import_get_variable_base_type( var ) );
+		if ( ( fmi2_import_get_variability( var ) == fmi2_variability_enu_continuous ) && ( fmi2_import_get_variable_base_type( var ) == fmi2_base_type_real ) ) {
+			std::string const var_name( fmi2_import_get_variable_name( var ) );
+			if ( ( var_name.find( "__zc_" ) == 0 ) && ( var_name.length() > 5 ) ) { // Zero-crossing variable by convention (temporary work-around)
+				std::string const der_name( "__zc_der_" + var_name.substr( 5 ) );
+				for ( size_type j = 0; j < n_fmu_vars; ++j ) { // Scan FMU variables for matching derivative
+					fmi2_import_variable_t * der( fmi2_import_get_variable( var_list, j ) );
+					fmi2_base_type_enu_t der_base_type( fmi2_import_get_variable_base_type( der ) );
+					if ( ( fmi2_import_get_variability( der ) == fmi2_variability_enu_continuous ) && ( fmi2_import_get_variable_base_type( der ) == fmi2_base_type_real ) ) {
+						if ( fmi2_import_get_variable_name( der ) == der_name ) { // Found derivative
+							fmi2_import_real_variable_t * var_real( fmi2_import_get_variable_as_real( var ) );
+							fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
+							FMU_Variable & fmu_var( fmu_vars[ var_real ] );
+							FMU_Variable & fmu_der( fmu_vars[ der_real ] );
+							if ( ( fmu_ders.find( var_real ) == fmu_ders.end() ) && ( fmu_dvrs.find( der_real ) == fmu_dvrs.end() ) ) { // Not processed above
+								report << "\nZero Crossing Der: " << der_name << " of Var: " << var_name << std::endl;
+								fmu_ders[ var_real ] = fmu_der;
+								fmu_dvrs[ der_real ] = fmu_var;
+								Variable_ZC * qss_var( nullptr );
+								if ( ( opts_.qss == options::QSS::QSS1 ) || ( opts_.qss == options::QSS::LIQSS1 ) ) {
+									qss_var = new Variable_ZC1( var_name, opts_.rTol, opts_.aTol, fmu_var, fmu_der );
+								} else if ( ( opts_.qss == options::QSS::QSS2 ) || ( opts_.qss == options::QSS::LIQSS2 ) ) {
+									qss_var = new Variable_ZC2( var_name, opts_.rTol, opts_.aTol, fmu_var, fmu_der );
+								} else {
+									std::cerr << "Error: Specified QSS method is not yet supported for FMUs" << std::endl;
+									std::exit( EXIT_FAILURE );
+								}
+								vars_.push_back( qss_var ); // Add to QSS variables
+								if ( fmi2_import_get_causality( fmu_var.var ) == fmi2_causality_enu_output ) { // Add to FMU QSS variable outputs
+									outs_.push_back( qss_var );
+									fmu_outs.erase( fmu_var.rvr ); // Remove it from non-QSS FMU outputs
+								}
+								fmu_idxs[ fmu_var.idx ] = qss_var; // Add to map from FMU variable index to QSS variable
+								report << " FMU idx: " << fmu_var.idx << " maps to QSS var: " << qss_var->name << std::endl;
+							}
+							break; // Found derivative so stop scanning
+						}
+					}
+				}
+			}
+		}
+	}
+
+	{ // QSS observer setup: Continuous variables
+		report << "\nObserver Setup: Continuous Variables =====" << std::endl;
+		size_type * startIndex( nullptr );
+		size_type * dependency( nullptr );
+		char * factorKind( nullptr );
+		fmi2_import_get_derivatives_dependencies( fmu, &startIndex, &dependency, &factorKind );
+		if ( startIndex != nullptr ) { // Derivative dependency info present in XML
+			for ( size_type i = 0; i < n_ders; ++i ) {
+				report << "\nDerivative  Ref: " << drs[ i ] << std::endl;
+				fmi2_import_variable_t * der( fmi2_import_get_variable( der_list, i ) );
+				std::string const der_name( fmi2_import_get_variable_name( der ) );
+				report << " Name: " << der_name << std::endl;
+				fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
+				size_type const idx( fmu_dvrs[ der_real ].idx );
+				report << " Var Index: " << idx << std::endl;
+				Variable * var( fmu_idxs[ idx ] );
+				report << " Var: " << var->name << std::endl;
+				for ( size_type j = startIndex[ i ]; j < startIndex[ i + 1 ]; ++j ) {
+					size_type const dep_idx( dependency[ j ] );
+					fmi2_dependency_factor_kind_enu_t const kind( (fmi2_dependency_factor_kind_enu_t)( factorKind[ j ] ) );
+					report << "  Dep Index: " << dep_idx << "  Kind: " << kind << std::endl;
+					if ( dep_idx == 0 ) { // No info: Depends on all (don't support depends on all for now)
+						std::cerr << "   Error: No dependency information provided: Depends-on-all not currently supported" << std::endl;
+					} else { // Process based on kind of dependent
+						if ( kind == fmi2_dependency_factor_kind_dependent ) {
+							report << "  Kind: Dependent" << std::endl;
+						} else if ( kind == fmi2_dependency_factor_kind_constant ) {
+							report << "  Kind: Constant" << std::endl;
+						} else if ( kind == fmi2_dependency_factor_kind_fixed ) {
+							report << "  Kind: Fixed" << std::endl;
+						} else if ( kind == fmi2_dependency_factor_kind_tunable ) {
+							report << "  Kind: Tunable" << std::endl;
+						} else if ( kind == fmi2_dependency_factor_kind_discrete ) {
+							report << "  Kind: Discrete" << std::endl;
+						} else if ( kind == fmi2_dependency_factor_kind_num ) {
+							report << "  Kind: Num" << std::endl;
+						}
+					}
+					auto idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
+					if ( idep != fmu_idxs.end() ) {
+						Variable * dep( idep->second );
+						if ( dep == var ) {
+							report << "  Var: " << dep->name << " is self-observer" << std::endl;
+							var->self_observer = true;
+						} else {
+							report << "  Var: " << dep->name << " has observer " << var->name << std::endl;
+							dep->add_observer( var );
+							if ( ! dep->is_ZC() ) var->add_observee( dep );
+						}
+					} else {
+						//report << "FMU derivative " << der_name << " has dependency with index " << dep_idx << " that is not a QSS variable" << std::endl;
+					}
+				}
+			}
+		} else { // Assume no observers in model (this may not be true: FMI spec says no dependencies => dependent on all)
+			report << "No derivative dependency info in FMU XML" << std::endl;
+		}
+	}
+
+	{ // QSS observer setup: Discrete variables
+		report << "\nObserver Setup: Discrete Variables =====" << std::endl;
+		size_type * startIndex( nullptr );
+		size_type * dependency( nullptr );
+		char * factorKind( nullptr );
+		fmi2_import_variable_list_t * dis_list( fmi2_import_get_discrete_states_list( fmu ) ); // Discrete variables
+		size_type const n_dis_vars( fmi2_import_get_variable_list_size( dis_list ) );
+		report << n_dis_vars << " discrete variables found in DiscreteStates" << std::endl;
+		fmi2_value_reference_t const * dis_vrs( fmi2_import_get_value_referece_list( dis_list ) ); // reference is spelled wrong in FMIL API
+		fmi2_import_get_discrete_states_dependencies( fmu, &startIndex, &dependency, &factorKind );
+		if ( startIndex != nullptr ) { // Discrete dependency info present in XML
+			for ( size_type i = 0; i < n_dis_vars; ++i ) {
+				report << "\nDiscrete Variable  Index: " << i+1 << " Ref: " << dis_vrs[ i ] << std::endl;
+				fmi2_import_variable_t * dis( fmi2_import_get_variable( dis_list, i ) );
+				assert( fmi2_import_get_variability( dis ) == fmi2_variability_enu_discrete );
+				std::string const dis_name( fmi2_import_get_variable_name( dis ) );
+				report << " Name: " << dis_name << std::endl;
+				FMU_Variable * fmu_dis( nullptr );
+				fmi2_base_type_enu_t dis_base_type( fmi2_import_get_variable_base_type( dis ) );
+				switch ( dis_base_type ) {
+				case fmi2_base_type_real:
+					report << " Type: Real" << std::endl;
+					{
+					fmi2_import_real_variable_t * dis_real( fmi2_import_get_variable_as_real( dis ) );
+					fmu_dis = &fmu_vars[ dis_real ];
+					report << " FMU idx: " << fmu_dis->idx << " maps to QSS var: " << fmu_idxs[ fmu_dis->idx ]->name << std::endl;
+					}
+					break;
+				case fmi2_base_type_int:
+					report << " Type: Integer" << std::endl;
+					{
+					fmi2_import_integer_variable_t * dis_int( fmi2_import_get_variable_as_integer( dis ) );
+					fmu_dis = &fmu_vars[ dis_int ];
+					report << " FMU idx: " << fmu_dis->idx << " maps to QSS var: " << fmu_idxs[ fmu_dis->idx ]->name << std::endl;
+					}
+					break;
+				case fmi2_base_type_bool:
+					report << " Type: Boolean" << std::endl;
+					{
+					fmi2_import_bool_variable_t * dis_bool( fmi2_import_get_variable_as_boolean( dis ) );
+					fmu_dis = &fmu_vars[ dis_bool ];
+					report << " FMU idx: " << fmu_dis->idx << " maps to QSS var: " << fmu_idxs[ fmu_dis->idx ]->name << std::endl;
+					}
+					break;
+				case fmi2_base_type_str:
+					report << " Type: String" << std::endl;
+					break;
+				case fmi2_base_type_enum:
+					report << " Type: Enum" << std::endl;
+					break;
+				default:
+					report << " Type: Unknown" << std::endl;
+					break;
+				}
+				auto idis( fmu_idxs.find( fmu_dis->idx ) ); //Do Add support for input variable dependents
+				if ( idis != fmu_idxs.end() ) {
+					Variable * dis_var( idis->second );
+					assert( dis_var->is_Discrete() );
+					for ( size_type j = startIndex[ i ]; j < startIndex[ i + 1 ]; ++j ) {
+						size_type const dep_idx( dependency[ j ] );
+						fmi2_dependency_factor_kind_enu_t const kind( (fmi2_dependency_factor_kind_enu_t)( factorKind[ j ] ) );
+						report << "  Dep Index: " << dep_idx << "  Kind: " << kind << std::endl;
+						if ( dep_idx == 0 ) { // No info: Depends on all (don't support depends on all for now)
+							std::cerr << "   Error: No dependency information provided: Depends-on-all not currently supported" << std::endl;
+						} else { // Process based on kind of dependent
+							if ( kind == fmi2_dependency_factor_kind_dependent ) {
+								report << "  Kind: Dependent" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_constant ) {
+								report << "  Kind: Constant" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_fixed ) {
+								report << "  Kind: Fixed" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_tunable ) {
+								report << "  Kind: Tunable" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_discrete ) {
+								report << "  Kind: Discrete" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_num ) {
+								report << "  Kind: Num" << std::endl;
+							}
+						}
+						auto idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
+						if ( idep != fmu_idxs.end() ) {
+							Variable * dep( idep->second );
+							report << "  Var: " << dep->name << " has observer " << dis_name << std::endl;
+							if ( ! dep->is_ZC() ) {
+								std::cerr << "Error: Discrete variable " << dis_name << " has dependency on non-zero-crossing variable " << dep->name << std::endl;
+								std::exit( EXIT_FAILURE );
+							}
+							if ( dep == dis_var ) {
+								assert( false ); // If dep is ZC it can't be a discrete variable
+							} else {
+								dep->add_observer( dis_var );
+							}
+						} else {
+							//report << "FMU discrete variable " << dis_name << " has dependency with index " << dep_idx << " that is not a QSS variable" << std::endl;
+						}
+					}
+				}
+			}
+		} else { // Assume no discrete variables dependent on ZC variables in model
+			report << "No discrete variable dependency info in FMU XML" << std::endl;
+		}
+	}
+
+	{ // QSS observer setup: Output variables
+		report << "\nObserver Setup: Output Variables =====" << std::endl;
+		size_type * startIndex( nullptr );
+		size_type * dependency( nullptr );
+		char * factorKind( nullptr );
+		fmi2_import_variable_list_t * out_list( fmi2_import_get_outputs_list( fmu ) ); // Output variables
+		size_type const n_out_vars( fmi2_import_get_variable_list_size( out_list ) );
+		report << n_out_vars << " output variables found in OutputStates" << std::endl;
+		fmi2_value_reference_t const * out_vrs( fmi2_import_get_value_referece_list( out_list ) ); // reference is spelled wrong in FMIL API
+		fmi2_import_get_outputs_dependencies( fmu, &startIndex, &dependency, &factorKind );
+		if ( startIndex != nullptr ) { // Dependency info present in XML
+			for ( size_type i = 0; i < n_out_vars; ++i ) {
+				report << "\nOutput Variable  Index: " << i+1 << " Ref: " << out_vrs[ i ] << std::endl;
+				fmi2_import_variable_t * out( fmi2_import_get_variable( out_list, i ) );
+				assert( fmi2_import_get_causality( out ) == fmi2_causality_enu_output );
+				std::string const out_name( fmi2_import_get_variable_name( out ) );
+				report << " Name: " << out_name << std::endl;
+				FMU_Variable * fmu_out( nullptr );
+				fmi2_base_type_enu_t out_base_type( fmi2_import_get_variable_base_type( out ) );
+				switch ( out_base_type ) {
+				case fmi2_base_type_real:
+					report << " Type: Real" << std::endl;
+					{
+					fmi2_import_real_variable_t * out_real( fmi2_import_get_variable_as_real( out ) );
+					fmu_out = &fmu_vars[ out_real ];
+					}
+					break;
+				case fmi2_base_type_int:
+					report << " Type: Integer" << std::endl;
+					break;
+				case fmi2_base_type_bool:
+					report << " Type: Boolean" << std::endl;
+					break;
+				case fmi2_base_type_str:
+					report << " Type: String" << std::endl;
+					break;
+				case fmi2_base_type_enum:
+					report << " Type: Enum" << std::endl;
+					break;
+				default:
+					report << " Type: Unknown" << std::endl;
+					break;
+				}
+				auto iout( fmu_idxs.find( fmu_out->idx ) ); //Do Add support for input variable dependents
+				if ( iout != fmu_idxs.end() ) {
+					report << " FMU idx: " << fmu_out->idx << " maps to QSS var: " << fmu_idxs[ fmu_out->idx ]->name << std::endl;
+					Variable * out_var( iout->second );
+					if ( ! out_var->is_ZC() ) continue; // Don't worry about dependencies of non-ZC output variables on the QSS side
+					for ( size_type j = startIndex[ i ]; j < startIndex[ i + 1 ]; ++j ) {
+						size_type const dep_idx( dependency[ j ] );
+						fmi2_dependency_factor_kind_enu_t const kind( (fmi2_dependency_factor_kind_enu_t)( factorKind[ j ] ) );
+						report << "  Dep Index: " << dep_idx << "  Kind: " << kind << std::endl;
+						if ( dep_idx == 0 ) { // No info: Depends on all (don't support depends on all for now)
+							std::cerr << "   Error: No dependency information provided: Depends-on-all not currently supported" << std::endl;
+						} else { // Process based on kind of dependent
+							if ( kind == fmi2_dependency_factor_kind_dependent ) {
+								report << "  Kind: Dependent" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_constant ) {
+								report << "  Kind: Constant" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_fixed ) {
+								report << "  Kind: Fixed" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_tunable ) {
+								report << "  Kind: Tunable" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_discrete ) {
+								report << "  Kind: Discrete" << std::endl;
+							} else if ( kind == fmi2_dependency_factor_kind_num ) {
+								report << "  Kind: Num" << std::endl;
+							}
+						}
+						auto idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
+						if ( idep != fmu_idxs.end() ) {
+							Variable * dep( idep->second );
+							report << "  Var: " << dep->name << " has observer " << out_name << std::endl;
+							if ( dep == out_var ) {
+								assert( false ); // Output variables can't be self-observers
+							} else {
+								dep->add_observer( out_var );
+								out_var->add_observee( dep );
+							}
+						} else {
+							//report << "FMU output variable " << out_name << " has dependency with index " << dep_idx << " that is not a QSS variable" << std::endl;
+						}
+					}
+				}
+			}
+		} else { // Assume no output variables dependent on ZC variables in model
+			report << "No output variable dependency info in FMU XML" << std::endl;
+		}
+	}
+
+	// Derivatives array
+	fmu_me_.init_derivatives( n_ders );
+
+	// FMU (non-QSS) output variables in a fixed order
+	fmu_outs_.reserve( fmu_outs.size() );
+	for ( auto const & e : fmu_outs ) fmu_outs_.push_back( e.second );
+
+	std::free( var_list );
+	std::free( der_list );
+}
+
+// Advance Through Events at or Before a Time with an Output Policy
+template< typename Policy >
+void
+Simulator::
+advance( Time const tA )
+{
+	// Types
+	using VariableLookup = std::unordered_set< Variable * >; // Fast Variable lookup container
+	using ObserversSet = std::unordered_set< Variable * >; // Simultaneous trigger observers collection
+
+	// Loop state: Members under their loop names
+	Time const t0( t0_ );
+	Time const tE( tE_ );
+	Time & t( t_ );
+	Time & tOut( tOut_ );
+	size_type & iOut( iOut_ );
+	bool const doSOut( Policy::s && doSOut_ );
+	bool const doTOut( Policy::t && doTOut_ );
+	bool const doROut( Policy::r && doROut_ );
+	bool const doDOut( Policy::d && options::output::d );
+	bool const doStats( doStats_ );
+	bool const doSeg( doSeg_ );
+	bool const doTrace( doTrace_ );
+	bool const doPerf( doPerf_ );
+	bool const doPar( pool_ != nullptr ); // Parallel simultaneous stages?
+	size_type const nPar( opts_.fanout ); // Simultaneous triggers or observers for parallel stages
+	FMU_ME & fmu_me( fmu_me_ );
+	fmi2_import_t * const fmu( fmu_me_.fmu() );
+	size_type const n_states( n_states_ );
+	size_type const n_event_indicators( n_event_indicators_ );
+	std::vector< fmi2_real_t > & states( states_ );
+	std::vector< fmi2_real_t > & event_indicators( event_indicators_ );
+	std::vector< fmi2_real_t > & event_indicators_prev( event_indicators_prev_ );
+	fmi2_event_info_t & eventInfo( eventInfo_ );
+	fmi2_boolean_t & callEventUpdate( callEventUpdate_ );
+	fmi2_boolean_t terminateSimulation( fmi2_false );
+	Variables const & outs( outs_ );
+	size_type const n_outs( outs_.size() );
+	std::vector< FMU_Variable > const & fmu_outs( fmu_outs_ );
+	size_type const n_fmu_outs( fmu_outs_.size() );
+	Variables const & out_vars( out_vars_ );
+	size_type const n_out_vars( out_vars_.size() );
+	Var_Idx const & out_idx( out_idx_ );
+	std::vector< Output > & x_outs( x_outs_ );
+	std::vector< Output > & q_outs( q_outs_ );
+	std::vector< Output > & f_outs( f_outs_ );
+	VariableStats< Variable > & var_stats( var_stats_ );
+	SegmentOutput & seg_out( seg_out_ );
+	Tracer & tracer( tracer_ );
+	PerfCounters & perf( perf_ );
+	size_type & n_discrete_events( results_.n_discrete_events );
+	size_type & n_QSS_events( results_.n_QSS_events );
+	size_type & n_QSS_simultaneous_events( results_.n_QSS_simultaneous_events );
+	size_type & n_ZC_events( results_.n_ZC_events );
+
+	// Simulation loop
+	Time const tS( std::min( tA, tE ) ); // Stop time
+	bool perform( true ); // Perform event(s)?
+	while ( perform ) {
+		perform = ( events_.top_time() <= tS );
+		t = ( perform ? events_.top_time() : tS );
+		if ( doSOut ) { // Sampled and/or FMU outputs
+			QSS_INSTRUMENT_PHASE( output );
+			Time const tStop( std::min( t, tS ) );
+			while ( tOut < tStop ) {
+				if ( opts_.out.s ) { // QSS variable outputs
+					for ( size_type i = 0; i < n_out_vars; ++i ) {
+						if ( opts_.out.x ) x_outs[ i ].sample( tOut, out_vars[ i ]->x( tOut ) );
+						if ( opts_.out.q ) q_outs[ i ].sample( tOut, out_vars[ i ]->q( tOut ) );
+					}
+				}
+				if ( doFOut_ ) { // FMU variable outputs
+					for ( size_type i = 0; i < n_outs; ++i ) { // FMU QSS variables
+						Variable * var( outs[ i ] );
+						f_outs[ i ].sample( tOut, var->x( tOut ) );
+					}
+					if ( n_fmu_outs > 0u ) { // FMU (non-QSS) variables
+						set_states( tOut );
+						size_type i( n_outs );
+						for ( FMU_Variable const & var : fmu_outs ) {
+							f_outs[ i++ ].sample( tOut, fmu_me.get_real( var.ref ) );
+						}
+					}
+				}
+				assert( iOut < std::numeric_limits< size_type >::max() );
+				tOut = t0 + ( ++iOut ) * opts_.dtOut;
+			}
+		}
+		if ( perform ) { // Perform event(s)
+			fmu_me.set_time( t );
+			Event< Variable > & event( events_.top() );
+			SuperdenseTime const & s( events_.top_superdense_time() );
+			events_.set_active_time();
+			if ( doTrace ) tracer.begin( s );
+			if ( event.is_discrete() ) { // Discrete event
+				QSS_INSTRUMENT_EVENT( discrete );
+				if ( doPerf ) perf.begin( PerfCounters::discrete );
+				++n_discrete_events;
+				if ( events_.single() ) { // Single trigger
+					Variable * trigger( events_.top_var() );
+					assert( trigger->tD == t );
+					if ( doTOut ) { // Time event variable output: Before discontinuous discrete changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								auto const io( out_idx.find( trigger ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+								}
+								for ( Variable const * observer : trigger->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : trigger->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.t
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					trigger->advance_discrete();
+					if ( doDOut ) {
+						trigger->advance_d( '*' );
+						trigger->advance_observers_d();
+					}
+					if ( doStats ) {
+						var_stats.discrete( trigger, t );
+						var_stats.observers( trigger->observers() );
+					}
+					if ( doSeg ) {
+						seg_out.log( trigger );
+						seg_out.log_all( trigger->observers() );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::discrete, 1u, trigger->observers().size() );
+					if ( doTOut ) { // Time event variable output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								auto const io( out_idx.find( trigger ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+								}
+								for ( Variable const * observer : trigger->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : trigger->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.t
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				} else { // Simultaneous triggers
+					Variables triggers( events_.top_vars() );
+					std::sort( triggers.begin(), triggers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort triggers by order
+					for ( Variable * trigger : triggers ) {
+						trigger->sT = s; // Set trigger superdense time
+					}
+					size_type const iBeg_triggers_2( static_cast< size_type >( std::distance( triggers.begin(), std::find_if( triggers.begin(), triggers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const triggers_order_max( triggers.empty() ? 0 : triggers.back()->order() );
+					VariableLookup const var_lookup( triggers.begin(), triggers.end() );
+					ObserversSet observers_set;
+					for ( Variable * trigger : triggers ) { // Collect observers to avoid duplicate advance calls
+						for ( Variable * observer : trigger->observers() ) {
+							if ( var_lookup.find( observer ) == var_lookup.end() ) observers_set.insert( observer ); // Skip triggers
+						}
+					}
+					Variables observers( observers_set.begin(), observers_set.end() );
+					std::sort( observers.begin(), observers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort observers by order
+					size_type const iBeg_observers_2( static_cast< size_type >( std::distance( observers.begin(), std::find_if( observers.begin(), observers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const order_max( observers.empty() ? triggers_order_max : std::max( triggers_order_max, observers.back()->order() ) );
+					if ( doTOut ) { // Time event output: Before discontinuous discrete changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								for ( Variable const * trigger : triggers ) { // Triggers
+									auto const io( out_idx.find( trigger ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.t
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					for ( Variable * trigger : triggers ) {
+						assert( trigger->tD == t );
+						trigger->advance_discrete_0_1();
+					}
+					if ( order_max >= 2 ) { // 2nd order pass
+						//fmu_me.set_time( t + options::dtNum ); // Set time to t + delta for numeric differentiation // Don't need this until we enable discrete events on QSS variables
+						for ( size_type i = iBeg_triggers_2, n = triggers.size(); i < n; ++i ) {
+							triggers[ i ]->advance_discrete_2();
+						}
+					}
+					if ( doDOut ) {
+						for ( Variable const * trigger : triggers ) trigger->advance_d( '*' );
+					}
+					if ( ! observers.empty() ) { // Observer advance
+						if ( doPar && ( observers.size() >= nPar ) && all_concurrent( observers ) ) { // Parallel stages
+							advance_observers_parallel( observers, iBeg_observers_2, order_max >= 2, t );
+						} else { // Serial stages
+							if ( order_max >= 2 ) fmu_me.set_time( t );
+							for ( Variable * observer : observers ) {
+								observer->advance_observer_simultaneous_1( t );
+							}
+							if ( order_max >= 2 ) { // 2nd order pass
+								Time const tN( t + options::dtNum ); // Set time to t + delta for numeric differentiation
+								fmu_me.set_time( tN );
+								for ( size_type i = iBeg_observers_2, n = observers.size(); i < n; ++i ) {
+									observers[ i ]->advance_observer_simultaneous_2( tN );
+								}
+							}
+						}
+						if ( doDOut ) {
+							for ( Variable * observer : observers ) {
+								observer->advance_observer_d();
+							}
+						}
+					}
+					if ( doStats ) {
+						for ( Variable const * trigger : triggers ) var_stats.discrete( trigger, t );
+						var_stats.observers( observers );
+					}
+					if ( doSeg ) {
+						seg_out.log_all( triggers );
+						seg_out.log_all( observers );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::discrete_simultaneous, triggers.size(), observers.size() );
+					if ( doTOut ) { // Time event output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Time event and/or observer variable output
+							if ( opts_.out.t ) { // Time event variable output
+								for ( Variable const * trigger : triggers ) { // Triggers
+									auto const io( out_idx.find( trigger ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.t ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.t
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			} else if ( event.is_QSS() ) { // QSS requantization event
+				QSS_INSTRUMENT_EVENT( QSS );
+				if ( doPerf ) perf.begin( PerfCounters::QSS );
+				++n_QSS_events;
+				if ( events_.single() ) { // Single trigger
+					Variable * trigger( events_.top_var() );
+					assert( trigger->tE == t );
+					trigger->advance_QSS();
+					if ( doDOut ) {
+						trigger->advance_d( '!' );
+						trigger->advance_observers_d();
+					}
+					if ( doStats ) {
+						var_stats.QSS( trigger, t );
+						var_stats.observers( trigger->observers() );
+					}
+					if ( doSeg ) {
+						seg_out.log( trigger );
+						seg_out.log_all( trigger->observers() );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::QSS, 1u, trigger->observers().size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								auto const io( out_idx.find( trigger ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+								}
+								for ( Variable const * observer : trigger->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : trigger->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.r
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				} else { // Simultaneous triggers
+					++n_QSS_simultaneous_events;
+					Variables triggers( events_.top_vars() );
+					std::sort( triggers.begin(), triggers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort triggers by order
+					Variables triggers_ZC;
+					Variables triggers_nonZC;
+					for ( Variable * trigger : triggers ) {
+						if ( trigger->is_ZC() ) { // ZC variable
+							triggers_ZC.push_back( trigger );
+						} else { // Non-ZC variable
+							triggers_nonZC.push_back( trigger );
+						}
+						trigger->sT = s; // Set trigger superdense time
+					}
+					size_type const iBeg_triggers_nonZC_2( static_cast< size_type >( std::distance( triggers_nonZC.begin(), std::find_if( triggers_nonZC.begin(), triggers_nonZC.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const triggers_ZC_order_max( triggers_ZC.empty() ? 0 : triggers_ZC.back()->order() );
+					int const triggers_nonZC_order_max( triggers_nonZC.empty() ? 0 : triggers_nonZC.back()->order() );
+					VariableLookup const var_lookup( triggers_nonZC.begin(), triggers_nonZC.end() );
+					ObserversSet observers_set;
+					for ( Variable * trigger : triggers_nonZC ) { // Collect observers to avoid duplicate advance calls
+						for ( Variable * observer : trigger->observers() ) {
+							if ( var_lookup.find( observer ) == var_lookup.end() ) observers_set.insert( observer ); // Skip triggers
+						}
+					}
+					Variables observers( observers_set.begin(), observers_set.end() );
+					std::sort( observers.begin(), observers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort observers by order
+					size_type const iBeg_observers_2( static_cast< size_type >( std::distance( observers.begin(), std::find_if( observers.begin(), observers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const nonZC_order_max( observers.empty() ? triggers_nonZC_order_max : std::max( triggers_nonZC_order_max, observers.back()->order() ) );
+					if ( doPar && ( triggers_nonZC.size() >= nPar ) && all_concurrent( triggers_nonZC ) ) { // Parallel stages
+						// Each pool thread sets the FMU inputs of its triggers in its own FMU instance: Quantized coefficient and queue updates follow in trigger order
+						size_type const n( triggers_nonZC.size() );
+						parallel_stage( *pool_, triggers_nonZC, 0u, [t]( Variable * trigger ){ assert( trigger->tE == t ); trigger->advance_QSS_0(); } );
+						set_fmu_times( t );
+						parallel_stage( *pool_, triggers_nonZC, 0u, [this]( Variable * trigger ){ trigger->advance_QSS_1_deferred( thread_fmu_me() ); } );
+						for ( Variable * trigger : triggers_nonZC ) {
+							trigger->advance_QSS_deferred( 1 );
+						}
+						if ( nonZC_order_max >= 2 ) { // 2nd order pass
+							set_fmu_times( t + options::dtNum ); // Set time to t + delta for numeric differentiation
+							parallel_stage( *pool_, triggers_nonZC, iBeg_triggers_nonZC_2, [this]( Variable * trigger ){ trigger->advance_QSS_2_deferred( thread_fmu_me() ); } );
+							for ( size_type i = iBeg_triggers_nonZC_2; i < n; ++i ) {
+								triggers_nonZC[ i ]->advance_QSS_deferred( 2 );
+							}
+						}
+					} else { // Serial stages
+						for ( Variable * trigger : triggers_nonZC ) {
+							assert( trigger->tE == t );
+							trigger->advance_QSS_0();
+						}
+						for ( Variable * trigger : triggers_nonZC ) {
+							trigger->advance_QSS_1();
+						}
+						if ( nonZC_order_max >= 2 ) { // 2nd order pass
+							fmu_me.set_time( t + options::dtNum ); // Set time to t + delta for numeric differentiation
+							for ( size_type i = iBeg_triggers_nonZC_2, n = triggers_nonZC.size(); i < n; ++i ) {
+								triggers_nonZC[ i ]->advance_QSS_2();
+							}
+						}
+					}
+					if ( ! triggers_ZC.empty() ) { // ZC variables after to get actual LIQSS2+ quantized reps
+						if ( nonZC_order_max >= 2 ) fmu_me.set_time( t );
+						for ( Variable * trigger : triggers_ZC ) {
+							assert( trigger->tE == t );
+							trigger->advance_QSS_0();
+						}
+						fmu_me.set_time( t + options::dtNum ); // Set time to t + delta for numeric differentiation
+						for ( Variable * trigger : triggers_ZC ) {
+							trigger->advance_QSS_1();
+						}
+						if ( triggers_ZC_order_max >= 2 ) {
+							fmu_me.set_time( t - options::dtNum ); // Set time to t - delta for numeric differentiation
+							for ( Variable * trigger : triggers_ZC ) {
+								trigger->advance_QSS_2();
+							}
+						}
+					}
+					if ( doDOut ) {
+						for ( Variable const * trigger : triggers_nonZC ) trigger->advance_d( '=' );
+						for ( Variable const * trigger : triggers_ZC ) trigger->advance_d( '=' );
+					}
+					if ( ! observers.empty() ) { // Observer advance
+						if ( doPar && ( observers.size() >= nPar ) && all_concurrent( observers ) ) { // Parallel stages
+							advance_observers_parallel( observers, iBeg_observers_2, nonZC_order_max >= 2, t );
+						} else { // Serial stages
+							if ( ( nonZC_order_max >= 2 ) || ( ! triggers_ZC.empty() ) ) fmu_me.set_time( t );
+							for ( Variable * observer : observers ) {
+								observer->advance_observer_simultaneous_1( t );
+							}
+							if ( nonZC_order_max >= 2 ) { // 2nd order pass
+								Time const tN( t + options::dtNum ); // Set time to t + delta for numeric differentiation
+								fmu_me.set_time( tN );
+								for ( size_type i = iBeg_observers_2, n = observers.size(); i < n; ++i ) {
+									observers[ i ]->advance_observer_simultaneous_2( tN );
+								}
+							}
+						}
+						if ( doDOut ) {
+							for ( Variable * observer : observers ) {
+								observer->advance_observer_d();
+							}
+						}
+					}
+					if ( doStats ) {
+						for ( Variable const * trigger : triggers ) var_stats.QSS( trigger, t );
+						var_stats.observers( observers );
+					}
+					if ( doSeg ) {
+						seg_out.log_all( triggers );
+						seg_out.log_all( observers );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::QSS_simultaneous, triggers.size(), observers.size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								for ( Variable const * trigger : triggers ) { // Triggers
+									auto const io( out_idx.find( trigger ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, trigger->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, trigger->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.r
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			} else if ( event.is_ZC() ) { // Zero-crossing event
+				QSS_INSTRUMENT_EVENT( ZC );
+				if ( doPerf ) perf.begin( PerfCounters::ZC );
+				++n_ZC_events;
+				size_type n_ZC_triggers( 0u );
+				while ( events_.top_superdense_time() == s ) {
+					Variable * trigger( events_.top_var() );
+					assert( trigger->tZC() == t );
+					if ( doDOut ) std::cout << "Z " << trigger->name << '(' << t << ')' << '\n';
+					trigger->advance_ZC();
+					if ( doStats ) var_stats.ZC( trigger );
+					++n_ZC_triggers;
+				}
+				if ( doTrace ) tracer.end( Tracer::Type::ZC, n_ZC_triggers, 0u );
+			} else if ( event.is_handler() ) { // Zero-crossing handler event
+				QSS_INSTRUMENT_EVENT( handler );
+				if ( doPerf ) perf.begin( PerfCounters::handler );
+
+				// Perform FMU event mode handler processing /////
+
+				// Advance FMU time to help it detect zero crossing event
+				fmu_me.set_time( t + options::dtZC );
+
+				event_indicators.swap( event_indicators_prev ); // Swap so that we can get new indicators
+				fmi2_status_t fmistatus = fmu_me.get_event_indicators( event_indicators.data(), n_event_indicators );
+
+				// Check if an event indicator has triggered
+				bool zero_crossing_event( false );
+				for ( size_type k = 0; k < n_event_indicators; ++k ) {
+					if ( ( event_indicators[ k ] > 0 ) != ( event_indicators_prev[ k ] > 0 ) ) {
+						zero_crossing_event = true;
+						break;
+					}
+				}
+
+				// Handle zero-crossing events
+				if ( callEventUpdate || zero_crossing_event ) {
+					fmistatus = fmi2_import_enter_event_mode( fmu );
+					fmu_me.do_event_iteration( &eventInfo );
+					fmistatus = fmi2_import_enter_continuous_time_mode( fmu );
+					fmistatus = fmi2_import_get_continuous_states( fmu, states.data(), n_states );
+					fmistatus = fmu_me.get_event_indicators( event_indicators.data(), n_event_indicators );
+					if ( doDOut ) std::cout << "Zero-crossing triggers FMU event at t=" << t << std::endl;
+				} else {
+					if ( doDOut ) std::cout << "Zero-crossing does not trigger FMU event at t=" << t << std::endl;
+				}
+
+				// Restore FMU simulation time
+				fmu_me.set_time( t );
+
+				// Perform handler operations on QSS side
+				if ( events_.single() ) { // Single handler
+					if ( doROut ) { // Requantization output: Before discontinuous handler changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							Variable const * handler( event.var() );
+							if ( opts_.out.r ) { // Requantization variable output
+								auto const io( out_idx.find( handler ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+								}
+								for ( Variable const * observer : handler->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : handler->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.r
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					event.var()->advance_handler( t );
+					if ( doDOut ) {
+						event.var()->advance_d( '*' );
+						event.var()->advance_observers_d();
+					}
+					if ( doStats ) {
+						var_stats.handler( event.var(), t );
+						var_stats.observers( event.var()->observers() );
+					}
+					if ( doSeg ) {
+						seg_out.log( event.var() );
+						seg_out.log_all( event.var()->observers() );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::handler, 1u, event.var()->observers().size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							Variable const * handler( event.var() );
+							if ( opts_.out.r ) { // Requantization variable output
+								auto const io( out_idx.find( handler ) );
+								if ( io != out_idx.end() ) {
+									size_type const i( io->second );
+									if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+									if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+								}
+								for ( Variable const * observer : handler->observers() ) {
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : handler->observers() ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.r
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				} else { // Simultaneous handlers
+					Events tops( events_.top_events() );
+					Variables handlers;
+					handlers.reserve( tops.size() );
+					for ( auto & e : tops ) handlers.push_back( e.var() );
+					std::sort( handlers.begin(), handlers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort handlers by order
+					size_type const iBeg_handlers_1( static_cast< size_type >( std::distance( handlers.begin(), std::find_if( handlers.begin(), handlers.end(), []( Variable * v ){ return v->order() >= 1; } ) ) ) );
+					size_type const iBeg_handlers_2( static_cast< size_type >( std::distance( handlers.begin(), std::find_if( handlers.begin(), handlers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const handlers_order_max( handlers.empty() ? 0 : handlers.back()->order() );
+					VariableLookup const var_lookup( handlers.begin(), handlers.end() );
+					ObserversSet observers_set;
+					for ( Variable * handler : handlers ) { // Collect observers to avoid duplicate advance calls
+						for ( Variable * observer : handler->observers() ) {
+							if ( var_lookup.find( observer ) == var_lookup.end() ) observers_set.insert( observer ); // Skip handlers
+						}
+					}
+					Variables observers( observers_set.begin(), observers_set.end() );
+					std::sort( observers.begin(), observers.end(), []( Variable * v1, Variable * v2 ){ return v1->order() < v2->order(); } ); // Sort observers by order
+					size_type const iBeg_observers_2( static_cast< size_type >( std::distance( observers.begin(), std::find_if( observers.begin(), observers.end(), []( Variable * v ){ return v->order() >= 2; } ) ) ) );
+					int const ho_order_max( observers.empty() ? handlers_order_max : std::max( handlers_order_max, observers.back()->order() ) );
+					if ( doROut ) { // Requantization output: Before discontinuous handler changes
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								for ( Variable const * handler : handlers ) {
+									auto const io( out_idx.find( handler ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.r
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+					for ( auto & e : tops ) {
+						e.var()->advance_handler_0( t );
+					}
+					for ( Variable * observer : observers ) {
+						observer->advance_observer_simultaneous_1( t );
+					}
+					for ( size_type i = iBeg_handlers_1, n = handlers.size(); i < n; ++i ) {
+						handlers[ i ]->advance_handler_1();
+					}
+					if ( ho_order_max >= 2 ) { // 2nd order pass
+						Time const tN( t + options::dtNum ); // Advance time to t + delta for numeric differentiation
+						fmu_me.set_time( tN );
+						for ( size_type i = iBeg_observers_2, n = observers.size(); i < n; ++i ) {
+							observers[ i ]->advance_observer_simultaneous_2( tN );
+						}
+						for ( size_type i = iBeg_handlers_2, n = handlers.size(); i < n; ++i ) {
+							handlers[ i ]->advance_handler_2();
+						}
+					}
+					if ( doDOut ) {
+						for ( Variable const * handler : handlers ) handler->advance_d( '*' );
+						for ( Variable * observer : observers ) {
+							observer->advance_observer_d();
+						}
+					}
+					if ( doStats ) {
+						for ( Variable const * handler : handlers ) var_stats.handler( handler, t );
+						var_stats.observers( observers );
+					}
+					if ( doSeg ) {
+						seg_out.log_all( handlers );
+						seg_out.log_all( observers );
+					}
+					if ( doTrace ) tracer.end( Tracer::Type::handler_simultaneous, handlers.size(), observers.size() );
+					if ( doROut ) { // Requantization output
+						QSS_INSTRUMENT_PHASE( output );
+						if ( opts_.out.a ) { // All variables output
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( opts_.out.x ) x_outs[ i ].append( t, out_vars[ i ]->x( t ) );
+								if ( opts_.out.q ) q_outs[ i ].append( t, out_vars[ i ]->q( t ) );
+							}
+						} else { // Requantization and/or observer variable output
+							if ( opts_.out.r ) { // Requantization variable output
+								for ( Variable const * handler : handlers ) {
+									auto const io( out_idx.find( handler ) );
+									if ( io != out_idx.end() ) {
+										size_type const i( io->second );
+										if ( opts_.out.x ) x_outs[ i ].append( t, handler->x( t ) );
+										if ( opts_.out.q ) q_outs[ i ].append( t, handler->q( t ) );
+									}
+								}
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( observer->is_ZC() ) { // Zero-crossing variables requantize in observer advance
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											if ( opts_.out.x ) x_outs[ i ].append( t, observer->x( t ) );
+											if ( opts_.out.q ) q_outs[ i ].append( t, observer->q( t ) );
+										}
+									}
+								}
+							}
+							if ( ( opts_.out.o ) && ( opts_.out.x ) ) { // Observer variable output
+								for ( Variable const * observer : observers ) { // Zero-crossing observer output
+									if ( ( ! opts_.out.r ) || ( ! observer->is_ZC() ) ) { // ZC observers output above if opts_.out.r
+										auto const io( out_idx.find( observer ) );
+										if ( io != out_idx.end() ) {
+											size_type const i( io->second );
+											x_outs[ i ].append( t, observer->x( t ) );
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			} else { // Unsupported event
+				assert( false );
+			}
+			if ( doPerf ) perf.end();
+
+			// FMU end of step processing
+// Not sure we need to set continuous states: It would be a performance hit
+//			set_states( t );
+			fmi2_import_completed_integrator_step( fmu, fmi2_true, &callEventUpdate, &terminateSimulation );
+			if ( eventInfo.terminateSimulation || terminateSimulation ) { // FMU requested termination
+				terminated_ = true;
+				break;
+			}
+		}
+	}
+}
+
+// Set the FMU Continuous States to the Variables' Values at a Time
+void
+Simulator::
+set_states( Time const t )
+{
+	fmu_me_.set_time( t );
+	for ( size_type i = 0; i < n_states_; ++i ) {
+		states_[ i ] = vars_[ i ]->x( t );
+	}
+	fmi2_import_set_continuous_states( fmu_me_.fmu(), states_.data(), n_states_ );
+}
+
+// Set the Time of the FMU Instances: The Simulator's and the Workers'
+void
+Simulator::
+set_fmu_times( Time const t )
+{
+	fmu_me_.set_time( t );
+	for ( auto & worker_fmu_me : worker_fmu_mes_ ) worker_fmu_me->set_time( t );
+}
+
+// FMU Instance of the Current Pool Thread
+FMU_ME &
+Simulator::
+thread_fmu_me()
+{
+	size_type const k( ThreadPool::thread_index() );
+	assert( k <= worker_fmu_mes_.size() );
+	return ( k == 0u ? fmu_me_ : *worker_fmu_mes_[ k - 1u ] );
+}
+
+// Advance Simultaneous Observers in Parallel Stages: Event Queue Updates in Observer Order
+//
+// Observer advances don't change the quantized representations that the observers' FMU inputs
+// are set from so each stage runs on the pool and then the deferred queue updates are made
+void
+Simulator::
+advance_observers_parallel( Variables const & observers, size_type const iBeg_observers_2, bool const order_2, Time const t )
+{
+	assert( pool_ );
+	set_fmu_times( t );
+	parallel_stage( *pool_, observers, 0u, [this,t]( Variable * observer ){ observer->advance_observer_simultaneous_1_deferred( thread_fmu_me(), t ); } );
+	for ( Variable * observer : observers ) {
+		observer->advance_observer_deferred( 1 );
+	}
+	if ( order_2 ) { // 2nd order pass
+		Time const tN( t + options::dtNum ); // Set time to t + delta for numeric differentiation
+		set_fmu_times( tN );
+		parallel_stage( *pool_, observers, iBeg_observers_2, [this,tN]( Variable * observer ){ observer->advance_observer_simultaneous_2_deferred( thread_fmu_me(), tN ); } );
+		for ( size_type i = iBeg_observers_2, n = observers.size(); i < n; ++i ) {
+			observers[ i ]->advance_observer_deferred( 2 );
+		}
+	}
+}
+
+} // fmu
+} // QSS
@@ -0,0 +1,372 @@
+// QSS FMU Simulator
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_fmu_Simulator_hh_INCLUDED
+#define QSS_fmu_Simulator_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/fmu/FMI.hh>
+#include <QSS/fmu/FMU_Variable.hh>
+#include <QSS/fmu/Variable.hh>
+#include <QSS/BinaryOutput.hh>
+#include <QSS/ColumnarOutput.hh>
+#include <QSS/EventQueue.hh>
+#include <QSS/options.hh>
+#include <QSS/Output.hh>
+#include <QSS/PerfCounters.hh>
+#include <QSS/SegmentOutput.hh>
+#include <QSS/ThreadPool.hh>
+#include <QSS/Tracer.hh>
+#include <QSS/VariableStats.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+namespace fmu {
+
+// QSS FMU Simulator
+//
+// Owns an FMU instance, its variables, event queue, outputs, and loop state so a process can hold several
+// FMU simulations and step each incrementally: init() then advance_to() calls then finish()
+//
+// The variables schedule their events in the simulator's queue and call the simulator's FMU instance
+// through their pointers so Simulators don't share an FMU handle or queue
+//
+// Simultaneous trigger and observer stages can run on a pool whose threads each have their own FMU
+// instance, unpacked to its own directory under the simulator's directory, so the derivative calls
+// of a stage run concurrently: FMUs with event indicators stay serial since their event handling
+// changes FMU state that only the simulator's instance sees
+//
+// The FMU unpacks to the simulator's directory, which must differ between concurrent simulations;
+// the numeric differentiation and zero-crossing steps, output format, and diagnostic output are
+// taken from the global options, which must not change while simulations run
+class Simulator
+{
+
+public: // Types
+
+	using Variables = Variable::Variables;
+	using size_type = Variables::size_type;
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+
+	// Output Selection
+	struct Selection
+	{
+		bool t{ options::output::t }; // Time events?
+		bool r{ options::output::r }; // Requantizations?
+		bool o{ options::output::o }; // Observers?
+		bool a{ options::output::a }; // All variables?
+		bool s{ options::output::s }; // Sampled output?
+		bool f{ options::output::f }; // FMU outputs?
+		bool x{ options::output::x }; // Continuous trajectories?
+		bool q{ options::output::q }; // Quantized trajectories?
+		bool x_segments{ options::output::x_segments }; // Continuous trajectory segments?
+		bool q_segments{ options::output::q_segments }; // Quantized trajectory segments?
+		bool fmu_outputs{ options::output::fmu_outputs }; // Only output FMU output causality variables?
+		std::vector< std::string > include{ options::output::include }; // Variable name patterns to output
+		std::vector< std::string > exclude{ options::output::exclude }; // Variable name patterns not to output
+	};
+
+	// Simulation Options
+	struct Options
+	{
+		std::string model{ options::model }; // FMU file
+		std::string dir{ default_dir() }; // FMU unpack directory
+		options::QSS qss{ options::qss }; // QSS method
+		Value rTol{ options::rTol_set ? options::rTol : std::numeric_limits< Value >::infinity() }; // Relative tolerance: FMU default if infinite
+		Value aTol{ options::aTol }; // Absolute tolerance
+		Time tEnd{ options::tEnd_set ? options::tEnd : std::numeric_limits< Time >::infinity() }; // End time (s): FMU default if infinite
+		Time dtOut{ options::dtOut }; // Sampled and FMU output step (s)
+		std::size_t fanout{ options::fanout }; // Simultaneous triggers or observers for parallel stages: 0 for off
+		std::size_t threads{ options::threads }; // Parallel stage threads: 0 for hardware concurrency
+		bool deterministic{ options::deterministic }; // Deterministic parallel stage scheduling?
+		bool pin{ options::pin }; // Pin parallel stage threads to CPUs?
+		Selection out; // Output selection
+		bool outputs{ true }; // Trajectory, statistics, trace, and counter outputs?
+		bool report{ true }; // Console progress and reports?
+	};
+
+	// Simulation Results: Event Pass Counts and Final Values
+	struct Results
+	{
+		size_type n_discrete_events{ 0u }; // Discrete event passes
+		size_type n_QSS_events{ 0u }; // Requantization event passes
+		size_type n_QSS_simultaneous_events{ 0u }; // Simultaneous requantization event passes
+		size_type n_ZC_events{ 0u }; // Zero-crossing event passes
+		std::map< std::string, Value > x; // Final continuous values of the output variables by name
+		std::map< std::string, Value > q; // Final quantized values of the output variables by name
+	};
+
+private: // Types
+
+	using Events = EventQueue< Variable >::Events;
+	using Var_Idx = std::unordered_map< Variable const *, size_type >; // Map from Variables to their indexes
+
+public: // Creation
+
+	// Default Constructor: Global Options
+	Simulator();
+
+	// Options Constructor
+	explicit
+	Simulator( Options const & opts );
+
+	// Copy Constructor
+	Simulator( Simulator const & ) = delete;
+
+	// Move Constructor
+	Simulator( Simulator && ) = delete;
+
+	// Destructor
+	~Simulator();
+
+public: // Assignment
+
+	// Copy Assignment
+	Simulator &
+	operator =( Simulator const & ) = delete;
+
+	// Move Assignment
+	Simulator &
+	operator =( Simulator && ) = delete;
+
+public: // Predicates
+
+	// Initialized?
+	bool
+	initialized() const
+	{
+		return initialized_;
+	}
+
+	// Finished?
+	bool
+	finished() const
+	{
+		return finished_;
+	}
+
+	// FMU Terminated the Simulation?
+	bool
+	terminated() const
+	{
+		return terminated_;
+	}
+
+public: // Properties
+
+	// Options
+	Options const &
+	opts() const
+	{
+		return opts_;
+	}
+
+	// Current Time
+	Time
+	t() const
+	{
+		return t_;
+	}
+
+	// End Time
+	Time
+	tE() const
+	{
+		return tE_;
+	}
+
+	// Results
+	Results const &
+	results() const
+	{
+		return results_;
+	}
+
+	// FMU Instance
+	FMU_ME const &
+	fmu_me() const
+	{
+		return fmu_me_;
+	}
+
+	// Variables
+	Variables const &
+	vars() const
+	{
+		return vars_;
+	}
+
+	// Output Variables: Selected by the Output Filter
+	Variables const &
+	out_vars() const
+	{
+		return out_vars_;
+	}
+
+	// Variable of a Name or nullptr if None
+	Variable *
+	var( std::string const & name ) const;
+
+	// Continuous Value of a Variable at the Current Time
+	Value
+	x( std::string const & name ) const;
+
+	// Quantized Value of a Variable at the Current Time
+	Value
+	q( std::string const & name ) const;
+
+public: // Methods
+
+	// Initialize: Load the FMU, Build its Variables, Initialize Them, and Open Outputs
+	void
+	init();
+
+	// Advance Through Events at or Before a Time (Clipped to the End Time)
+	void
+	advance_to( Time const tA );
+
+	// Finish: End Time Outputs, Output Flushes, and Reports
+	void
+	finish();
+
+public: // Static Methods
+
+	// Default FMU Unpack Directory
+	static
+	std::string
+	default_dir();
+
+private: // Methods
+
+	// Build the Variables and their Dependencies from the FMU
+	void
+	build();
+
+	// Advance Through Events at or Before a Time with an Output Policy
+	template< typename Policy >
+	void
+	advance( Time const tA );
+
+	// Set the FMU Continuous States to the Variables' Values at a Time
+	void
+	set_states( Time const t );
+
+	// Set the Time of the FMU Instances: The Simulator's and the Workers'
+	void
+	set_fmu_times( Time const t );
+
+	// FMU Instance of the Current Pool Thread
+	FMU_ME &
+	thread_fmu_me();
+
+	// Advance Simultaneous Observers in Parallel Stages: Event Queue Updates in Observer Order
+	void
+	advance_observers_parallel( Variables const & observers, size_type const iBeg_observers_2, bool const order_2, Time const t );
+
+private: // Data
+
+	Options opts_; // Options
+	bool initialized_{ false }; // Initialized?
+	bool finished_{ false }; // Finished?
+	bool terminated_{ false }; // FMU terminated the simulation?
+
+	// FMU
+	FMU_ME fmu_me_; // FMU instance
+	size_type n_states_{ 0u }; // Number of continuous states
+	size_type n_event_indicators_{ 0u }; // Number of event indicators
+	std::vector< fmi2_real_t > states_; // Continuous states
+	std::vector< fmi2_real_t > event_indicators_; // Event indicators
+	std::vector< fmi2_real_t > event_indicators_prev_; // Previous event indicators
+	fmi2_event_info_t eventInfo_; // Event iteration info
+	fmi2_boolean_t callEventUpdate_{ fmi2_false }; // Event update requested by the FMU at the last step?
+
+	// Parallel simultaneous stages
+	std::unique_ptr< ThreadPool > pool_; // Parallel stage pool
+	std::vector< std::unique_ptr< FMU_ME > > worker_fmu_mes_; // FMU instances of pool threads 1+
+	std::vector< std::string > worker_dirs_; // Unpack directories of the worker FMU instances
+
+	// Model
+	Variables vars_; // Variables
+	Variables outs_; // FMU output causality variables
+	std::vector< FMU_Variable > fmu_outs_; // FMU (non-QSS) output variables
+	EventQueue< Variable > events_; // Event queue of the variables
+
+	// Timing
+	Time t0_{ 0.0 }; // Start time
+	Time tE_{ 0.0 }; // End time
+	Time t_{ 0.0 }; // Current time
+	Time tOut_{ 0.0 }; // Sampling time
+	size_type iOut_{ 1u }; // Output step index
+
+	// Outputs
+	bool doSOut_{ false }; // Sampled and/or FMU outputs?
+	bool doTOut_{ false }; // Time event outputs?
+	bool doROut_{ false }; // Requantization outputs?
+	bool doFOut_{ false }; // FMU outputs?
+	Variables out_vars_; // Output variables
+	Var_Idx out_idx_; // Output variable indexes
+	BinaryOutput bin_out_; // Binary output file
+	ColumnarOutput col_out_; // Columnar output file
+	std::vector< Output > x_outs_; // Continuous outputs
+	std::vector< Output > q_outs_; // Quantized outputs
+	std::vector< Output > f_outs_; // FMU outputs
+	SegmentOutput seg_out_; // Segment output
+	bool doSeg_{ false }; // Segment output?
+
+	// Instrumentation
+	VariableStats< Variable > var_stats_; // Per-variable statistics
+	bool doStats_{ false }; // Per-variable statistics?
+	Tracer tracer_; // Event pass tracer
+	bool doTrace_{ false }; // Event pass tracing?
+	PerfCounters perf_; // Hardware performance counters
+	bool doPerf_{ false }; // Hardware performance counters?
+
+	Results results_; // Results
+
+};
+
+} // fmu
+} // QSS
+
+#endif
@@ -40,7 +40,6 @@
 #include <QSS/fmu/Variable.fwd.hh>
 #include <QSS/fmu/FMI.hh>
 #include <QSS/fmu/FMU_Variable.hh>
-#include <QSS/fmu/globals_fmu.hh>
 #include <QSS/EventQueue.hh>
 #include <QSS/math.hh>
 #include <QSS/options.hh>
@@ -218,6 +217,14 @@ public: // Predicate
 		return false;
 	}
 
+	// Advances Can Run Concurrently on Separate FMU Instances with Other Variables' Advances of the Same Stage?
+	virtual
+	bool
+	is_concurrent() const
+	{ // Default implementation
+		return false;
+	}
+
 public: // Properties
 
 	// Order of Method
@@ -341,6 +348,20 @@ public: // Properties
 		return observees_;
 	}
 
+	// Event Queue
+	EventQ &
+	queue() const
+	{
+		return *events_;
+	}
+
+	// FMU Instance
+	FMU_ME &
+	fmu_me() const
+	{
+		return *fmu_me_;
+	}
+
 	// Event Queue Iterator
 	EventQ::iterator &
 	event()
@@ -383,6 +404,20 @@ public: // Methods
 		dt_max = dt;
 	}
 
+	// Set the Event Queue
+	void
+	set_queue( EventQ & q )
+	{
+		events_ = &q;
+	}
+
+	// Set the FMU Instance
+	void
+	set_fmu_me( FMU_ME & f )
+	{
+		fmu_me_ = &f;
+	}
+
 	// Add Observer
 	void
 	add_observer( Variable & v )
@@ -438,7 +473,7 @@ public: // Methods
 	void
 	add_handler()
 	{
-		event_ = events.add_handler( this );
+		event_ = events_->add_handler( this );
 	}
 
 	// Initialization
@@ -573,6 +608,30 @@ public: // Methods
 	advance_QSS_2()
 	{}
 
+	// QSS Advance: Parallel Stage 1 on an FMU Instance: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	advance_QSS_1_deferred( FMU_ME & )
+	{
+		assert( false ); // Not a concurrent variable
+	}
+
+	// QSS Advance: Parallel Stage 2 on an FMU Instance: Quantized Coefficient and Event Queue Updates Deferred
+	virtual
+	void
+	advance_QSS_2_deferred( FMU_ME & )
+	{
+		assert( false ); // Not a concurrent variable
+	}
+
+	// QSS Advance: Deferred Updates After Parallel Stage k
+	virtual
+	void
+	advance_QSS_deferred( int const k )
+	{ // Default implementation: Event queue update after the final stage
+		if ( k == order() ) event( events_->shift_QSS( tE, event() ) );
+	}
+
 	// Advance Observers: Stage 1
 	void
 	advance_observers_1()
@@ -596,10 +655,9 @@ public: // Methods
 
 	// Advance Observers: Stage d
 	void
-	advance_observers_d()
+	advance_observers_d() const
 	{
-		assert( options::output::d );
-		for ( Variable * observer : observers_ ) {
+		for ( Variable const * observer : observers_ ) {
 			observer->advance_observer_d();
 		}
 	}
@@ -647,12 +705,68 @@ public: // Methods
 		advance_observer_2();
 	}
 
+	// Observer Advance: Parallel Stage 1 on an FMU Instance: Event Queue Update Deferred
+	virtual
+	void
+	advance_observer_1_deferred( FMU_ME &, Time const )
+	{
+		assert( false ); // Not a concurrent variable
+	}
+
+	// Observer Advance: Parallel Stage 2 on an FMU Instance: Event Queue Update Deferred
+	virtual
+	void
+	advance_observer_2_deferred( FMU_ME & )
+	{
+		assert( false ); // Not a concurrent variable
+	}
+
+	// Observer Advance: Deferred Updates After Parallel Stage k
+	void
+	advance_observer_deferred( int const k )
+	{
+		if ( k == order() ) event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Observer Advance: Simultaneous Parallel Stage 1 on an FMU Instance: Event Queue Update Deferred
+	void
+	advance_observer_simultaneous_1_deferred( FMU_ME & fmu_me, Time const t )
+	{
+		fmu_set_observees_q( fmu_me, t );
+		if ( self_observer ) fmu_set_q( fmu_me, t );
+		advance_observer_1_deferred( fmu_me, t );
+	}
+
+	// Observer Advance: Simultaneous Parallel Stage 2 on an FMU Instance: Event Queue Update Deferred
+	void
+	advance_observer_simultaneous_2_deferred( FMU_ME & fmu_me, Time const t )
+	{
+		assert( order() >= 2 );
+		fmu_set_observees_q( fmu_me, t );
+		if ( self_observer ) fmu_set_q( fmu_me, t );
+		advance_observer_2_deferred( fmu_me );
+	}
+
 	// Observer Advance: Stage d
+	void
+	advance_observer_d() const
+	{
+		print_d( ' ', tX );
+	}
+
+	// Advance: Stage d
+	void
+	advance_d( char const tag ) const
+	{
+		print_d( tag, tQ );
+	}
+
+	// Diagnostic Output: Tagged State at Time t
 	virtual
 	void
-	advance_observer_d()
+	print_d( char const tag, Time const t ) const
 	{
-		assert( false );
+		std::cout << tag << ' ' << name << '(' << t << ')' << '\n';
 	}
 
 	// Zero-Crossing Advance
@@ -699,14 +813,14 @@ public: // Methods
 	void
 	shift_handler( Time const t )
 	{
-		event_ = events.shift_handler( t, event_ );
+		event_ = events_->shift_handler( t, event_ );
 	}
 
 	// Shift Handler to Time Infinity
 	void
 	shift_handler()
 	{
-		event_ = events.shift_handler( event_ );
+		event_ = events_->shift_handler( event_ );
 	}
 
 public: // Methods: FMU
@@ -715,77 +829,112 @@ public: // Methods: FMU
 	Value
 	fmu_get_value() const
 	{
-		return fmu::get_real( var.ref );
+		return fmu_me_->get_real( var.ref );
 	}
 
 	// Get FMU Variable Derivative
 	Value
 	fmu_get_deriv() const
 	{
-		return fmu::get_real( der.ref );
+		return fmu_me_->get_real( der.ref );
+	}
+
+	// Get FMU Variable Derivative from an FMU Instance
+	Value
+	fmu_get_deriv( FMU_ME const & fmu_me ) const
+	{
+		return fmu_me.get_real( der.ref );
 	}
 
 	// Set FMU Variable to a Value
 	void
 	fmu_set_value( Value const v ) const
 	{
-		fmu::set_real( var.ref, v );
+		fmu_me_->set_real( var.ref, v );
+	}
+
+	// Set FMU Variable to a Value in an FMU Instance
+	void
+	fmu_set_value( FMU_ME & fmu_me, Value const v ) const
+	{
+		fmu_me.set_real( var.ref, v );
 	}
 
 	// Set FMU Variable to Continuous Value at Time t
 	void
 	fmu_set_x( Time const t ) const
 	{
-		fmu::set_real( var.ref, x( t ) );
+		fmu_me_->set_real( var.ref, x( t ) );
 	}
 
 	// Set FMU Variable to Quantized Value at Time t
 	void
 	fmu_set_q( Time const t ) const
 	{
-		fmu::set_real( var.ref, q( t ) );
+		fmu_me_->set_real( var.ref, q( t ) );
+	}
+
+	// Set FMU Variable to Quantized Value at Time t in an FMU Instance
+	void
+	fmu_set_q( FMU_ME & fmu_me, Time const t ) const
+	{
+		fmu_me.set_real( var.ref, q( t ) );
 	}
 
 	// Set FMU Variable to Simultaneous Value at Time t
 	void
 	fmu_set_s( Time const t ) const
 	{
-		fmu::set_real( var.ref, s( t ) );
+		fmu_me_->set_real( var.ref, s( t ) );
+	}
+
+	// Set FMU Variable to Simultaneous Value at Time t in an FMU Instance
+	void
+	fmu_set_s( FMU_ME & fmu_me, Time const t ) const
+	{
+		fmu_me.set_real( var.ref, s( t ) );
 	}
 
 	// Set FMU Variable to Simultaneous Numeric Differentiation Value at Time t
 	void
 	fmu_set_sn( Time const t ) const
 	{
-		fmu::set_real( var.ref, sn( t ) );
+		fmu_me_->set_real( var.ref, sn( t ) );
+	}
+
+	// Set FMU Variable to Simultaneous Numeric Differentiation Value at Time t in an FMU Instance
+	void
+	fmu_set_sn( FMU_ME & fmu_me, Time const t ) const
+	{
+		fmu_me.set_real( var.ref, sn( t ) );
 	}
 
 	// Get FMU Integer Variable Value
 	Integer
 	fmu_get_integer_value() const
 	{
-		return fmu::get_integer( var.ref );
+		return fmu_me_->get_integer( var.ref );
 	}
 
 	// Set FMU Integer Variable to a Value
 	void
 	fmu_set_integer_value( Integer const v ) const
 	{
-		fmu::set_integer( var.ref, v );
+		fmu_me_->set_integer( var.ref, v );
 	}
 
 	// Get FMU Boolean Variable Value
 	bool
 	fmu_get_boolean_value() const
 	{
-		return fmu::get_boolean( var.ref );
+		return fmu_me_->get_boolean( var.ref );
 	}
 
 	// Set FMU Boolean Variable to a Value
 	void
 	fmu_set_boolean_value( bool const v ) const
 	{
-		fmu::set_boolean( var.ref, v );
+		fmu_me_->set_boolean( var.ref, v );
 	}
 
 	// Set All Observee FMU Variables to Continuous Value at Time t
@@ -806,6 +955,15 @@ public: // Methods: FMU
 		}
 	}
 
+	// Set All Observee FMU Variables to Quantized Value at Time t in an FMU Instance
+	void
+	fmu_set_observees_q( FMU_ME & fmu_me, Time const t ) const
+	{
+		for ( auto observee : observees_ ) {
+			if ( ! observee->is_Discrete() ) observee->fmu_set_q( fmu_me, t );
+		}
+	}
+
 	// Set All Observee FMU Variables to Simultaneous Value at Time t
 	void
 	fmu_set_observees_s( Time const t ) const
@@ -815,6 +973,15 @@ public: // Methods: FMU
 		}
 	}
 
+	// Set All Observee FMU Variables to Simultaneous Value at Time t in an FMU Instance
+	void
+	fmu_set_observees_s( FMU_ME & fmu_me, Time const t ) const
+	{
+		for ( auto observee : observees_ ) {
+			if ( ! observee->is_Discrete() ) observee->fmu_set_s( fmu_me, t );
+		}
+	}
+
 	// Set All Observee FMU Variables to Simultaneous Numeric Differentiation Value at Time t
 	void
 	fmu_set_observees_sn( Time const t ) const
@@ -824,6 +991,15 @@ public: // Methods: FMU
 		}
 	}
 
+	// Set All Observee FMU Variables to Simultaneous Numeric Differentiation Value at Time t in an FMU Instance
+	void
+	fmu_set_observees_sn( FMU_ME & fmu_me, Time const t ) const
+	{
+		for ( auto observee : observees_ ) {
+			if ( ! observee->is_Discrete() ) observee->fmu_set_sn( fmu_me, t );
+		}
+	}
+
 	// Set All Observers Observee FMU Variables to Quantized Value at Time t
 	void
 	fmu_set_observers_observees_q( Time const t ) const
@@ -899,6 +1075,7 @@ public: // Data
 	Time dt_inf_rlx{ infinity }; // Relaxed time step inf
 	SuperdenseTime sT; // Trigger superdense time
 	bool self_observer{ false }; // Variable appears in its function/derivative?
+	size_type stats_slot{ 0u }; // Per-variable statistics side array slot
 	FMU_Variable var; // FMU variables specs
 	FMU_Variable der; // FMU derivative specs
 
@@ -910,7 +1087,9 @@ protected: // Data
 	Variables observees_; // Variables this one depends on
 	Variables observers_observees_; // Observers observees (including self-observing observers)
 	size_type iBeg_observers_2_observees_{ 0 }; // Index of first observee of observer of order 2+
+	EventQ * events_{ nullptr }; // Event queue of the simulation
 	EventQ::iterator event_; // Iterator to event queue entry
+	FMU_ME * fmu_me_{ nullptr }; // FMU instance of the simulation
 
 };
 
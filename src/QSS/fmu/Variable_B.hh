@@ -194,7 +194,6 @@ public: // Methods
 		sort_observers();
 		x_ = static_cast< Boolean >( xIni );
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Initialization to a Value: Stage 0
@@ -206,7 +205,6 @@ public: // Methods
 		sort_observers();
 		x_ = static_cast< Boolean >( x );
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Handler Advance
@@ -218,14 +216,10 @@ public: // Methods
 		x_ = fmu_get_boolean_value(); // Assume FMU ran zero-crossing handler
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		shift_handler();
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
-			advance_observers_d();
-		}
 	}
 
 	// Handler Advance: Stage 0
@@ -236,7 +230,13 @@ public: // Methods
 		tX = tQ = t;
 		x_ = fmu_get_boolean_value(); // Assume FMU ran zero-crossing handler
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << '\n';
 	}
 
 private: // Data
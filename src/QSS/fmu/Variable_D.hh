@@ -164,7 +164,6 @@ public: // Methods
 		sort_observers();
 		x_ = xIni;
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Initialization to a Value: Stage 0
@@ -176,7 +175,6 @@ public: // Methods
 		sort_observers();
 		x_ = x;
 		add_handler();
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << '\n';
 	}
 
 	// Handler Advance
@@ -188,14 +186,10 @@ public: // Methods
 		x_ = fmu_get_value(); // Assume FMU ran zero-crossing handler
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		shift_handler();
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
-			advance_observers_d();
-		}
 	}
 
 	// Handler Advance: Stage 0
@@ -206,7 +200,13 @@ public: // Methods
 		tX = tQ = t;
 		x_ = fmu_get_value(); // Assume FMU ran zero-crossing handler
 		shift_handler();
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << '\n';
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << '\n';
 	}
 
 private: // Data
@@ -135,8 +135,7 @@ public: // Methods
 		x_1_ = f_( tQ ).x_1;
 		set_tE();
 		tD = f_( tQ ).tD;
-		event( tE < tD ? events.add_QSS( tE, this ) : events.add_discrete( tD, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->add_QSS( tE, this ) : events_->add_discrete( tD, this ) );
 	}
 
 	// Set Current Tolerance
@@ -156,16 +155,12 @@ public: // Methods
 		x_1_ = f_( tD ).x_1;
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tD + options::dtNum );
+			fmu_me_->set_time( tN = tD + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE();
 		tD = f_( tD ).tD;
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
-			advance_observers_d();
-		}
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 	}
 
 	// Discrete Advance: Stages 0 and 1
@@ -177,8 +172,7 @@ public: // Methods
 		x_1_ = f_( tD ).x_1;
 		set_tE();
 		tD = f_( tD ).tD;
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 	}
 
 	// QSS Advance
@@ -190,16 +184,12 @@ public: // Methods
 		x_1_ = f_( tQ ).x_1;
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE();
 		tD = f_( tQ ).tD;
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) {
-			std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
-			advance_observers_d();
-		}
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -217,8 +207,14 @@ public: // Methods
 		x_1_ = f_( tE ).x_1;
 		set_tE();
 		tD = f_( tQ ).tD;
-		event( tE < tD ? events.shift_QSS( tE, event() ) : events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
+		event( tE < tD ? events_->shift_QSS( tE, event() ) : events_->shift_discrete( tD, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tD=" << tD << '\n';
 	}
 
 private: // Methods
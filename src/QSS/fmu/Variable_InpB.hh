@@ -179,8 +179,7 @@ public: // Methods
 		init_observers();
 		x_ = static_cast< Boolean >( f_( tQ ).x_0 );
 		tD = f_( tQ ).tD;
-		event( events.add_discrete( tD, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->add_discrete( tD, this ) );
 	}
 
 	// Discrete Advance
@@ -190,15 +189,11 @@ public: // Methods
 		x_ = static_cast< Boolean >( f_( tX = tQ = tD ).x_0 );
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		tD = f_( tD ).tD;
-		event( events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_discrete( tD, event() ) );
 	}
 
 	// Discrete Advance: Stages 0 and 1
@@ -207,8 +202,14 @@ public: // Methods
 	{
 		x_ = static_cast< Boolean >( f_( tX = tQ = tD ).x_0 );
 		tD = f_( tD ).tD;
-		event( events.shift_discrete( tD, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << x_ << "   tD=" << tD << '\n';
+		event( events_->shift_discrete( tD, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << x_ << "   tD=" << tD << '\n';
 	}
 
 private: // Data
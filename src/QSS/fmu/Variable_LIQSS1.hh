@@ -104,14 +104,14 @@ public: // Properties
 	Value
 	s( Time const ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ : q_0_ );
+		return ( sT == events_->active_superdense_time() ? q_c_ : q_0_ );
 	}
 
 	// Simultaneous Numeric Differentiation Value at Time t
 	Value
 	sn( Time const t ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ : q_0_ );
+		return ( sT == events_->active_superdense_time() ? q_c_ : q_0_ );
 	}
 
 public: // Methods
@@ -155,15 +155,14 @@ public: // Methods
 	init_1()
 	{
 		if ( self_observer ) {
-			advance_LIQSS();
+			advance_LIQSS( *fmu_me_ );
 			fmu_set_value( x_0_ );
 		} else {
 			x_1_ = fmu_get_deriv();
 			q_0_ += signum( x_1_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->add_QSS( tE, this ) );
 	}
 
 	// Set Current Tolerance
@@ -182,22 +181,18 @@ public: // Methods
 		set_qTol();
 		fmu_set_observees_q( tX = tQ );
 		if ( self_observer ) {
-			advance_LIQSS();
+			advance_LIQSS( *fmu_me_ );
 		} else {
 			x_1_ = fmu_get_deriv();
 			q_0_ += signum( x_1_ ) * qTol;
 		}
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -213,35 +208,41 @@ public: // Methods
 	void
 	advance_QSS_1()
 	{
-		fmu_set_observees_s( tQ );
+		advance_QSS_1_deferred( *fmu_me_ );
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 1 on an FMU Instance: Event Queue Update Deferred
+	void
+	advance_QSS_1_deferred( FMU_ME & fmu_me )
+	{
+		fmu_set_observees_s( fmu_me, tQ );
 		if ( self_observer ) {
-			advance_LIQSS();
+			advance_LIQSS( fmu_me );
 		} else {
-			x_1_ = fmu_get_deriv();
+			x_1_ = fmu_get_deriv( fmu_me );
 			q_0_ += signum( x_1_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 	// Observer Advance: Stage 1
 	void
 	advance_observer_1( Time const t )
 	{
-		assert( ( tX <= t ) && ( t <= tE ) );
-		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
-		tX = t;
-		x_1_ = fmu_get_deriv();
-		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
+		advance_observer_1_deferred( *fmu_me_, t );
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
-	// Observer Advance: Stage d
+	// Observer Advance: Parallel Stage 1 on an FMU Instance: Event Queue Update Deferred
 	void
-	advance_observer_d()
+	advance_observer_1_deferred( FMU_ME & fmu_me, Time const t )
 	{
-		std::cout << "  " << name << '(' << tX << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		assert( ( tX <= t ) && ( t <= tE ) );
+		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
+		tX = t;
+		x_1_ = fmu_get_deriv( fmu_me );
+		set_tE_unaligned();
 	}
 
 	// Handler Advance
@@ -257,15 +258,11 @@ public: // Methods
 		if ( ( self_observer ) && ( observers_.empty() ) ) fmu_set_value( q_0_ );
 		x_1_ = fmu_get_deriv();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance: Stage 0
@@ -286,8 +283,14 @@ public: // Methods
 		if ( ( self_observer ) && ( observers_.empty() ) ) fmu_set_value( q_0_ );
 		x_1_ = fmu_get_deriv();
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
@@ -321,7 +324,7 @@ private: // Methods
 
 	// Advance Self-Observing Trigger
 	void
-	advance_LIQSS()
+	advance_LIQSS( FMU_ME & fmu_me )
 	{
 		assert( qTol > 0.0 );
 		assert( self_observer );
@@ -331,11 +334,11 @@ private: // Methods
 		Value const q_u( q_c_ + qTol );
 
 		// Derivative at +/- qTol
-		fmu_set_value( q_l );
-		Value const d_l( fmu_get_deriv() );
+		fmu_set_value( fmu_me, q_l );
+		Value const d_l( fmu_get_deriv( fmu_me ) );
 		int const d_l_s( signum( d_l ) );
-		fmu_set_value( q_u );
-		Value const d_u( fmu_get_deriv() );
+		fmu_set_value( fmu_me, q_u );
+		Value const d_u( fmu_get_deriv( fmu_me ) );
 		int const d_u_s( signum( d_u ) );
 
 		// Set coefficients based on derivative signs
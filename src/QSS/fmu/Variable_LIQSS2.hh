@@ -119,21 +119,21 @@ public: // Properties
 	Value
 	s( Time const t ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ : q_0_ + ( q_1_ * ( t - tQ ) ) );
+		return ( sT == events_->active_superdense_time() ? q_c_ : q_0_ + ( q_1_ * ( t - tQ ) ) );
 	}
 
 	// Simultaneous Numeric Differentiation Value at Time t
 	Value
 	sn( Time const t ) const
 	{
-		return ( sT == events.active_superdense_time() ? q_c_ + ( s_1_ * ( t - tQ ) ) : q_0_ + ( q_1_ * ( t - tQ ) ) );
+		return ( sT == events_->active_superdense_time() ? q_c_ + ( s_1_ * ( t - tQ ) ) : q_0_ + ( q_1_ * ( t - tQ ) ) );
 	}
 
 	// Simultaneous First Derivative at Time t
 	Value
 	s1( Time const ) const
 	{
-		return ( sT == events.active_superdense_time() ? s_1_ : q_1_ );
+		return ( sT == events_->active_superdense_time() ? s_1_ : q_1_ );
 	}
 
 public: // Methods
@@ -179,7 +179,7 @@ public: // Methods
 	init_1()
 	{
 		if ( self_observer ) {
-			advance_LIQSS_1();
+			advance_LIQSS_1( *fmu_me_ );
 			fmu_set_value( x_0_ );
 		}
 		x_1_ = q_1_ = s_1_ = fmu_get_deriv();
@@ -191,15 +191,14 @@ public: // Methods
 	{
 		if ( self_observer ) {
 			tN = tQ + options::dtNum;
-			advance_LIQSS_2();
+			advance_LIQSS_2( *fmu_me_ );
 			fmu_set_sn( tN );
 		} else {
 			x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 			q_0_ += signum( x_2_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->add_QSS( tE, this ) );
 	}
 
 	// Set Current Tolerance
@@ -219,30 +218,26 @@ public: // Methods
 		set_qTol();
 		fmu_set_observees_q( tX = tQ );
 		if ( self_observer ) {
-			advance_LIQSS_1();
-			fmu::set_time( tN = tQ + options::dtNum );
+			advance_LIQSS_1( *fmu_me_ );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			fmu_set_observees_q( tN );
-			advance_LIQSS_2();
+			advance_LIQSS_2( *fmu_me_ );
 			s_1_ = q_1_;
 		} else {
 			x_1_ = q_1_ = s_1_ = fmu_get_deriv();
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			fmu_set_observees_q( tN );
 			x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 			q_0_ += signum( x_2_ ) * qTol;
 		}
-		fmu::set_time( tQ );
+		fmu_me_->set_time( tQ );
 		advance_observers_1();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -259,55 +254,75 @@ public: // Methods
 	void
 	advance_QSS_1()
 	{
-		fmu_set_observees_s( tQ );
+		advance_QSS_1_deferred( *fmu_me_ );
+	}
+
+	// QSS Advance: Parallel Stage 1 on an FMU Instance: Stage Peers Read Only the Simultaneous Rep
+	void
+	advance_QSS_1_deferred( FMU_ME & fmu_me )
+	{
+		fmu_set_observees_s( fmu_me, tQ );
 		if ( self_observer ) {
-			advance_LIQSS_1();
-			fmu_set_value( x_0_ );
+			advance_LIQSS_1( fmu_me );
+			fmu_set_value( fmu_me, x_0_ );
 		}
-		x_1_ = q_1_ = s_1_ = fmu_get_deriv();
+		x_1_ = q_1_ = s_1_ = fmu_get_deriv( fmu_me );
 	}
 
 	// QSS Advance: Stage 2
 	void
 	advance_QSS_2()
 	{
-		fmu_set_observees_sn( tN = tQ + options::dtNum );
+		advance_QSS_2_deferred( *fmu_me_ );
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 2 on an FMU Instance: Event Queue Update Deferred
+	void
+	advance_QSS_2_deferred( FMU_ME & fmu_me )
+	{
+		fmu_set_observees_sn( fmu_me, tN = tQ + options::dtNum );
 		if ( self_observer ) {
-			advance_LIQSS_2();
+			advance_LIQSS_2( fmu_me );
 		} else {
-			x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
+			x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv( fmu_me ) - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 			q_0_ += signum( x_2_ ) * qTol;
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
 	}
 
 	// Observer Advance: Stage 1
 	void
 	advance_observer_1( Time const t )
+	{
+		advance_observer_1_deferred( *fmu_me_, t );
+	}
+
+	// Observer Advance: Parallel Stage 1 on an FMU Instance
+	void
+	advance_observer_1_deferred( FMU_ME & fmu_me, Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		Time const tDel( t - tX );
 		tX = t;
 		x_0_ = x_0_ + ( ( x_1_ + ( x_2_ * tDel ) ) * tDel );
-		x_1_ = fmu_get_deriv();
+		x_1_ = fmu_get_deriv( fmu_me );
 	}
 
 	// Observer Advance: Stage 2
 	void
 	advance_observer_2()
 	{
-		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
-		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
+		advance_observer_2_deferred( *fmu_me_ );
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
-	// Observer Advance: Stage d
+	// Observer Advance: Parallel Stage 2 on an FMU Instance: Event Queue Update Deferred
 	void
-	advance_observer_d()
+	advance_observer_2_deferred( FMU_ME & fmu_me )
 	{
-		std::cout << "  " << name << '(' << tX << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv( fmu_me ) - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
+		set_tE_unaligned();
 	}
 
 	// Handler Advance
@@ -322,17 +337,13 @@ public: // Methods
 		fmu_set_observees_q( tQ );
 		if ( ( self_observer ) && ( observers_.empty() ) ) fmu_set_value( q_0_ );
 		x_1_ = q_1_ = s_1_ = fmu_get_deriv();
-		fmu::set_time( tN = tQ + options::dtNum );
+		fmu_me_->set_time( tN = tQ + options::dtNum );
 		if ( observers_max_order_ >= 2 ) advance_observers_2();
 		fmu_set_observees_q( tN );
 		if ( ( self_observer ) && ( observers_max_order_ <= 1 ) ) fmu_set_q( tN );
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance: Stage 0
@@ -362,8 +373,14 @@ public: // Methods
 		if ( ( self_observer ) && ( observers_max_order_ <= 1 ) ) fmu_set_q( tN );
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
@@ -411,22 +428,22 @@ private: // Methods
 
 	// Advance Self-Observing Trigger: Stage 1
 	void
-	advance_LIQSS_1()
+	advance_LIQSS_1( FMU_ME & fmu_me )
 	{
 		assert( qTol > 0.0 );
 		assert( self_observer );
 		assert( q_c_ == q_0_ );
 
 		// Derivative at +/- qTol
-		fmu_set_value( q_c_ - qTol );
-		d_l_ = fmu_get_deriv();
-		fmu_set_value( q_c_ + qTol );
-		d_u_ = fmu_get_deriv();
+		fmu_set_value( fmu_me, q_c_ - qTol );
+		d_l_ = fmu_get_deriv( fmu_me );
+		fmu_set_value( fmu_me, q_c_ + qTol );
+		d_u_ = fmu_get_deriv( fmu_me );
 	}
 
 	// Advance Self-Observing Trigger: Stage 2
 	void
-	advance_LIQSS_2()
+	advance_LIQSS_2( FMU_ME & fmu_me )
 	{
 		assert( qTol > 0.0 );
 		assert( self_observer );
@@ -439,11 +456,11 @@ private: // Methods
 		Value const q_u( q_c_ + qTol );
 
 		// Second derivative at +/- qTol
-		fmu_set_value( q_l + ( d_l_ * options::dtNum ) );
-		Value const d2_l( options::one_half_over_dtNum * ( fmu_get_deriv() - d_l_ ) ); // 1/2 * 2nd derivative
+		fmu_set_value( fmu_me, q_l + ( d_l_ * options::dtNum ) );
+		Value const d2_l( options::one_half_over_dtNum * ( fmu_get_deriv( fmu_me ) - d_l_ ) ); // 1/2 * 2nd derivative
 		int const d2_l_s( signum( d2_l ) );
-		fmu_set_value( q_u + ( d_u_ * options::dtNum ) );
-		Value const d2_u( options::one_half_over_dtNum * ( fmu_get_deriv() - d_u_ ) ); // 1/2 * 2nd derivative
+		fmu_set_value( fmu_me, q_u + ( d_u_ * options::dtNum ) );
+		Value const d2_u( options::one_half_over_dtNum * ( fmu_get_deriv( fmu_me ) - d_u_ ) ); // 1/2 * 2nd derivative
 		int const d2_u_s( signum( d2_u ) );
 
 		// Set coefficients based on second derivative signs
@@ -97,6 +97,13 @@ public: // Predicate
 		return true;
 	}
 
+	// Advances Can Run Concurrently on Separate FMU Instances with Other Variables' Advances of the Same Stage?
+	bool
+	is_concurrent() const
+	{
+		return true;
+	}
+
 };
 
 } // fmu
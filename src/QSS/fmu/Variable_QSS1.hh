@@ -155,8 +155,7 @@ public: // Methods
 	{
 		x_1_ = fmu_get_deriv();
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->add_QSS( tE, this ) );
 	}
 
 	// Set Current Tolerance
@@ -181,15 +180,11 @@ public: // Methods
 		}
 		x_1_ = fmu_get_deriv();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -205,31 +200,37 @@ public: // Methods
 	void
 	advance_QSS_1()
 	{
-		fmu_set_observees_s( tQ );
-		if ( self_observer ) fmu_set_value( q_0_ );
-		x_1_ = fmu_get_deriv();
+		advance_QSS_1_deferred( *fmu_me_ );
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 1 on an FMU Instance: Event Queue Update Deferred
+	void
+	advance_QSS_1_deferred( FMU_ME & fmu_me )
+	{
+		fmu_set_observees_s( fmu_me, tQ );
+		if ( self_observer ) fmu_set_value( fmu_me, q_0_ );
+		x_1_ = fmu_get_deriv( fmu_me );
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 	// Observer Advance: Stage 1
 	void
 	advance_observer_1( Time const t )
 	{
-		assert( ( tX <= t ) && ( t <= tE ) );
-		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
-		tX = t;
-		x_1_ = fmu_get_deriv();
-		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
+		advance_observer_1_deferred( *fmu_me_, t );
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
-	// Observer Advance: Stage d
+	// Observer Advance: Parallel Stage 1 on an FMU Instance: Event Queue Update Deferred
 	void
-	advance_observer_d()
+	advance_observer_1_deferred( FMU_ME & fmu_me, Time const t )
 	{
-		std::cout << "  " << name << '(' << tX << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		assert( ( tX <= t ) && ( t <= tE ) );
+		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
+		tX = t;
+		x_1_ = fmu_get_deriv( fmu_me );
+		set_tE_unaligned();
 	}
 
 	// Handler Advance
@@ -245,15 +246,11 @@ public: // Methods
 		if ( ( self_observer ) && ( observers_.empty() ) ) fmu_set_value( q_0_ );
 		x_1_ = fmu_get_deriv();
 		if ( observers_max_order_ >= 2 ) {
-			fmu::set_time( tN = tQ + options::dtNum );
+			fmu_me_->set_time( tN = tQ + options::dtNum );
 			advance_observers_2();
 		}
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance: Stage 0
@@ -274,8 +271,14 @@ public: // Methods
 		if ( ( self_observer ) && ( observers_.empty() ) ) fmu_set_value( q_0_ );
 		x_1_ = fmu_get_deriv();
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
@@ -186,8 +186,7 @@ public: // Methods
 	{
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 		set_tE_aligned();
-		event( events.add_QSS( tE, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->add_QSS( tE, this ) );
 	}
 
 	// Set Current Tolerance
@@ -212,7 +211,7 @@ public: // Methods
 			advance_observers_1();
 		}
 		x_1_ = q_1_ = fmu_get_deriv();
-		fmu::set_time( tN = tQ + options::dtNum );
+		fmu_me_->set_time( tN = tQ + options::dtNum );
 		fmu_set_observees_q( tN );
 		if ( observers_max_order_ <= 1 ) {
 			if ( self_observer ) fmu_set_q( tN );
@@ -221,11 +220,7 @@ public: // Methods
 		}
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -242,48 +237,81 @@ public: // Methods
 	void
 	advance_QSS_1()
 	{
-		fmu_set_observees_s( tQ );
-		if ( self_observer ) fmu_set_value( q_0_ );
-		x_1_ = q_1_ = fmu_get_deriv();
+		advance_QSS_1_deferred( *fmu_me_ );
+		q_1_ = x_1_;
+	}
+
+	// QSS Advance: Parallel Stage 1 on an FMU Instance: Quantized Coefficient Update Deferred
+	void
+	advance_QSS_1_deferred( FMU_ME & fmu_me )
+	{
+		fmu_set_observees_s( fmu_me, tQ );
+		if ( self_observer ) fmu_set_value( fmu_me, q_0_ );
+		x_1_ = fmu_get_deriv( fmu_me );
 	}
 
 	// QSS Advance: Stage 2
 	void
 	advance_QSS_2()
 	{
-		fmu_set_observees_sn( tN = tQ + options::dtNum );
-		if ( self_observer ) fmu_set_q( tN );
-		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
+		advance_QSS_2_deferred( *fmu_me_ );
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// QSS Advance: Parallel Stage 2 on an FMU Instance: Event Queue Update Deferred
+	void
+	advance_QSS_2_deferred( FMU_ME & fmu_me )
+	{
+		fmu_set_observees_sn( fmu_me, tN = tQ + options::dtNum );
+		if ( self_observer ) fmu_set_q( fmu_me, tN );
+		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv( fmu_me ) - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+	}
+
+	// QSS Advance: Deferred Updates After Parallel Stage k
+	void
+	advance_QSS_deferred( int const k )
+	{
+		if ( k == 1 ) {
+			q_1_ = x_1_;
+		} else {
+			assert( k == 2 );
+			event( events_->shift_QSS( tE, event() ) );
+		}
 	}
 
 	// Observer Advance: Stage 1
 	void
 	advance_observer_1( Time const t )
+	{
+		advance_observer_1_deferred( *fmu_me_, t );
+	}
+
+	// Observer Advance: Parallel Stage 1 on an FMU Instance
+	void
+	advance_observer_1_deferred( FMU_ME & fmu_me, Time const t )
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		Time const tDel( t - tX );
 		tX = t;
 		x_0_ = x_0_ + ( ( x_1_ + ( x_2_ * tDel ) ) * tDel );
-		x_1_ = fmu_get_deriv();
+		x_1_ = fmu_get_deriv( fmu_me );
 	}
 
 	// Observer Advance: Stage 2
 	void
 	advance_observer_2()
 	{
-		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
-		set_tE_unaligned();
-		event( events.shift_QSS( tE, event() ) );
+		advance_observer_2_deferred( *fmu_me_ );
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
-	// Observer Advance: Stage d
+	// Observer Advance: Parallel Stage 2 on an FMU Instance: Event Queue Update Deferred
 	void
-	advance_observer_d()
+	advance_observer_2_deferred( FMU_ME & fmu_me )
 	{
-		std::cout << "  " << name << '(' << tX << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv( fmu_me ) - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
+		set_tE_unaligned();
 	}
 
 	// Handler Advance
@@ -298,17 +326,13 @@ public: // Methods
 		fmu_set_observees_q( tQ );
 		if ( ( self_observer ) && ( observers_.empty() ) ) fmu_set_value( q_0_ );
 		x_1_ = q_1_ = fmu_get_deriv();
-		fmu::set_time( tN = tQ + options::dtNum );
+		fmu_me_->set_time( tN = tQ + options::dtNum );
 		if ( observers_max_order_ >= 2 ) advance_observers_2();
 		fmu_set_observees_q( tN );
 		if ( ( self_observer ) && ( observers_max_order_ <= 1 ) ) fmu_set_q( tN );
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) {
-			std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
-			advance_observers_d();
-		}
+		event( events_->shift_QSS( tE, event() ) );
 	}
 
 	// Handler Advance: Stage 0
@@ -338,8 +362,14 @@ public: // Methods
 		if ( ( self_observer ) && ( observers_max_order_ <= 1 ) ) fmu_set_q( tN );
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler
 		set_tE_aligned();
-		event( events.shift_QSS( tE, event() ) );
-		if ( options::output::d ) std::cout << "* " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
+		event( events_->shift_QSS( tE, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
 	}
 
 private: // Methods
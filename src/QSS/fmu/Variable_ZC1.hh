@@ -130,8 +130,7 @@ public: // Methods
 		x_1_ = fmu_get_deriv();
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.add_QSS( tE, this ) : events.add_ZC( tZ, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->add_QSS( tE, this ) : events_->add_ZC( tZ, this ) );
 	}
 
 	// Set Current Tolerance
@@ -152,8 +151,7 @@ public: // Methods
 		x_1_ = fmu_get_deriv();
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -172,8 +170,7 @@ public: // Methods
 		x_1_ = fmu_get_deriv();
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 	}
 
 	// Observer Advance: Stage 1
@@ -189,21 +186,20 @@ public: // Methods
 		crossing_detect( sign_old_, signum( x_0_ ) );
 	}
 
-	// Observer Advance: Stage d
-	void
-	advance_observer_d()
-	{
-		std::cout << "  " << name << '(' << tX << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ <<  '\n';
-	}
-
 	// Zero-Crossing Advance
 	void
 	advance_ZC()
 	{
 		shift_handlers();
-		if ( options::output::d ) std::cout << "Z " << name << '(' << tZ << ')' << '\n';
 		set_tZ( tZ_prev = tZ ); // Next zero-crossing: Might be in active segment
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << "   tZ=" << tZ << '\n';
 	}
 
 private: // Methods
@@ -280,14 +276,14 @@ private: // Methods
 			if ( has( crossing_check ) ) { // Crossing type is relevant
 				crossing = crossing_check;
 				tZ = tX;
-				event( events.shift_ZC( tZ, event() ) );
+				event( events_->shift_ZC( tZ, event() ) );
 			} else {
 				set_tZ();
-				event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+				event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 			}
 		} else {
 			set_tZ();
-			event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+			event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 		}
 	}
 
@@ -156,8 +156,7 @@ public: // Methods
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.add_QSS( tE, this ) : events.add_ZC( tZ, this ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->add_QSS( tE, this ) : events_->add_ZC( tZ, this ) );
 	}
 
 	// Set Current Tolerance
@@ -176,13 +175,12 @@ public: // Methods
 		x_0_ = q_0_ = fmu_get_value();
 		set_qTol();
 		x_1_ = q_1_ = fmu_get_deriv();
-		fmu::set_time( tN = tQ + options::dtNum );
+		fmu_me_->set_time( tN = tQ + options::dtNum );
 		fmu_set_observees_q( tN );
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
-		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 	}
 
 	// QSS Advance: Stage 0
@@ -209,8 +207,7 @@ public: // Methods
 		x_2_ = options::one_half_over_dtNum * ( fmu_get_deriv() - x_1_ ); // Forward Euler //API one_half * fmu_get_deriv2() when 2nd derivative is available
 		set_tE();
 		set_tZ();
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
-		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << "   tZ=" << tZ << '\n';
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 	}
 
 	// Observer Advance: Stage 1
@@ -233,21 +230,20 @@ public: // Methods
 		crossing_detect( sign_old_, signum( x_0_ ) );
 	}
 
-	// Observer Advance: Stage d
-	void
-	advance_observer_d()
-	{
-		std::cout << "  " << name << '(' << tX << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << "   tZ=" << tZ <<  '\n';
-	}
-
 	// Zero-Crossing Advance
 	void
 	advance_ZC()
 	{
 		shift_handlers();
-		if ( options::output::d ) std::cout << "Z " << name << '(' << tZ << ')' << '\n';
 		set_tZ( tZ_prev = tZ ); // Next zero-crossing: Might be in active segment
-		event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+		event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
+	}
+
+	// Diagnostic Output
+	void
+	print_d( char const tag, Time const t ) const
+	{
+		std::cout << tag << ' ' << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << "   tZ=" << tZ << '\n';
 	}
 
 private: // Methods
@@ -337,14 +333,14 @@ private: // Methods
 			if ( has( crossing_check ) ) { // Crossing type is relevant
 				crossing = crossing_check;
 				tZ = tX;
-				event( events.shift_ZC( tZ, event() ) );
+				event( events_->shift_ZC( tZ, event() ) );
 			} else {
 				set_tZ();
-				event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+				event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 			}
 		} else {
 			set_tZ();
-			event( tE < tZ ? events.shift_QSS( tE, event() ) : events.shift_ZC( tZ, event() ) );
+			event( tE < tZ ? events_->shift_QSS( tE, event() ) : events_->shift_ZC( tZ, event() ) );
 		}
 	}
 
@@ -43,6 +43,10 @@ namespace fmu {
 void
 simulate_fmu();
 
+// Simulate an FMU Ensemble from the Global Options
+void
+simulate_ensemble();
+
 } // fmu
 } // QSS
 
@@ -36,14 +36,17 @@
 // QSS Headers
 #include <QSS/options.hh>
 #include <QSS/math.hh>
+#include <QSS/OutputFilter.hh>
 
 // C++ Headers
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace QSS {
 namespace options {
@@ -51,6 +54,8 @@ namespace options {
 QSS qss( QSS::QSS2 ); // QSS method: (LI)QSS1|2|3  [QSS2]
 int qss_order( 2 ); // QSS method order  [computed]
 bool inflection( false ); // Requantize at inflections?  [F]
+bool incremental( false ); // Incremental LTI quantized sums?  [F]
+bool simd( false ); // Vectorized LTI quantized sums?  [F]
 double rTol( 1.0e-4 ); // Relative tolerance  [1e-4|FMU]
 double aTol( 1.0e-6 ); // Absolute tolerance  [1e-6]
 bool rTol_set( false ); // Relative tolerance set?
@@ -65,6 +70,19 @@ double dtOut( 1.0e-3 ); // Sampled & FMU output time step (s)  [1e-3]
 double tEnd( 1.0 ); // End time (s)  [1|FMU]
 bool tEnd_set( false ); // End time set?
 std::string out; // Outputs: r, a, s, x, q, f  [rx]
+Format format( Format::text ); // Output file format: text|binary|columnar|segment  [text]
+std::string convert; // Binary, columnar, or segment output file to convert to text  [none]
+bool stats( false ); // Per-variable event statistics?  [F]
+std::string trace; // Chrome trace file of event passes  [none]
+bool perf( false ); // Hardware performance counters?  [F]
+std::string ensemble; // Ensemble scenarios file  [none]
+std::size_t threads( 0u ); // Ensemble or parallel advance threads: 0 for hardware concurrency  [0]
+bool deterministic( false ); // Deterministic parallel advance scheduling?  [F]
+bool pin( false ); // Pin parallel advance threads to CPUs?  [F]
+std::size_t batch( 1u ); // Ensemble lanes per batch for QSS2 LTI models  [1]
+std::size_t fanout( 0u ); // Observers, simultaneous triggers, or variables for parallel advance and initialization: 0 for off  [0]
+std::size_t clusters( 0u ); // Partitioned simulation clusters: 0 or 1 for off  [0]
+std::size_t optimism( 0u ); // Optimistic partitioned simulation items per cluster per round: 0 for conservative  [0]
 std::string model; // Name of model or FMU
 
 namespace output { // Output selections
@@ -78,9 +96,23 @@ bool f( true ); // FMU outputs?  [T]
 bool x( true ); // Continuous trajectories?  [T]
 bool q( false ); // Quantized trajectories?  [F]
 bool d( false ); // Diagnostic output?  [F]
+bool x_segments( false ); // Continuous trajectory segments?  [F]
+bool q_segments( false ); // Quantized trajectory segments?  [F]
+std::vector< std::string > include; // Variable name patterns to output  [all]
+std::vector< std::string > exclude; // Variable name patterns not to output  [none]
+bool fmu_outputs( false ); // Only output FMU output causality variables?  [F]
 
 } // output
 
+namespace gen { // Generated model parameters
+
+std::size_t size( 1000u ); // Number of state variables  [1000]
+std::size_t degree( 4u ); // Mean off-diagonal couplings per variable  [4]
+bool power( false ); // Power law (Zipf) degree distribution?  [F]
+std::uint64_t seed( 1u ); // Random number seed  [1]
+
+} // gen
+
 // Uppercased string
 std::string
 uppercased( std::string const & s )
@@ -121,6 +153,26 @@ double_of( std::string const & s )
 	return std::stod( s ); // Check is_double first
 }
 
+// string is Readable as a Nonnegative Integer?
+inline
+bool
+is_size( std::string const & s )
+{
+	if ( s.empty() ) return false;
+	for ( char const c : s ) {
+		if ( ! std::isdigit( c ) ) return false;
+	}
+	return ( s.length() <= 18u ); // Fits in 64 bits
+}
+
+// Nonnegative Integer of a string
+inline
+std::uint64_t
+size_of( std::string const & s )
+{
+	return std::stoull( s ); // Check is_size first
+}
+
 // Has an Option (Case-Insensitive)?
 bool
 has_option( std::string const & s, char const * const option )
@@ -186,6 +238,24 @@ arg_value( std::string const & arg )
 	}
 }
 
+// Output Variable Patterns of an Argument Value: A re: Regular Expression or Comma-Separated Globs
+std::vector< std::string >
+output_patterns( std::string const & value )
+{
+	std::vector< std::string > patterns;
+	if ( value.compare( 0u, 3u, "re:" ) == 0 ) {
+		patterns.push_back( value );
+	} else {
+		std::string::size_type b( 0u );
+		while ( b <= value.length() ) {
+			std::string::size_type const e( std::min( value.find( ',', b ), value.length() ) );
+			patterns.push_back( value.substr( b, e - b ) );
+			b = e + 1u;
+		}
+	}
+	return patterns;
+}
+
 // Help Display
 void
 help_display()
@@ -194,6 +264,8 @@ help_display()
 	std::cout << "Options:" << "\n\n";
 	std::cout << " --qss=METHOD  QSS method: (LI)QSS1|2|3  [QSS2]" << '\n';
 	std::cout << " --inflection  Requantize at inflections?  [F]" << '\n';
+	std::cout << " --incremental Incremental LTI quantized sums?  [F]" << '\n';
+	std::cout << " --simd        Vectorized LTI quantized sums?  [F]" << '\n';
 	std::cout << " --rTol=TOL    Relative tolerance  [1e-4|FMU]" << '\n';
 	std::cout << " --aTol=TOL    Absolute tolerance  [1e-6]" << '\n';
 	std::cout << " --dtMin=STEP  Min time step (s)  [0.0]" << '\n';
@@ -213,6 +285,31 @@ help_display()
 	std::cout << "       x       Continuous trajectories" << '\n';
 	std::cout << "       q       Quantized trajectories" << '\n';
 	std::cout << "       d       Diagnostic output" << '\n';
+	std::cout << " --format=FMT  Output file format: text|binary|columnar|segment  [text]" << '\n';
+	std::cout << "       text     Text file per variable: NAME.x.out, NAME.q.out, NAME.f.out" << '\n';
+	std::cout << "       binary   Asynchronous binary records: out.bin" << '\n';
+	std::cout << "       columnar Single-file columnar: out.col" << '\n';
+	std::cout << "       segment  x and q trajectory polynomial segments: out.seg" << '\n';
+	std::cout << " --convert=OUT Convert out.bin|col|seg to text output files: Segments sampled at dtOut" << '\n';
+	std::cout << " --include=PAT Output variables matching glob or re:REGEX patterns (comma-separated globs)  [all]" << '\n';
+	std::cout << " --exclude=PAT Don't output variables matching glob or re:REGEX patterns (comma-separated globs)  [none]" << '\n';
+	std::cout << " --fmu-outputs Only output FMU output causality variables  [F]" << '\n';
+	std::cout << " --stats       Per-variable event statistics to stats.csv  [F]" << '\n';
+	std::cout << " --trace=FILE  Chrome trace JSON timeline of event passes  [none]" << '\n';
+	std::cout << " --perf        Hardware performance counters by event type  [F]" << '\n';
+	std::cout << " --ensemble=FILE Run model scenarios concurrently: Summary to ensemble.csv  [none]" << '\n';
+	std::cout << "       FILE lines: [name=NAME] [rTol=TOL] [aTol=TOL] [seed=SEED] [tEnd=TIME] [xIni:VAR=VALUE]...: FMUs take name, rTol, aTol, tEnd" << '\n';
+	std::cout << " --threads=N   Ensemble or parallel advance threads: FMU parallel stages need no event indicators  [hardware]" << '\n';
+	std::cout << " --deterministic  Deterministic parallel advance: Static scheduling and ordered passes  [F]" << '\n';
+	std::cout << " --pin         Pin parallel advance threads to CPUs  [F]" << '\n';
+	std::cout << " --batch=K     Ensemble lanes per batch for QSS2 LTI models  [1]" << '\n';
+	std::cout << " --fanout=N    Parallel advance of N+ observers or simultaneous triggers and initialization of N+ variables: 0 for off  [0]" << '\n';
+	std::cout << " --clusters=N  Partitioned simulation of LTI QSS models in N clusters: Conservative needs --dtMin: 0 or 1 for off  [0]" << '\n';
+	std::cout << " --optimism=N  Optimistic partitioned simulation with up to N items per cluster per round: 0 for conservative  [0]" << '\n';
+	std::cout << " --size=N      Generated model size  [1000]" << '\n';
+	std::cout << " --degree=D    Generated model mean coupling degree  [4]" << '\n';
+	std::cout << " --dist=DIST   Generated model degree distribution: uniform|power  [uniform]" << '\n';
+	std::cout << " --seed=SEED   Generated model random seed  [1]" << '\n';
 	std::cout << '\n';
 	std::cout << "Models:" << "\n\n";
 	std::cout << "  achilles : Achilles and the Tortoise" << '\n';
@@ -225,11 +322,22 @@ help_display()
 	std::cout << "  exponential_decay_sine_ND : Numeric differentiation" << '\n';
 	std::cout << "  exponential_decay_step : Adds step input function" << '\n';
 	std::cout << "  nonlinear : Nonlinear derivative demo" << '\n';
+	std::cout << "  nonlinear_AD : Automatic differentiation" << '\n';
 	std::cout << "  nonlinear_ND : Numeric differentiation" << '\n';
 	std::cout << "  StateEvent6 : Zero-crossing model" << '\n';
 	std::cout << "  stiff : Stiff system from literature" << '\n';
 	std::cout << "  xy : Simple 2 variable model" << '\n';
 	std::cout << "  xyz : Simple 3 variable model" << '\n';
+	std::cout << "  FILE.lti : Linear time-invariant model file" << '\n';
+	std::cout << '\n';
+	std::cout << "Generated Models (see --size, --degree, --dist, --seed):" << "\n\n";
+	std::cout << "  gen_grid1d : 1-D heat conduction grid" << '\n';
+	std::cout << "  gen_grid2d : 2-D heat conduction grid" << '\n';
+	std::cout << "  gen_grid3d : 3-D heat conduction grid" << '\n';
+	std::cout << "  gen_random : Random sparse stable LTI system" << '\n';
+	std::cout << "  gen_chain : Driven chain" << '\n';
+	std::cout << "  gen_star : Star graph" << '\n';
+	std::cout << "  gen_thermostat : 2-D grid of rooms with thermostat zero-crossings" << '\n';
 	std::cout << '\n';
 }
 
@@ -276,6 +384,10 @@ process_args( int argc, char * argv[] )
 			}
 		} else if ( has_option( arg, "inflection" ) ) {
 			inflection = true;
+		} else if ( has_option( arg, "incremental" ) ) {
+			incremental = true;
+		} else if ( has_option( arg, "simd" ) ) {
+			simd = true;
 		} else if ( has_value_option( arg, "rTol" ) ) {
 			std::string const rTol_str( arg_value( arg ) );
 			if ( is_double( rTol_str ) ) {
@@ -404,6 +516,140 @@ process_args( int argc, char * argv[] )
 			output::q = has( out, 'q' );
 			output::d = has( out, 'd' );
 			if ( output::a ) output::o = true; // a => o
+		} else if ( has_value_option( arg, "format" ) ) {
+			std::string const format_name( arg_value( arg ) );
+			if ( format_name == "text" ) {
+				format = Format::text;
+			} else if ( format_name == "binary" ) {
+				format = Format::binary;
+			} else if ( format_name == "columnar" ) {
+				format = Format::columnar;
+			} else if ( format_name == "segment" ) {
+				format = Format::segment;
+			} else {
+				std::cerr << "Error: Unsupported output format: " << format_name << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "convert" ) ) {
+			convert = arg_value( arg );
+			if ( convert.empty() ) {
+				std::cerr << "Error: Empty output file name to convert" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "include" ) || has_value_option( arg, "exclude" ) ) {
+			std::vector< std::string > & patterns( has_value_option( arg, "include" ) ? output::include : output::exclude );
+			for ( std::string const & pattern : output_patterns( arg_value( arg ) ) ) {
+				if ( OutputFilter::is_valid( pattern ) ) {
+					patterns.push_back( pattern );
+				} else {
+					std::cerr << "Error: Invalid output variable pattern: " << pattern << std::endl;
+					fatal = true;
+				}
+			}
+		} else if ( has_option( arg, "fmu-outputs" ) ) {
+			output::fmu_outputs = true;
+		} else if ( has_option( arg, "stats" ) ) {
+			stats = true;
+		} else if ( has_value_option( arg, "trace" ) ) {
+			trace = arg_value( arg );
+			if ( trace.empty() ) {
+				std::cerr << "Error: Empty trace file name" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "perf" ) ) {
+			perf = true;
+		} else if ( has_value_option( arg, "ensemble" ) ) {
+			ensemble = arg_value( arg );
+			if ( ensemble.empty() ) {
+				std::cerr << "Error: Empty ensemble file name" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "deterministic" ) ) {
+			deterministic = true;
+		} else if ( has_option( arg, "pin" ) ) {
+			pin = true;
+		} else if ( has_value_option( arg, "threads" ) ) {
+			std::string const threads_str( arg_value( arg ) );
+			if ( is_size( threads_str ) ) {
+				threads = static_cast< std::size_t >( size_of( threads_str ) );
+			} else {
+				std::cerr << "Error: Threads not a nonnegative integer: " << threads_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "batch" ) ) {
+			std::string const batch_str( arg_value( arg ) );
+			if ( is_size( batch_str ) ) {
+				batch = static_cast< std::size_t >( size_of( batch_str ) );
+				if ( batch == 0u ) {
+					std::cerr << "Error: Zero batch: " << batch_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Error: Batch not a positive integer: " << batch_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "fanout" ) ) {
+			std::string const fanout_str( arg_value( arg ) );
+			if ( is_size( fanout_str ) ) {
+				fanout = static_cast< std::size_t >( size_of( fanout_str ) );
+			} else {
+				std::cerr << "Error: Fan-out not a nonnegative integer: " << fanout_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "clusters" ) ) {
+			std::string const clusters_str( arg_value( arg ) );
+			if ( is_size( clusters_str ) ) {
+				clusters = static_cast< std::size_t >( size_of( clusters_str ) );
+			} else {
+				std::cerr << "Error: Clusters not a nonnegative integer: " << clusters_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "optimism" ) ) {
+			std::string const optimism_str( arg_value( arg ) );
+			if ( is_size( optimism_str ) ) {
+				optimism = static_cast< std::size_t >( size_of( optimism_str ) );
+			} else {
+				std::cerr << "Error: Optimism not a nonnegative integer: " << optimism_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "size" ) ) {
+			std::string const size_str( arg_value( arg ) );
+			if ( is_size( size_str ) ) {
+				gen::size = static_cast< std::size_t >( size_of( size_str ) );
+				if ( gen::size == 0u ) {
+					std::cerr << "Error: Zero size: " << size_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Error: Size not a positive integer: " << size_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "degree" ) ) {
+			std::string const degree_str( arg_value( arg ) );
+			if ( is_size( degree_str ) ) {
+				gen::degree = static_cast< std::size_t >( size_of( degree_str ) );
+			} else {
+				std::cerr << "Error: Degree not a nonnegative integer: " << degree_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "dist" ) ) {
+			std::string const dist_str( uppercased( arg_value( arg ) ) );
+			if ( dist_str == "UNIFORM" ) {
+				gen::power = false;
+			} else if ( dist_str == "POWER" ) {
+				gen::power = true;
+			} else {
+				std::cerr << "Error: Unsupported degree distribution: " << arg_value( arg ) << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "seed" ) ) {
+			std::string const seed_str( arg_value( arg ) );
+			if ( is_size( seed_str ) ) {
+				gen::seed = size_of( seed_str );
+			} else {
+				std::cerr << "Error: Seed not a nonnegative integer: " << seed_str << std::endl;
+				fatal = true;
+			}
 		} else if ( arg[ 0 ] == '-' ) {
 			std::cerr << "Error: Unsupported option: " << arg << std::endl;
 			fatal = true;
@@ -415,6 +661,12 @@ process_args( int argc, char * argv[] )
 		}
 	}
 
+	if ( format == Format::segment ) { // Segments replace the x and q point outputs
+		output::x_segments = output::x;
+		output::q_segments = output::q;
+		output::x = output::q = false;
+	}
+
 	if ( help ) std::exit( EXIT_SUCCESS );
 	if ( fatal ) std::exit( EXIT_FAILURE );
 }
@@ -37,7 +37,10 @@
 #define QSS_options_hh_INCLUDED
 
 // C++ Headers
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace QSS {
 namespace options {
@@ -52,9 +55,19 @@ enum class QSS {
  LIQSS3
 };
 
+// Output File Format Enumerator
+enum class Format {
+ text, // Text file per variable
+ binary, // Asynchronous binary record file
+ columnar, // Single-file chunked columnar file
+ segment // Trajectory polynomial segment file
+};
+
 extern QSS qss; // QSS method: (LI)QSS1|2|3  [QSS2]
 extern int qss_order; // QSS method order  [computed]
 extern bool inflection; // Requantize at inflections?  [F]
+extern bool incremental; // Incremental LTI quantized sums?  [F]
+extern bool simd; // Vectorized LTI quantized sums?  [F]
 extern double rTol; // Relative tolerance  [1e-4|FMU]
 extern double aTol; // Absolute tolerance  [1e-6]
 extern bool rTol_set; // Relative tolerance set?
@@ -69,6 +82,19 @@ extern double one_half_over_dtNum; // 0.5 / dtNum  [computed]
 extern double tEnd; // End time (s)  [1|FMU]
 extern bool tEnd_set; // End time set?
 extern std::string out; // Outputs: r, a, s, x, q, f  [rx]
+extern Format format; // Output file format: text|binary|columnar|segment  [text]
+extern std::string convert; // Binary, columnar, or segment output file to convert to text  [none]
+extern bool stats; // Per-variable event statistics?  [F]
+extern std::string trace; // Chrome trace file of event passes  [none]
+extern bool perf; // Hardware performance counters?  [F]
+extern std::string ensemble; // Ensemble scenarios file  [none]
+extern std::size_t threads; // Ensemble or parallel advance threads: 0 for hardware concurrency  [0]
+extern bool deterministic; // Deterministic parallel advance scheduling?  [F]
+extern bool pin; // Pin parallel advance threads to CPUs?  [F]
+extern std::size_t batch; // Ensemble lanes per batch for QSS2 LTI models  [1]
+extern std::size_t fanout; // Observers, simultaneous triggers, or variables for parallel advance and initialization: 0 for off  [0]
+extern std::size_t clusters; // Partitioned simulation clusters: 0 or 1 for off  [0]
+extern std::size_t optimism; // Optimistic partitioned simulation items per cluster per round: 0 for conservative  [0]
 extern std::string model; // Name of model or FMU
 
 namespace output { // Output selections
@@ -82,9 +108,23 @@ extern bool f; // FMU outputs?  [T]
 extern bool x; // Continuous trajectories?  [T]
 extern bool q; // Quantized trajectories?  [F]
 extern bool d; // Diagnostic output?  [F]
+extern bool x_segments; // Continuous trajectory segments?  [F]
+extern bool q_segments; // Quantized trajectory segments?  [F]
+extern std::vector< std::string > include; // Variable name patterns to output  [all]
+extern std::vector< std::string > exclude; // Variable name patterns not to output  [none]
+extern bool fmu_outputs; // Only output FMU output causality variables?  [F]
 
 } // output
 
+namespace gen { // Generated model parameters
+
+extern std::size_t size; // Number of state variables  [1000]
+extern std::size_t degree; // Mean off-diagonal couplings per variable  [4]
+extern bool power; // Power law (Zipf) degree distribution?  [F]
+extern std::uint64_t seed; // Random number seed  [1]
+
+} // gen
+
 // Process command line arguments
 void
 process_args( int argc, char * argv[] );
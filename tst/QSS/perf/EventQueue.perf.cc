@@ -35,6 +35,7 @@
 
 // QSS Headers
 #include <QSS/EventQueue.hh>
+#include <QSS/PerfCounters.hh>
 
 // C++ Headers
 #include <cstddef>
@@ -42,8 +43,11 @@
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <string>
 #include <vector>
 
+using namespace QSS;
+
 // Variable Mock
 class V {};
 
@@ -57,9 +61,10 @@ std::default_random_engine random_generator;
 }
 
 int
-main()
+main( int argc, char * argv[] )
 {
 	using namespace std;
+	bool const perf_on( ( argc > 1 ) && ( std::string( argv[ 1 ] ) == "--perf" ) ); // Hardware counters?
 
 	random_generator.seed( 42 );
 	size_t const N( 10000 ); // Variable count
@@ -76,6 +81,9 @@ main()
 		events.add_QSS( distribution( random_generator ), &vars[ i ] );
 	}
 
+	PerfCounters perf;
+	bool const doPerf( perf_on && perf.open() );
+	if ( doPerf ) perf.begin( PerfCounters::other );
 	double const time_beg = (double)clock()/CLOCKS_PER_SEC;
 	size_t ns( 0u ), nr( 0u ), nl( 0u );
 	for ( size_t r = 1; r <= R; ++r ) {
@@ -83,5 +91,12 @@ main()
 		events.shift_QSS( i->first + ( 0.5 * ( 10.0 - i->first ) ), i ); // Move halfway to tE
 	}
 	double const time_end = (double)clock()/CLOCKS_PER_SEC;
+	if ( doPerf ) perf.end();
 	cout << std::setprecision( 15 ) << time_end - time_beg << " (s) " << events.top_time() << ' ' << N << ' ' << R << endl << endl;
+	if ( doPerf ) { // Per shift counts
+		PerfCounters::Values const & c( perf.counts( PerfCounters::other ) );
+		for ( size_t i = 0; i < PerfCounters::n_counters; ++i ) {
+			cout << PerfCounters::name( PerfCounters::Counter( i ) ) << ": " << c[ i ] << " (" << double( c[ i ] ) / R << " per shift)" << endl;
+		}
+	}
 }
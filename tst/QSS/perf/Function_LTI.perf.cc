@@ -0,0 +1,126 @@
+// Function_LTI Performance Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/Sum_LTI.hh>
+#include <QSS/dfn/Variable_QSS2.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace QSS;
+using namespace QSS::dfn;
+using namespace QSS::dfn::mdl;
+
+// Types
+using V = Variable_QSS2< Function_LTI >;
+using Vars = std::vector< V * >;
+using Time = double;
+
+namespace { // Internal shared global
+std::default_random_engine random_generator;
+}
+
+// Build a Hub Variable Coupled to N Leaf Variables
+//
+// stiff: Leaves follow x1 of the stiff model and the hub sums them with the x2 coefficients
+// achilles: Leaves and hub use the achilles model coefficients
+Vars
+build( std::string const & pattern, std::size_t const N )
+{
+	bool const stiff( pattern == "stiff" );
+	Vars vars;
+	vars.reserve( N + 1 );
+	V * hub( new V( "hub", 1.0e-4, 1.0e-6, stiff ? 20.0 : 2.0 ) );
+	vars.push_back( hub );
+	for ( std::size_t i = 1; i <= N; ++i ) {
+		V * x( new V( "x" + std::to_string( i ), 1.0e-4, 1.0e-6, stiff ? 0.0 : 0.001 * i ) );
+		if ( stiff ) {
+			x->d().add( 0.01, hub );
+			hub->d().add( -100.0 / N, x );
+		} else {
+			x->d().add( -0.5, x ).add( 1.5, hub );
+			hub->d().add( -1.0 / N, x );
+		}
+		vars.push_back( x );
+	}
+	if ( stiff ) hub->d().add( 2020.0 ).add( -100.0, hub );
+	for ( auto var : vars ) var->init_0();
+	for ( auto var : vars ) var->init_1();
+	for ( auto var : vars ) var->init_2();
+	return vars;
+}
+
+// Time Hub Derivative Evaluations
+void
+run( std::string const & pattern, std::size_t const N, std::size_t const R, bool const simd )
+{
+	options::simd = simd;
+	Vars vars( build( pattern, N ) );
+	V const & hub( *vars[ 0 ] );
+	std::uniform_real_distribution< Time > distribution( 0.0, 1.0e-3 );
+	double s( 0.0 );
+	double const time_beg = (double)clock()/CLOCKS_PER_SEC;
+	for ( std::size_t r = 1; r <= R; ++r ) {
+		Time const t( distribution( random_generator ) );
+		s += hub.d().q( t ) + hub.d().q1( t ) + hub.d().q2( t );
+	}
+	double const time_end = (double)clock()/CLOCKS_PER_SEC;
+	std::cout << std::setprecision( 15 ) << pattern << ' ' << ( simd ? Sum_LTI::isa() : "Loop" ) << ' ' << N << ' ' << R << ' ' << time_end - time_beg << " (s) " << s << std::endl;
+	for ( auto var : vars ) delete var;
+	events.clear();
+}
+
+int
+main()
+{
+	random_generator.seed( 42 );
+	std::size_t const W( 100000000 ); // Term evaluation work per run
+	for ( std::string const pattern : { "stiff", "achilles" } ) {
+		for ( std::size_t const N : { 1000u, 4000u, 16000u } ) {
+			run( pattern, N, W / N, false );
+			run( pattern, N, W / N, true );
+		}
+	}
+	std::cout << std::endl;
+}
@@ -0,0 +1,217 @@
+#!/usr/bin/env python
+
+# QSS Solver End-to-End Benchmark
+#
+# Language: Python (2.7 or 3.x)
+#
+# Project: QSS Solver
+#
+# Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+# the National Renewable Energy Laboratory of the U.S. Department of Energy
+#
+# Copyright (c) 2017 Objexx Engineerinc, Inc. All Rights Reserved.
+
+# Notes:
+# . Runs the QSS executable over a fixed matrix of example, generated, and FMU models
+# . Each case runs in its own scratch directory so output bytes can be measured
+# . Wall time is the minimum over the repeats: Peak RSS is the maximum
+# . Event counts are parsed from the "... event passes" report lines
+# . FMU cases are taken from *.fmu files in the --fmu directories since none are bundled in the tree
+# . Compare mode flags cases slower, less event-throughput, or bigger than the baseline by more than the threshold
+# . Exit status is 1 when compare finds regressions or a case fails
+#
+# Usage:
+#  bench.py run [--qss=QSS] [--fmu=DIR]... [--repeat=N] [--quick] [--filter=REGEX] [--out=bench.json] [--baseline=base.json]
+#  bench.py compare base.json bench.json [--threshold=0.1]
+
+# Imports
+import argparse, datetime, json, os, platform, re, shutil, subprocess, sys, tempfile, time
+
+# Globals
+Version = 1
+Event_re = re.compile( r'^\s*(\d+)\s+(discrete|requantization|simultaneous requantization|zero-crossing) event passes\s*$' )
+Event_key = {
+    'discrete': 'n_discrete_events',
+    'requantization': 'n_QSS_events',
+    'simultaneous requantization': 'n_QSS_simultaneous_events',
+    'zero-crossing': 'n_ZC_events',
+}
+
+# Example models: ( name, arguments )
+Cases_dfn = [
+    ( 'achilles', [ 'achilles' ] ),
+    ( 'achilles.LIQSS2', [ '--qss=LIQSS2', 'achilles' ] ),
+    ( 'bball', [ '--tEnd=3', 'bball' ] ),
+    ( 'exponential_decay_sine.QSS3', [ '--qss=QSS3', 'exponential_decay_sine' ] ),
+    ( 'nonlinear', [ 'nonlinear' ] ),
+    ( 'nonlinear_ND', [ 'nonlinear_ND' ] ),
+    ( 'StateEvent6', [ 'StateEvent6' ] ),
+    ( 'stiff.QSS2', [ 'stiff' ] ),
+    ( 'stiff.LIQSS2', [ '--qss=LIQSS2', 'stiff' ] ),
+    ( 'xyz', [ 'xyz' ] ),
+]
+
+# Generated models: ( name, arguments, quick size, full size )
+Cases_gen = [
+    ( 'gen_grid2d', [ 'gen_grid2d' ], 1024, 40000 ),
+    ( 'gen_grid3d.LIQSS2', [ '--qss=LIQSS2', 'gen_grid3d' ], 1000, 27000 ),
+    ( 'gen_random', [ 'gen_random' ], 1000, 20000 ),
+    ( 'gen_random.power', [ '--dist=power', '--degree=8', 'gen_random' ], 1000, 20000 ),
+    ( 'gen_chain', [ 'gen_chain' ], 1000, 20000 ),
+    ( 'gen_star', [ 'gen_star' ], 1000, 20000 ),
+    ( 'gen_thermostat', [ 'gen_thermostat' ], 400, 10000 ),
+]
+
+# Main
+def main():
+
+    # Get options and arguments
+    parser = argparse.ArgumentParser( description = 'QSS solver end-to-end benchmark' )
+    sub = parser.add_subparsers( dest = 'mode' )
+    run_parser = sub.add_parser( 'run', help = 'Run the benchmark matrix' )
+    run_parser.add_argument( '--qss', help = 'QSS executable [QSS on PATH]', default = 'QSS' )
+    run_parser.add_argument( '--fmu', help = 'Directory of FMUs to add to the matrix', action = 'append', default = [] )
+    run_parser.add_argument( '--repeat', help = 'Runs per case [3]', type = int, default = 3 )
+    run_parser.add_argument( '--quick', help = 'Small generated model sizes', action = 'store_true' )
+    run_parser.add_argument( '--filter', help = 'Only run cases whose name matches this regex' )
+    run_parser.add_argument( '--out', help = 'JSON results file [bench.json]', default = 'bench.json' )
+    run_parser.add_argument( '--baseline', help = 'Compare results against this baseline JSON file' )
+    run_parser.add_argument( '--threshold', help = 'Regression threshold fraction [0.1]', type = float, default = 0.1 )
+    cmp_parser = sub.add_parser( 'compare', help = 'Compare results against a baseline' )
+    cmp_parser.add_argument( 'baseline', help = 'Baseline JSON file' )
+    cmp_parser.add_argument( 'results', help = 'Results JSON file' )
+    cmp_parser.add_argument( '--threshold', help = 'Regression threshold fraction [0.1]', type = float, default = 0.1 )
+    arg = parser.parse_args()
+
+    if arg.mode == 'run':
+        results = run( arg )
+        with open( arg.out, 'w' ) as out_file:
+            json.dump( results, out_file, indent = 1, sort_keys = True )
+            out_file.write( '\n' )
+        print( 'Results written to ' + arg.out )
+        ok = all( case[ 'status' ] == 0 for case in results[ 'cases' ] )
+        if arg.baseline:
+            with open( arg.baseline ) as base_file:
+                ok = compare( json.load( base_file ), results, arg.threshold ) and ok
+        sys.exit( 0 if ok else 1 )
+    elif arg.mode == 'compare':
+        with open( arg.baseline ) as base_file:
+            baseline = json.load( base_file )
+        with open( arg.results ) as results_file:
+            results = json.load( results_file )
+        sys.exit( 0 if compare( baseline, results, arg.threshold ) else 1 )
+    else:
+        parser.print_help()
+        sys.exit( 1 )
+
+def matrix( arg ):
+    '''Benchmark cases: ( name, arguments )'''
+    cases = list( Cases_dfn )
+    for name, args, quick_size, full_size in Cases_gen:
+        cases.append( ( name, [ '--size=' + str( quick_size if arg.quick else full_size ) ] + args ) )
+    for fmu_dir in arg.fmu:
+        for fmu in sorted( os.listdir( fmu_dir ) ):
+            if fmu.endswith( '.fmu' ):
+                cases.append( ( 'fmu.' + fmu[ :-4 ], [ os.path.abspath( os.path.join( fmu_dir, fmu ) ) ] ) )
+    if arg.filter:
+        pattern = re.compile( arg.filter )
+        cases = [ case for case in cases if pattern.search( case[ 0 ] ) ]
+    return cases
+
+def run( arg ):
+    '''Run the benchmark matrix'''
+    qss = arg.qss
+    if os.path.dirname( qss ): qss = os.path.abspath( qss )
+    results = {
+        'version': Version,
+        'date': datetime.datetime.now().isoformat(),
+        'host': platform.node(),
+        'platform': platform.platform(),
+        'qss': qss,
+        'repeat': arg.repeat,
+        'quick': arg.quick,
+        'cases': [],
+    }
+    for name, args in matrix( arg ):
+        case = run_case( qss, name, args, max( arg.repeat, 1 ) )
+        results[ 'cases' ].append( case )
+        print( '{:32} {:>10.3f} s {:>14.0f} events/s {:>10} kB {:>12} B{}'.format( name, case[ 'wall_s' ], case[ 'events_per_s' ][ 'total' ], case[ 'peak_rss_kB' ], case[ 'output_bytes' ], '' if case[ 'status' ] == 0 else '  FAILED: ' + str( case[ 'status' ] ) ) )
+        sys.stdout.flush()
+    return results
+
+def run_case( qss, name, args, repeat ):
+    '''Run one case repeat times in scratch directories'''
+    case = { 'name': name, 'args': args, 'status': 0, 'wall_s': float( 'inf' ), 'peak_rss_kB': 0, 'output_bytes': 0, 'events': {} }
+    for r in range( repeat ):
+        work = tempfile.mkdtemp( prefix = 'QSS.bench.' )
+        try:
+            log_name = os.path.join( work, '.bench.log' )
+            with open( log_name, 'w' ) as log:
+                start = time.time()
+                proc = subprocess.Popen( [ qss ] + args, cwd = work, stdout = log, stderr = subprocess.STDOUT )
+                pid, status, usage = os.wait4( proc.pid, 0 )
+                wall = time.time() - start
+                proc.returncode = status # Reaped by wait4
+            case[ 'wall_s' ] = min( case[ 'wall_s' ], wall )
+            case[ 'peak_rss_kB' ] = max( case[ 'peak_rss_kB' ], int( usage.ru_maxrss ) ) # kB on Linux
+            if status != 0: case[ 'status' ] = os.WEXITSTATUS( status ) if os.WIFEXITED( status ) else -os.WTERMSIG( status )
+            events = {}
+            with open( log_name ) as log:
+                for line in log:
+                    m = Event_re.match( line )
+                    if m: events[ Event_key[ m.group( 2 ) ] ] = int( m.group( 1 ) )
+            case[ 'events' ] = events
+            output_bytes = 0
+            for dir_path, dir_names, file_names in os.walk( work ):
+                for file_name in file_names:
+                    path = os.path.join( dir_path, file_name )
+                    if path != log_name: output_bytes += os.path.getsize( path )
+            case[ 'output_bytes' ] = output_bytes
+        finally:
+            shutil.rmtree( work, ignore_errors = True )
+    wall = case[ 'wall_s' ]
+    rate = dict( ( key, ( n / wall if wall > 0.0 else 0.0 ) ) for key, n in case[ 'events' ].items() )
+    rate[ 'total' ] = sum( case[ 'events' ].values() ) / wall if wall > 0.0 else 0.0
+    case[ 'events_per_s' ] = rate
+    return case
+
+def compare( baseline, results, threshold ):
+    '''Compare results against a baseline: Returns True if no regressions'''
+    base_cases = dict( ( case[ 'name' ], case ) for case in baseline[ 'cases' ] )
+    regressions = 0
+    print( '{:32} {:>10} {:>10} {:>8}  {}'.format( 'Case', 'Base (s)', 'New (s)', 'Change', 'Flags' ) )
+    for case in results[ 'cases' ]:
+        name = case[ 'name' ]
+        base = base_cases.get( name )
+        if base is None:
+            print( '{:32} {:>10} {:>10.3f} {:>8}  new case'.format( name, '-', case[ 'wall_s' ], '-' ) )
+            continue
+        flags = []
+        if case[ 'status' ] != 0 and base[ 'status' ] == 0: flags.append( 'FAILED' )
+        if relative_change( base[ 'wall_s' ], case[ 'wall_s' ] ) > threshold: flags.append( 'SLOWER' )
+        if relative_change( case[ 'events_per_s' ][ 'total' ], base[ 'events_per_s' ][ 'total' ] ) > threshold: flags.append( 'THROUGHPUT' )
+        if relative_change( base[ 'peak_rss_kB' ], case[ 'peak_rss_kB' ] ) > threshold: flags.append( 'RSS' )
+        if relative_change( base[ 'output_bytes' ], case[ 'output_bytes' ] ) > threshold: flags.append( 'OUTPUT' )
+        notes = []
+        if case[ 'events' ] != base[ 'events' ]: notes.append( 'event counts changed' ) # Informational: Counts are deterministic but legitimately change with solver changes
+        if flags: regressions += 1
+        print( '{:32} {:>10.3f} {:>10.3f} {:>+7.1f}%  {}'.format( name, base[ 'wall_s' ], case[ 'wall_s' ], 100.0 * relative_change( base[ 'wall_s' ], case[ 'wall_s' ] ), ' '.join( flags + notes ) ) )
+    names = set( case[ 'name' ] for case in results[ 'cases' ] )
+    for name in sorted( base_cases ):
+        if name not in names: print( '{:32} missing from results'.format( name ) )
+    if regressions:
+        print( str( regressions ) + ' case(s) regressed beyond ' + '{:.0f}%'.format( 100.0 * threshold ) )
+    else:
+        print( 'No regressions beyond ' + '{:.0f}%'.format( 100.0 * threshold ) )
+    return regressions == 0
+
+def relative_change( old, new ):
+    '''Relative increase from old to new'''
+    if old > 0.0:
+        return ( new - old ) / old
+    else:
+        return 0.0 if new <= 0.0 else float( 'inf' )
+
+# Runner
+if __name__ == '__main__':
+    main()
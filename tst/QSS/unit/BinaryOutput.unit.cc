@@ -0,0 +1,114 @@
+// BinaryOutput Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/BinaryOutput.hh>
+#include <QSS/Output.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace QSS;
+
+namespace {
+
+std::string
+contents( std::string const & name )
+{
+	std::ifstream file( name );
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	return buffer.str();
+}
+
+} // namespace
+
+TEST( BinaryOutputTest, Convert )
+{
+	std::string const name( "BinaryOutputTest.bin" );
+	std::string const a_name( "BinaryOutputTest.a.out" );
+	std::string const b_name( "BinaryOutputTest.b.out" );
+
+	// Text reference
+	{
+		Output a( a_name ), b( b_name );
+		for ( int k = 0; k < 100; ++k ) a.append( 0.1 * k, 1.0 / ( k + 3 ) );
+		for ( int k = 0; k < 50; ++k ) b.append( 0.25 * k, -2.0 * k );
+	}
+	std::string const a_text( contents( a_name ) );
+	std::string const b_text( contents( b_name ) );
+	std::remove( a_name.c_str() );
+	std::remove( b_name.c_str() );
+
+	// Binary with one producer thread per channel
+	BinaryOutput bin;
+	EXPECT_FALSE( bin.is_open() );
+	ASSERT_TRUE( bin.open( name, 4u ) ); // Small rings exercise wrap-around and producer waits
+	EXPECT_TRUE( bin.is_open() );
+	Output a( a_name, &bin ), b( b_name, &bin );
+	EXPECT_EQ( 2u, bin.n_channels() );
+	std::thread producer( [&b]{ for ( int k = 0; k < 50; ++k ) b.append( 0.25 * k, -2.0 * k ); } );
+	for ( int k = 0; k < 100; ++k ) a.append( 0.1 * k, 1.0 / ( k + 3 ) );
+	producer.join();
+	bin.close();
+	EXPECT_FALSE( bin.is_open() );
+	EXPECT_EQ( 150u, bin.written() );
+
+	// Conversion reproduces the text output
+	ASSERT_TRUE( BinaryOutput::convert( name ) );
+	EXPECT_EQ( a_text, contents( a_name ) );
+	EXPECT_EQ( b_text, contents( b_name ) );
+	std::remove( name.c_str() );
+	std::remove( a_name.c_str() );
+	std::remove( b_name.c_str() );
+}
+
+TEST( BinaryOutputTest, ConvertBadFile )
+{
+	std::string const name( "BinaryOutputTest.bad.bin" );
+	{
+		std::ofstream file( name, std::ios_base::binary | std::ios_base::out );
+		file << "Not a binary output file";
+	}
+	EXPECT_FALSE( BinaryOutput::convert( name ) );
+	std::remove( name.c_str() );
+}
@@ -0,0 +1,113 @@
+// ColumnarOutput Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/ColumnarOutput.hh>
+#include <QSS/ColumnarReader.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace QSS;
+
+TEST( ColumnarOutputTest, Basic )
+{
+	std::string const name( "ColumnarOutputTest.col" );
+	ColumnarOutput col;
+	EXPECT_FALSE( col.is_open() );
+	ASSERT_TRUE( col.open( name, 4u, 4096u ) ); // Small capacities exercise multiple chunks
+	EXPECT_TRUE( col.is_open() );
+	ColumnarOutput::Channel const a( col.add( "a.x.out" ) );
+	ColumnarOutput::Channel const b( col.add( "b.x.out" ) );
+	ColumnarOutput::Channel const c( col.add( "c.x.out" ) );
+	EXPECT_EQ( 3u, col.n_channels() );
+	for ( int k = 0; k <= 10; ++k ) col.append( a, 1.0 * k, 2.0 * k ); // Events at integer times
+	for ( int k = 1; k <= 100; ++k ) { // Samples at 0.1 steps: b joins at row 50
+		col.sample( a, 0.1 * k, -1.0 * k );
+		if ( k >= 50 ) col.sample( b, 0.1 * k, 3.0 * k );
+	}
+	col.append( c, 0.0, 7.0 );
+	col.close();
+	EXPECT_FALSE( col.is_open() );
+	EXPECT_LT( 3u, col.n_chunks() );
+
+	EXPECT_TRUE( ColumnarReader::is_columnar( name ) );
+	ColumnarReader reader( name );
+	ASSERT_TRUE( reader.is_open() );
+	EXPECT_EQ( 3u, reader.n_channels() );
+	EXPECT_EQ( "b.x.out", reader.name( b ) );
+	EXPECT_EQ( std::size_t( c ), reader.channel( "c.x.out" ) );
+	EXPECT_EQ( ColumnarReader::npos, reader.channel( "d.x.out" ) );
+	EXPECT_EQ( 2u, reader.n_columns() );
+	EXPECT_EQ( 100u, reader.n_rows() );
+
+	ColumnarReader::Points const e( reader.events( a ) );
+	ASSERT_EQ( 11u, e.size() );
+	EXPECT_EQ( 10.0, e[ 10 ].t );
+	EXPECT_EQ( 20.0, e[ 10 ].v );
+	ColumnarReader::Points const s( reader.samples( b ) );
+	ASSERT_EQ( 51u, s.size() );
+	EXPECT_EQ( 0.1 * 50, s[ 0 ].t );
+	EXPECT_EQ( 150.0, s[ 0 ].v );
+	EXPECT_TRUE( reader.samples( c ).empty() );
+	ColumnarReader::Points const p( reader.points( a ) );
+	ASSERT_EQ( 111u, p.size() );
+	for ( std::size_t i = 1; i < p.size(); ++i ) EXPECT_LE( p[ i - 1 ].t, p[ i ].t );
+	EXPECT_EQ( 1.0, p[ 10 ].t ); // Event before sample at equal time
+	EXPECT_EQ( 2.0, p[ 10 ].v );
+	EXPECT_EQ( -10.0, p[ 11 ].v );
+	reader.close();
+	EXPECT_FALSE( reader.is_open() );
+	std::remove( name.c_str() );
+}
+
+TEST( ColumnarOutputTest, BadFile )
+{
+	std::string const name( "ColumnarOutputTest.bad.col" );
+	{
+		std::ofstream file( name, std::ios_base::binary | std::ios_base::out );
+		file << "QSSCOL";
+	}
+	EXPECT_FALSE( ColumnarReader::is_columnar( name ) );
+	ColumnarReader reader;
+	EXPECT_FALSE( reader.open( name ) );
+	EXPECT_FALSE( reader.is_open() );
+	std::remove( name.c_str() );
+}
@@ -45,7 +45,18 @@
 using namespace QSS;
 
 // Variable Mock
-class V {};
+class V
+{
+public:
+	template< typename Iterator >
+	void
+	event( Iterator const & )
+	{
+		++n_events;
+	}
+	double tE{ 0.0 };
+	int n_events{ 0 };
+};
 
 // Types
 using EventQ = EventQueue< V >;
@@ -92,3 +103,61 @@ TEST( EventQueueTest, Basic )
 	events.clear();
 	EXPECT_TRUE( events.empty() );
 }
+
+TEST( EventQueueTest, Journal )
+{
+	Variables vars( 4 );
+	EventQ events;
+	EventQ::Journal journal;
+	std::vector< EventQ::iterator > its;
+	for ( Variables::size_type i = 0; i < 4; ++i ) {
+		its.push_back( events.add_QSS( Time( 1.0 ), &vars[ i ] ) ); // Same superdense time: Insertion order
+	}
+	events.journal( &journal );
+	events.set_active_time();
+	its[ 1 ] = events.shift_QSS( Time( 3.0 ), its[ 1 ] );
+	its[ 2 ] = events.shift_QSS( Time( 2.0 ), its[ 2 ] );
+	its[ 0 ] = events.shift_QSS( Time( 3.0 ), its[ 0 ] );
+	ASSERT_EQ( 3u, journal.size() );
+	EXPECT_EQ( &vars[ 1 ], journal[ 0 ].var );
+	EXPECT_EQ( 1u, journal[ 0 ].rank );
+	EXPECT_EQ( 1u, journal[ 1 ].rank );
+	EXPECT_EQ( 0u, journal[ 2 ].rank );
+	EXPECT_EQ( &vars[ 3 ], events.top_var() );
+
+	// Undone in reverse order the queue order is restored
+	for ( auto j = journal.size(); j-- > 0u; ) {
+		V * var( journal[ j ].var );
+		Variables::size_type const i( static_cast< Variables::size_type >( var - &vars[ 0 ] ) );
+		its[ i ] = events.unshift_QSS( journal[ j ], its[ i ] );
+	}
+	EXPECT_EQ( 4u, events.size() );
+	Variables::size_type i( 0u );
+	for ( auto const & event : events ) {
+		EXPECT_EQ( SuperdenseTime( Time( 1.0 ), EventQ::Off::QSS ), event.first );
+		EXPECT_EQ( &vars[ i++ ], event.second.var() );
+	}
+}
+
+TEST( EventQueueTest, BulkQSS )
+{
+	Variables vars( 6 );
+	double const tEs[] = { 2.0, 1.0, 3.0, 1.0, 2.0, 0.5 };
+	std::vector< V * > ptrs;
+	for ( Variables::size_type i = 0; i < 6; ++i ) {
+		vars[ i ].tE = tEs[ i ];
+		if ( i != 3u ) ptrs.push_back( &vars[ i ] );
+	}
+	EventQ events;
+	events.add_QSS( Time( 1.0 ), &vars[ 3 ] ); // Queued before the bulk build
+	events.add_QSS( ptrs );
+	EXPECT_EQ( 6u, events.size() );
+	for ( auto const * var : ptrs ) EXPECT_EQ( 1, var->n_events );
+
+	// Sorted by time with ties after the queued events in input order as with successive add_QSS calls
+	V const * order[] = { &vars[ 5 ], &vars[ 3 ], &vars[ 1 ], &vars[ 0 ], &vars[ 4 ], &vars[ 2 ] };
+	Variables::size_type i( 0u );
+	for ( auto const & event : events ) {
+		EXPECT_EQ( order[ i++ ], event.second.var() );
+	}
+}
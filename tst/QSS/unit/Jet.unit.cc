@@ -0,0 +1,124 @@
+// QSS::Jet Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Jet.hh>
+#include <QSS/math.hh>
+
+// C++ Headers
+#include <cmath>
+
+using namespace QSS;
+
+TEST( JetTest, Basic )
+{
+	using J = Jet< 3 >;
+	J const t( J::variable( 2.0 ) );
+	EXPECT_EQ( 2.0, t.v() );
+	EXPECT_EQ( 1.0, t.d1() );
+	EXPECT_EQ( 0.0, t.d2() );
+
+	// t^3 - 2 t
+	J const p( ( t * t * t ) - ( 2.0 * t ) );
+	EXPECT_DOUBLE_EQ( 4.0, p.v() );
+	EXPECT_DOUBLE_EQ( 10.0, p.d1() );
+	EXPECT_DOUBLE_EQ( 12.0, p.d2() );
+	EXPECT_DOUBLE_EQ( 6.0, p.d3() );
+
+	// 1 / t
+	J const r( 1.0 / t );
+	EXPECT_DOUBLE_EQ( 0.5, r.v() );
+	EXPECT_DOUBLE_EQ( -0.25, r.d1() );
+	EXPECT_DOUBLE_EQ( 0.25, r.d2() );
+	EXPECT_DOUBLE_EQ( -0.375, r.d3() );
+
+	// Derivatives round trip
+	J const d( J::derivatives( 1.0, 2.0, 3.0, 4.0 ) );
+	EXPECT_DOUBLE_EQ( 1.0, d.v() );
+	EXPECT_DOUBLE_EQ( 2.0, d.d1() );
+	EXPECT_DOUBLE_EQ( 3.0, d.d2() );
+	EXPECT_DOUBLE_EQ( 4.0, d.d3() );
+}
+
+TEST( JetTest, Functions )
+{
+	using J = Jet< 2 >;
+	double const x( 0.7 );
+	J const t( J::variable( x ) );
+
+	J const e( exp( 2.0 * t ) );
+	EXPECT_DOUBLE_EQ( std::exp( 2.0 * x ), e.v() );
+	EXPECT_DOUBLE_EQ( 2.0 * std::exp( 2.0 * x ), e.d1() );
+	EXPECT_DOUBLE_EQ( 4.0 * std::exp( 2.0 * x ), e.d2() );
+
+	J const l( log( t ) );
+	EXPECT_DOUBLE_EQ( std::log( x ), l.v() );
+	EXPECT_DOUBLE_EQ( 1.0 / x, l.d1() );
+	EXPECT_DOUBLE_EQ( -1.0 / ( x * x ), l.d2() );
+
+	J const s( sqrt( t ) );
+	EXPECT_DOUBLE_EQ( std::sqrt( x ), s.v() );
+	EXPECT_DOUBLE_EQ( 0.5 / std::sqrt( x ), s.d1() );
+	EXPECT_DOUBLE_EQ( -0.25 / ( x * std::sqrt( x ) ), s.d2() );
+
+	J const p( pow( t, 2.5 ) );
+	EXPECT_DOUBLE_EQ( std::pow( x, 2.5 ), p.v() );
+	EXPECT_DOUBLE_EQ( 2.5 * std::pow( x, 1.5 ), p.d1() );
+	EXPECT_DOUBLE_EQ( 3.75 * std::pow( x, 0.5 ), p.d2() );
+
+	J const sn( sin( 3.0 * t ) );
+	EXPECT_DOUBLE_EQ( std::sin( 3.0 * x ), sn.v() );
+	EXPECT_DOUBLE_EQ( 3.0 * std::cos( 3.0 * x ), sn.d1() );
+	EXPECT_DOUBLE_EQ( -9.0 * std::sin( 3.0 * x ), sn.d2() );
+
+	J const cs( cos( t ) );
+	EXPECT_DOUBLE_EQ( std::cos( x ), cs.v() );
+	EXPECT_DOUBLE_EQ( -std::sin( x ), cs.d1() );
+	EXPECT_DOUBLE_EQ( -std::cos( x ), cs.d2() );
+}
+
+TEST( JetTest, Nonlinear )
+{
+	// f( t, y ) = ( 1 + 2 t ) / ( y + 2 ) along y' = f: Compare with analytical f'
+	using J = Jet< 1 >;
+	double const t( 1.5 ), y( 3.0 );
+	double const f( ( 1.0 + ( 2.0 * t ) ) / ( y + 2.0 ) );
+	J const fj( ( 1.0 + ( 2.0 * J::variable( t ) ) ) / ( J::derivatives( y, f ) + 2.0 ) );
+	EXPECT_DOUBLE_EQ( f, fj.v() );
+	EXPECT_DOUBLE_EQ( ( 2.0 / ( y + 2.0 ) ) - ( square( 1.0 + ( 2.0 * t ) ) / std::pow( y + 2.0, 3 ) ), fj.d1() );
+}
@@ -0,0 +1,96 @@
+// OutputFilter Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/OutputFilter.hh>
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+using namespace QSS;
+
+TEST( OutputFilterTest, Default )
+{
+	OutputFilter const filter;
+	EXPECT_FALSE( filter.is_active() );
+	EXPECT_TRUE( filter( "x" ) );
+	EXPECT_TRUE( filter( "" ) );
+}
+
+TEST( OutputFilterTest, Glob )
+{
+	EXPECT_TRUE( OutputFilter::glob_match( "*", "" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "x*", "x12" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "*.T", "room.T" ) );
+	EXPECT_FALSE( OutputFilter::glob_match( "*.T", "room.Tset" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "r*m*.T", "room12.T" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "x?", "x1" ) );
+	EXPECT_FALSE( OutputFilter::glob_match( "x?", "x12" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "x[0-3]", "x2" ) );
+	EXPECT_FALSE( OutputFilter::glob_match( "x[0-3]", "x5" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "x[!0-3]", "x5" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "x[]]", "x]" ) );
+	EXPECT_TRUE( OutputFilter::glob_match( "x[", "x[" ) );
+	EXPECT_FALSE( OutputFilter::glob_match( "x", "xy" ) );
+}
+
+TEST( OutputFilterTest, IncludeExclude )
+{
+	OutputFilter const filter( std::vector< std::string >{ "x*", "re:^z[0-9]+$" }, std::vector< std::string >{ "x1*" } );
+	EXPECT_TRUE( filter.is_active() );
+	EXPECT_TRUE( filter( "x" ) );
+	EXPECT_TRUE( filter( "x2" ) );
+	EXPECT_FALSE( filter( "x1" ) );
+	EXPECT_FALSE( filter( "x10" ) );
+	EXPECT_TRUE( filter( "z42" ) );
+	EXPECT_FALSE( filter( "z4a" ) );
+	EXPECT_FALSE( filter( "y" ) );
+
+	OutputFilter const exclude_only( std::vector< std::string >{}, std::vector< std::string >{ "re:_d$" } );
+	EXPECT_TRUE( exclude_only( "x" ) );
+	EXPECT_FALSE( exclude_only( "x_d" ) );
+}
+
+TEST( OutputFilterTest, Valid )
+{
+	EXPECT_TRUE( OutputFilter::is_valid( "x*" ) );
+	EXPECT_TRUE( OutputFilter::is_valid( "re:x.*" ) );
+	EXPECT_FALSE( OutputFilter::is_valid( "" ) );
+	EXPECT_FALSE( OutputFilter::is_valid( "re:x(" ) );
+}
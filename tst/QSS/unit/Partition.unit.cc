@@ -0,0 +1,120 @@
+// QSS::Partition Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Partition.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Square Grid Adjacency
+Partition::Adjacency
+grid( std::size_t const m )
+{
+	Partition::Adjacency adj( m * m );
+	for ( std::size_t i = 0; i < m; ++i ) {
+		for ( std::size_t j = 0; j < m; ++j ) {
+			std::size_t const v( ( i * m ) + j );
+			if ( i + 1u < m ) adj[ v ].push_back( v + m );
+			if ( j + 1u < m ) adj[ v ].push_back( v + 1u );
+		}
+	}
+	return adj;
+}
+
+} // Internal
+
+TEST( PartitionTest, Trivial )
+{
+	Partition const empty( Partition::Adjacency(), 4u );
+	EXPECT_EQ( 0u, empty.size() );
+	EXPECT_EQ( 1u, empty.n_parts() );
+
+	Partition const one( grid( 4u ), 1u );
+	EXPECT_EQ( 16u, one.size() );
+	EXPECT_EQ( 1u, one.n_parts() );
+	EXPECT_EQ( 16u, one.count( 0u ) );
+	EXPECT_EQ( 0u, one.cut() );
+
+	// Parts clipped to the vertices
+	Partition const few( Partition::Adjacency{ { 1u }, { 2u }, {} }, 5u );
+	EXPECT_EQ( 3u, few.n_parts() );
+	for ( std::size_t p = 0; p < 3u; ++p ) EXPECT_EQ( 1u, few.count( p ) );
+	EXPECT_EQ( 2u, few.cut() );
+}
+
+TEST( PartitionTest, Grid )
+{
+	std::size_t const m( 40u );
+	for ( std::size_t const k : { 2u, 4u, 7u } ) {
+		Partition const partition( grid( m ), k );
+		EXPECT_EQ( m * m, partition.size() );
+		EXPECT_EQ( k, partition.n_parts() );
+		std::size_t n( 0u );
+		for ( std::size_t p = 0; p < k; ++p ) {
+			std::size_t const c( partition.count( p ) );
+			EXPECT_LE( ( 90u * m * m ) / ( 100u * k ), c ); // Balanced
+			EXPECT_GE( ( 103u * m * m ) / ( 100u * k ) + 1u, c );
+			n += c;
+		}
+		EXPECT_EQ( m * m, n );
+		EXPECT_LE( partition.cut(), 2u * ( k - 1u ) * m ); // Near strip or block cuts
+	}
+}
+
+TEST( PartitionTest, Components )
+{
+	// Two disconnected cliques split without cut edges
+	Partition::Adjacency adj( 16u );
+	for ( std::size_t i = 0; i < 16u; ++i ) {
+		for ( std::size_t j = 0; j < 16u; ++j ) {
+			if ( ( i != j ) && ( ( i < 8u ) == ( j < 8u ) ) ) adj[ i ].push_back( j );
+		}
+	}
+	Partition const partition( adj, 2u );
+	EXPECT_EQ( 0u, partition.cut() );
+	EXPECT_EQ( 8u, partition.count( 0u ) );
+	for ( std::size_t i = 1; i < 8u; ++i ) EXPECT_EQ( partition[ 0 ], partition[ i ] );
+	EXPECT_NE( partition[ 0 ], partition[ 8 ] );
+}
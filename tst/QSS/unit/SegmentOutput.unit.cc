@@ -0,0 +1,147 @@
+// SegmentOutput Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/SegmentOutput.hh>
+#include <QSS/SegmentReader.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Quadratic Test Variable
+struct Var
+{
+	Var( std::string const & name ) :
+	 name( name )
+	{}
+
+	double x( double const t ) const { return x_0 + ( ( x_1 + ( x_2 * ( t - tX ) ) ) * ( t - tX ) ); }
+	double x1( double const t ) const { return x_1 + ( 2.0 * x_2 * ( t - tX ) ); }
+	double x2( double const ) const { return 2.0 * x_2; }
+	double x3( double const ) const { return 0.0; }
+	double q( double const t ) const { return q_0 + ( q_1 * ( t - tQ ) ); }
+	double q1( double const ) const { return q_1; }
+	double q2( double const ) const { return 0.0; }
+
+	std::string name;
+	double tX{ 0.0 }, tQ{ 0.0 };
+	double x_0{ 0.0 }, x_1{ 0.0 }, x_2{ 0.0 };
+	double q_0{ 0.0 }, q_1{ 0.0 };
+};
+
+} // namespace
+
+TEST( SegmentOutputTest, Basic )
+{
+	std::string const name( "SegmentOutputTest.seg" );
+	Var a( "a" ), b( "b" );
+	a.x_0 = a.q_0 = 1.0;
+	a.x_1 = a.q_1 = 2.0;
+	a.x_2 = 0.5;
+	b.x_0 = b.q_0 = -1.0;
+	std::vector< Var * > vars{ &a, &b };
+
+	SegmentOutput seg;
+	EXPECT_FALSE( seg.is_open() );
+	ASSERT_TRUE( seg.open( name, 0.0, true, true, 2u ) ); // Small staging exercises multiple writes
+	EXPECT_TRUE( seg.is_open() );
+	seg.add_all( vars );
+	EXPECT_EQ( 2u, seg.n_vars() );
+	EXPECT_EQ( 4u, seg.n_segments() );
+	seg.log( &a ); // Unchanged: Skipped
+	EXPECT_EQ( 4u, seg.n_segments() );
+	a.x_0 = a.x( 1.0 ); // Requantize a at t=1
+	a.x_1 = a.x1( 1.0 );
+	a.tX = a.tQ = 1.0;
+	a.q_0 = a.x_0;
+	a.q_1 = a.x_1;
+	seg.log( &a );
+	EXPECT_EQ( 6u, seg.n_segments() );
+	b.x_0 = 3.0; // Observer advance of b at t=2: x only
+	b.x_1 = -1.0;
+	b.tX = 2.0;
+	seg.log_all( vars );
+	EXPECT_EQ( 7u, seg.n_segments() );
+	seg.close( 4.0 );
+	EXPECT_FALSE( seg.is_open() );
+
+	EXPECT_TRUE( SegmentReader::is_segment( name ) );
+	SegmentReader reader( name );
+	ASSERT_TRUE( reader.is_open() );
+	EXPECT_EQ( 2u, reader.n_vars() );
+	EXPECT_EQ( 0.0, reader.t0() );
+	EXPECT_EQ( 4.0, reader.tE() );
+	EXPECT_EQ( 1u, reader.index( "b" ) );
+	EXPECT_EQ( SegmentReader::npos, reader.index( "c" ) );
+	EXPECT_EQ( 2u, reader.segments( 0u, SegmentReader::Rep::x ).size() );
+	EXPECT_EQ( 2u, reader.segments( 1u, SegmentReader::Rep::x ).size() );
+	EXPECT_EQ( 1u, reader.segments( 1u, SegmentReader::Rep::q ).size() );
+	EXPECT_DOUBLE_EQ( 1.0 + 2.0 * 0.5 + 0.5 * 0.25, reader.x( 0u, 0.5 ) );
+	EXPECT_DOUBLE_EQ( a.x( 3.0 ), reader.x( 0u, 3.0 ) );
+	EXPECT_DOUBLE_EQ( a.q( 3.0 ), reader.q( 0u, 3.0 ) );
+	EXPECT_DOUBLE_EQ( -1.0, reader.x( 1u, 1.5 ) );
+	EXPECT_DOUBLE_EQ( 2.0, reader.x( 1u, 3.0 ) );
+	EXPECT_DOUBLE_EQ( -1.0, reader.q( 1u, 3.0 ) );
+
+	SegmentReader::Cursor x( reader.cursor( 1u ) );
+	EXPECT_DOUBLE_EQ( -1.0, x( 0.0 ) );
+	EXPECT_DOUBLE_EQ( 3.0, x( 2.0 ) );
+	EXPECT_DOUBLE_EQ( -1.0, x( 1.0 ) ); // Back
+	SegmentReader::Points const p( reader.resample( 1u, SegmentReader::Rep::x, 1.5 ) );
+	ASSERT_EQ( 4u, p.size() ); // 0, 1.5, 3, 4
+	EXPECT_EQ( 3.0, p[ 2 ].t );
+	EXPECT_DOUBLE_EQ( 2.0, p[ 2 ].v );
+	EXPECT_EQ( 4.0, p[ 3 ].t );
+	EXPECT_DOUBLE_EQ( 1.0, p[ 3 ].v );
+	std::remove( name.c_str() );
+}
+
+TEST( SegmentOutputTest, BadFile )
+{
+	std::string const name( "SegmentOutputTest.bad.seg" );
+	EXPECT_FALSE( SegmentReader::is_segment( name ) );
+	SegmentReader reader;
+	EXPECT_FALSE( reader.open( name ) );
+	EXPECT_FALSE( reader.is_open() );
+}
@@ -0,0 +1,148 @@
+// QSS::ThreadPool Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/ThreadPool.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace QSS;
+
+TEST( ThreadPoolTest, Serial )
+{
+	ThreadPool pool( 1u );
+	EXPECT_EQ( 1u, pool.size() );
+	std::vector< int > hits( 10, 0 );
+	pool.parallel_for( hits.size(), [&hits]( std::size_t const i ){ ++hits[ i ]; } );
+	for ( int const hit : hits ) EXPECT_EQ( 1, hit );
+}
+
+TEST( ThreadPoolTest, ParallelFor )
+{
+	ThreadPool pool( 4u );
+	EXPECT_EQ( 4u, pool.size() );
+	pool.parallel_for( 0u, []( std::size_t const ){ FAIL(); } );
+
+	// Each index exactly once over repeated loops with various sizes and grains
+	for ( std::size_t n : { 1u, 3u, 4u, 5u, 100u, 1001u } ) {
+		for ( std::size_t grain : { 1u, 2u, 7u, 64u } ) {
+			std::vector< int > hits( n, 0 );
+			for ( int pass = 0; pass < 3; ++pass ) {
+				pool.parallel_for( n, [&hits]( std::size_t const i ){ ++hits[ i ]; }, grain );
+			}
+			for ( int const hit : hits ) EXPECT_EQ( 3, hit );
+		}
+	}
+}
+
+TEST( ThreadPoolTest, Deterministic )
+{
+	ThreadPool pool( 3u, true );
+	EXPECT_TRUE( pool.deterministic() );
+
+	// Each index on the same thread in every loop
+	std::size_t const n( 1000u );
+	std::vector< std::thread::id > ids( n );
+	pool.parallel_for( n, [&ids]( std::size_t const i ){ ids[ i ] = std::this_thread::get_id(); }, 16u );
+	for ( int pass = 0; pass < 5; ++pass ) {
+		std::vector< std::thread::id > pass_ids( n );
+		pool.parallel_for( n, [&pass_ids]( std::size_t const i ){ pass_ids[ i ] = std::this_thread::get_id(); }, 16u );
+		EXPECT_TRUE( ids == pass_ids );
+	}
+	for ( std::size_t i = 0; i < n / 3u; ++i ) EXPECT_EQ( std::this_thread::get_id(), ids[ i ] ); // Calling thread's part
+}
+
+TEST( ThreadPoolTest, ThreadIndex )
+{
+	ThreadPool pool( 3u, true );
+	EXPECT_EQ( 0u, ThreadPool::thread_index() );
+
+	// Deterministic parts: Indexes of part k run on the thread with index k
+	std::size_t const n( 300u );
+	std::vector< std::size_t > index( n, n );
+	std::vector< std::thread::id > ids( n );
+	pool.parallel_for( n, [&index,&ids]( std::size_t const i ){ index[ i ] = ThreadPool::thread_index(); ids[ i ] = std::this_thread::get_id(); }, 10u );
+	for ( std::size_t i = 0; i < n; ++i ) {
+		EXPECT_EQ( i / 100u, index[ i ] );
+		if ( index[ i ] == 0u ) EXPECT_EQ( std::this_thread::get_id(), ids[ i ] );
+	}
+}
+
+TEST( ThreadPoolTest, Pin )
+{
+	ThreadPool pool( 2u, false, true );
+	std::vector< int > hits( 100, 0 );
+	pool.parallel_for( hits.size(), [&hits]( std::size_t const i ){ ++hits[ i ]; } );
+	for ( int const hit : hits ) EXPECT_EQ( 1, hit );
+}
+
+TEST( ThreadPoolTest, TaskGroup )
+{
+	ThreadPool pool( 4u );
+	std::vector< int > hits( 5, 0 );
+	{
+		ThreadPool::TaskGroup group( pool );
+		for ( std::size_t i = 0; i < 4u; ++i ) group.run( [&hits,i](){ hits[ i ] += int( i ) + 1; } );
+		EXPECT_EQ( 4u, group.size() );
+		group.wait();
+		EXPECT_EQ( 0u, group.size() );
+		group.run( [&hits](){ hits[ 4 ] = 5; } ); // Run by the destructor
+	}
+	for ( std::size_t i = 0; i < hits.size(); ++i ) EXPECT_EQ( int( i ) + 1, hits[ i ] );
+}
+
+TEST( ThreadPoolTest, Reduce )
+{
+	std::size_t const n( 10007u );
+	auto const f( []( std::size_t const i ){ return 1.0 / ( 1.0 + double( i ) * double( i ) ); } );
+	auto const plus( []( double const a, double const b ){ return a + b; } );
+	ThreadPool serial( 1u );
+	double const sum( serial.reduce( n, 0.0, f, plus, 64u ) );
+	for ( std::size_t n_threads : { 2u, 3u, 4u } ) { // Same bits for any threads
+		ThreadPool pool( n_threads );
+		EXPECT_EQ( sum, pool.reduce( n, 0.0, f, plus, 64u ) );
+	}
+	EXPECT_NEAR( 2.0767, sum, 1.0e-3 ); // ( 1 + pi coth pi ) / 2 - O( 1 / n )
+	EXPECT_EQ( 7, serial.reduce( 0u, 7, []( std::size_t const ){ return 1; }, []( int const a, int const b ){ return a + b; } ) );
+	ThreadPool pool( 4u );
+	EXPECT_EQ( std::size_t( 999u ), pool.reduce( 1000u, std::size_t( 0u ), []( std::size_t const i ){ return i; }, []( std::size_t const a, std::size_t const b ){ return std::max( a, b ); }, 7u ) );
+}
@@ -0,0 +1,79 @@
+// Tracer Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Tracer.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace QSS;
+
+TEST( TracerTest, Basic )
+{
+	std::string const name( "TracerTest.json" );
+	Tracer tracer;
+	EXPECT_FALSE( tracer.is_open() );
+	ASSERT_TRUE( tracer.open( name, 4u ) ); // Small ring exercises wrap-around and producer waits
+	EXPECT_TRUE( tracer.is_open() );
+	for ( int k = 0; k < 100; ++k ) {
+		tracer.begin( SuperdenseTime( 0.5 * k, 2u ) );
+		tracer.end( k % 2 == 0 ? Tracer::Type::QSS : Tracer::Type::ZC, 1u + k, 3u );
+	}
+	tracer.close();
+	EXPECT_FALSE( tracer.is_open() );
+	EXPECT_EQ( 100u, tracer.written() );
+
+	std::ifstream file( name );
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	file.close();
+	std::remove( name.c_str() );
+	std::string const json( buffer.str() );
+	EXPECT_EQ( 0u, json.find( "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" ) );
+	EXPECT_EQ( json.length() - 4u, json.rfind( "]}\n" ) - 1u );
+	EXPECT_NE( std::string::npos, json.find( "\"name\":\"QSS\"" ) );
+	EXPECT_NE( std::string::npos, json.find( "\"name\":\"ZC\"" ) );
+	EXPECT_NE( std::string::npos, json.find( "\"t\":49.5,\"i\":2,\"triggers\":100,\"observers\":3" ) );
+	std::size_t n( 0u );
+	for ( std::size_t i = json.find( "\"ph\":\"X\"" ); i != std::string::npos; i = json.find( "\"ph\":\"X\"", i + 1u ) ) ++n;
+	EXPECT_EQ( 100u, n );
+}
@@ -0,0 +1,115 @@
+// VariableStats Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/VariableStats.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+struct V
+{
+	explicit
+	V( std::string const & name ) :
+	 name( name )
+	{}
+
+	std::string name;
+	std::size_t stats_slot{ 0u };
+};
+
+} // Internal
+
+TEST( VariableStatsTest, Counts )
+{
+	V x( "x" ), y( "y" ), z( "z" );
+	std::vector< V * > vars{ &x, &y, &z };
+	std::vector< V * > observers{ &y, &z };
+	VariableStats< V > stats( vars, 0.0 );
+	stats.QSS( &x, 1.0 );
+	stats.observers( observers );
+	stats.QSS( &x, 1.5 );
+	stats.observers( observers );
+	stats.QSS( &x, 3.5 );
+	stats.ZC( &z );
+	stats.handler( &y, 2.0 );
+	stats.observer( &x );
+	stats.discrete( &z, 3.0 );
+
+	EXPECT_EQ( 3u, stats[ &x ].n_QSS );
+	EXPECT_EQ( 1u, stats[ &x ].n_observer );
+	EXPECT_EQ( 0.5, stats[ &x ].dt_min );
+	EXPECT_EQ( 2.0, stats[ &x ].dt_max );
+	EXPECT_DOUBLE_EQ( 3.5 / 3.0, stats[ &x ].dt_mean() );
+	EXPECT_EQ( 2u, stats[ &y ].n_observer );
+	EXPECT_EQ( 1u, stats[ &y ].n_handler );
+	EXPECT_EQ( 2.0, stats[ &y ].dt_mean() );
+	EXPECT_EQ( 1u, stats[ &z ].n_ZC );
+	EXPECT_EQ( 1u, stats[ &z ].n_discrete );
+	EXPECT_EQ( 0u, stats[ &z ].n_handler );
+	EXPECT_EQ( 3.0, stats[ &z ].dt_mean() );
+
+	std::string const name( "VariableStatsTest.csv" );
+	stats.write( name );
+	std::ifstream csv( name );
+	std::string header, line1, line2, line3;
+	std::getline( csv, header );
+	std::getline( csv, line1 );
+	std::getline( csv, line2 );
+	std::getline( csv, line3 );
+	csv.close();
+	std::remove( name.c_str() );
+	EXPECT_EQ( "name,requantizations,observer_advances,zero_crossings,discrete_events,handler_events,dt_min,dt_mean,dt_max", header );
+	EXPECT_EQ( 0u, line1.find( "x,3,1,0,0,0," ) ); // Hottest first
+	EXPECT_EQ( "z,0,2,1,1,0,3,3,3", line2 );
+	EXPECT_EQ( "y,0,2,0,0,1,2,2,2", line3 );
+
+	std::ostringstream report;
+	stats.report( report, 1u );
+	EXPECT_NE( std::string::npos, report.str().find( "x: 3 requantizations" ) );
+	EXPECT_EQ( std::string::npos, report.str().find( "y:" ) );
+}
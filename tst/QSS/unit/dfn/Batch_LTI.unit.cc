@@ -0,0 +1,147 @@
+// QSS::dfn::Batch_LTI Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/Batch_LTI.hh>
+#include <QSS/dfn/Simulator.hh>
+
+using namespace QSS;
+using namespace QSS::dfn;
+
+namespace {
+
+// Member Options
+Simulator::Options
+member_opts( double const rTol, double const x1 )
+{
+	Simulator::Options opts;
+	opts.model = "achilles";
+	opts.rTol = rTol;
+	opts.tEnd = 5.0;
+	opts.xIni[ "x1" ] = x1;
+	opts.outputs = false;
+	opts.report = false;
+	return opts;
+}
+
+} // Internal
+
+TEST( Batch_LTITest, Members )
+{
+	Simulator::Options opts( member_opts( 1.0e-4, 0.0 ) );
+	opts.xIni.clear();
+	Simulator model( opts );
+	model.init();
+	ASSERT_TRUE( Batch_LTI::is_batchable( model.vars() ) );
+	double const rTols[] = { 1.0e-4, 1.0e-4, 1.0e-3, 1.0e-4 };
+	double const x1s[] = { 0.0, 0.01, 0.0, -0.5 };
+	Batch_LTI batch( model.vars(), 4u, model.tE() );
+	EXPECT_EQ( 4u, batch.n_lanes() );
+	ASSERT_EQ( 2u, batch.n_vars() );
+	std::size_t const i1( batch.index( "x1" ) ), i2( batch.index( "x2" ) );
+	EXPECT_EQ( "x1", batch.name( i1 ) );
+	EXPECT_EQ( batch.n_vars(), batch.index( "none" ) );
+	for ( std::size_t l = 0; l < 4u; ++l ) {
+		batch.set_rTol( l, rTols[ l ] );
+		batch.set_xIni( l, i1, x1s[ l ] );
+	}
+	batch.set_tEnd( 3u, 2.5 );
+	batch.init();
+	batch.run();
+	EXPECT_LT( 0u, batch.n_passes() );
+
+	// Each lane matches its own simulation
+	for ( std::size_t l = 0; l < 4u; ++l ) {
+		Simulator::Options member( member_opts( rTols[ l ], x1s[ l ] ) );
+		if ( l == 3u ) member.tEnd = 2.5;
+		Simulator sim( member );
+		sim.init();
+		sim.advance_to( sim.tE() );
+		sim.finish();
+		EXPECT_DOUBLE_EQ( sim.tE(), batch.t( l ) );
+		EXPECT_EQ( sim.results().n_QSS_events, batch.n_QSS_events( l ) );
+		EXPECT_DOUBLE_EQ( sim.x( "x1" ), batch.x( l, i1 ) );
+		EXPECT_DOUBLE_EQ( sim.x( "x2" ), batch.x( l, i2 ) );
+	}
+}
+
+TEST( Batch_LTITest, Simultaneous )
+{
+	Simulator::Options opts;
+	opts.model = "achilles2"; // Variables requantize together
+	opts.tEnd = 5.0;
+	opts.outputs = false;
+	opts.report = false;
+	Simulator model( opts );
+	model.init();
+	ASSERT_TRUE( Batch_LTI::is_batchable( model.vars() ) );
+	double const rTols[] = { 1.0e-4, 1.0e-3, 1.0e-4 };
+	Batch_LTI batch( model.vars(), 3u, model.tE() );
+	for ( std::size_t l = 0; l < 3u; ++l ) batch.set_rTol( l, rTols[ l ] );
+	batch.set_tEnd( 2u, 2.5 );
+	batch.init();
+	batch.run();
+
+	// Simultaneous requantizations are staged and counted as in each lane's own simulation
+	for ( std::size_t l = 0; l < 3u; ++l ) {
+		Simulator::Options member( opts );
+		member.rTol = rTols[ l ];
+		if ( l == 2u ) member.tEnd = 2.5;
+		Simulator sim( member );
+		sim.init();
+		sim.advance_to( sim.tE() );
+		sim.finish();
+		EXPECT_LT( 0u, sim.results().n_QSS_simultaneous_events );
+		EXPECT_EQ( sim.results().n_QSS_events, batch.n_QSS_events( l ) );
+		EXPECT_EQ( sim.results().n_QSS_simultaneous_events, batch.n_QSS_simultaneous_events( l ) );
+		for ( std::size_t i = 0; i < batch.n_vars(); ++i ) {
+			EXPECT_EQ( sim.x( batch.name( i ) ), batch.x( l, i ) );
+		}
+	}
+}
+
+TEST( Batch_LTITest, Batchable )
+{
+	Simulator::Options opts;
+	opts.model = "bball";
+	opts.outputs = false;
+	opts.report = false;
+	Simulator sim( opts );
+	sim.init();
+	EXPECT_FALSE( Batch_LTI::is_batchable( sim.vars() ) );
+}
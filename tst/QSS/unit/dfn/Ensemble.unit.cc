@@ -0,0 +1,117 @@
+// Ensemble Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/Ensemble.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+
+using namespace QSS;
+using namespace QSS::dfn;
+
+namespace {
+
+// Tolerance Sweep Scenarios
+Ensemble::Scenarios
+sweep( std::string const & model )
+{
+	Ensemble::Scenarios scenarios;
+	double rTol( 1.0e-2 );
+	for ( int i = 0; i < 6; ++i, rTol *= 0.5 ) {
+		Ensemble::Scenario scenario;
+		scenario.name = std::to_string( i );
+		scenario.opts.model = model;
+		scenario.opts.rTol = rTol;
+		scenarios.push_back( scenario );
+	}
+	return scenarios;
+}
+
+} // Internal
+
+TEST( EnsembleTest, Concurrent )
+{
+	Ensemble::Scenarios const scenarios( sweep( "achilles" ) );
+	Ensemble sequential( scenarios );
+	Ensemble concurrent( scenarios );
+	sequential.run( 1u );
+	concurrent.run( 4u );
+	EXPECT_EQ( 1u, sequential.n_threads() );
+	EXPECT_EQ( 4u, concurrent.n_threads() );
+	ASSERT_EQ( scenarios.size(), concurrent.results().size() );
+	for ( std::size_t i = 0; i < scenarios.size(); ++i ) {
+		Ensemble::Result const & s( sequential.results()[ i ] );
+		Ensemble::Result const & c( concurrent.results()[ i ] );
+		EXPECT_DOUBLE_EQ( 10.0, c.tE ); // Model default end time
+		EXPECT_EQ( s.results.n_QSS_events, c.results.n_QSS_events );
+		EXPECT_LT( 0u, c.results.n_QSS_events );
+		if ( i > 0u ) { // Tighter tolerance
+			EXPECT_LE( concurrent.results()[ i - 1 ].results.n_QSS_events, c.results.n_QSS_events );
+		}
+	}
+}
+
+TEST( EnsembleTest, Read )
+{
+	std::string const file_name( "Ensemble.unit.txt" );
+	{
+		std::ofstream file( file_name );
+		file << "# Scenarios\n";
+		file << "name=base rTol=1e-3 aTol=1e-8 seed=5 tEnd=2.5\n";
+		file << "\n";
+		file << "rTol=1e-5  # Tight\n";
+	}
+	Ensemble::Scenarios scenarios;
+	EXPECT_TRUE( Ensemble::read( file_name, scenarios ) );
+	ASSERT_EQ( 2u, scenarios.size() );
+	EXPECT_EQ( "base", scenarios[ 0 ].name );
+	EXPECT_DOUBLE_EQ( 1.0e-3, scenarios[ 0 ].opts.rTol );
+	EXPECT_DOUBLE_EQ( 1.0e-8, scenarios[ 0 ].opts.aTol );
+	EXPECT_EQ( 5u, scenarios[ 0 ].opts.seed );
+	EXPECT_DOUBLE_EQ( 2.5, scenarios[ 0 ].opts.tEnd );
+	EXPECT_EQ( "2", scenarios[ 1 ].name );
+	EXPECT_DOUBLE_EQ( 1.0e-5, scenarios[ 1 ].opts.rTol );
+	{
+		std::ofstream file( file_name );
+		file << "rTol=tight\n";
+	}
+	EXPECT_FALSE( Ensemble::read( file_name, scenarios ) );
+	std::remove( file_name.c_str() );
+}
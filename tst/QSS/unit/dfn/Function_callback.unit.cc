@@ -0,0 +1,184 @@
+// Function_callback Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/mdl/Function_callback.hh>
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/Variable_LIQSS1.hh>
+#include <QSS/dfn/Variable_QSS2.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+using namespace QSS;
+using namespace QSS::dfn;
+using namespace QSS::dfn::mdl;
+
+extern "C" {
+
+// 12 + 2 x
+double
+affine( double, double const * x, void * )
+{
+	return 12.0 + ( 2.0 * x[ 0 ] );
+}
+
+// Achilles and the Tortoise with a Third Variable Driven by Achilles
+double
+achilles_1( double, double const * x, void * )
+{
+	return ( -0.5 * x[ 0 ] ) + ( 1.5 * x[ 1 ] );
+}
+
+double
+achilles_2( double, double const * x, void * )
+{
+	return -x[ 0 ];
+}
+
+double
+achilles_3( double, double const * x, void * )
+{
+	return x[ 0 ];
+}
+
+// Batch Evaluation Counts
+struct Counts
+{
+	int calls;
+	std::size_t outputs;
+};
+
+// Achilles and the Tortoise Batch: Counts calls and outputs in data
+void
+achilles_batch( double t, std::size_t n, std::size_t const * i, double const * x, double * d, void * data )
+{
+	for ( std::size_t k = 0; k < n; ++k ) {
+		if ( i[ k ] == 0u ) {
+			d[ k ] = achilles_1( t, x, nullptr );
+			x += 2;
+		} else if ( i[ k ] == 1u ) {
+			d[ k ] = achilles_2( t, x, nullptr );
+			x += 1;
+		} else {
+			d[ k ] = achilles_3( t, x, nullptr );
+			x += 1;
+		}
+	}
+	Counts & counts( *static_cast< Counts * >( data ) );
+	++counts.calls;
+	counts.outputs += n;
+}
+
+}
+
+TEST( Function_callbackTest, Basic )
+{
+	Variable_QSS2< Function_callback > x1( "x1" );
+	x1.d().callback( affine ).add( x1 );
+	x1.init( 2.5 );
+	EXPECT_DOUBLE_EQ( 2.5 + 17.0e-6, x1.q( 1.0e-6 ) );
+	EXPECT_DOUBLE_EQ( 17.0, x1.q1( 1.0e-6 ) );
+	EXPECT_EQ( 0.0, x1.tQ );
+	EXPECT_NEAR( std::sqrt( std::max( x1.rTol * 2.5, x1.aTol ) / 17.0 ), x1.tE, 1.0e-6 );
+	double const x1_tE( x1.tE );
+	x1.advance_QSS();
+	EXPECT_EQ( x1_tE, x1.tQ );
+	events.clear();
+}
+
+TEST( Function_callbackTest, LIQSS1 )
+{
+	Variable_LIQSS1< Function_callback > x1( "x1" );
+	x1.d().callback( affine ).add( x1 );
+	Variable_LIQSS1< Function_LTI > y1( "y1" );
+	y1.d().add( 12.0 ).add( 2.0, y1 );
+	x1.init( 2.5 );
+	y1.init( 2.5 );
+	EXPECT_DOUBLE_EQ( y1.q( 0.0 ), x1.q( 0.0 ) );
+	EXPECT_DOUBLE_EQ( y1.x1( 0.0 ), x1.x1( 0.0 ) );
+	EXPECT_DOUBLE_EQ( y1.tE, x1.tE );
+	events.clear();
+}
+
+TEST( Function_callbackTest, Batch )
+{
+	Counts counts{ 0, 0u };
+	Callback_batch< Variable > batch( achilles_batch, &counts );
+	batch.add_outputs( 3u );
+	Variable_QSS2< Function_callback > x1( "x1" );
+	Variable_QSS2< Function_callback > x2( "x2" );
+	Variable_QSS2< Function_callback > x3( "x3" );
+	x1.d().callback( batch, 0 ).add( x1 ).add( x2 );
+	x2.d().callback( batch, 1 ).add( x1 );
+	x3.d().callback( batch, 2 ).add( x1 );
+	Variable_QSS2< Function_callback > y1( "y1" );
+	Variable_QSS2< Function_callback > y2( "y2" );
+	Variable_QSS2< Function_callback > y3( "y3" );
+	y1.d().callback( achilles_1 ).add( y1 ).add( y2 );
+	y2.d().callback( achilles_2 ).add( y1 );
+	y3.d().callback( achilles_3 ).add( y1 );
+	for ( Variable * v : Variable::Variables{ &x1, &x2, &x3, &y1, &y2, &y3 } ) v->init_0( v->name.back() == '1' ? 0.0 : ( v->name.back() == '2' ? 2.0 : 100.0 ) ); // Achilles requantizes first
+	for ( Variable * v : Variable::Variables{ &x1, &x2, &x3, &y1, &y2, &y3 } ) v->init_1();
+	for ( Variable * v : Variable::Variables{ &x1, &x2, &x3, &y1, &y2, &y3 } ) v->init_2();
+	EXPECT_DOUBLE_EQ( 3.0, x1.q1( 0.0 ) );
+	EXPECT_DOUBLE_EQ( 0.0, x2.q1( 0.0 ) );
+
+	// Achilles' requantization evaluates its observers' outputs in one call per time: t and t + dtn for QSS2
+	counts = Counts{ 0, 0u };
+	x1.advance_QSS();
+	y1.advance_QSS();
+	EXPECT_EQ( 2 + 2, counts.calls ); // Own requantization then the observer pass
+	EXPECT_EQ( 2u + 4u, counts.outputs );
+	double const t( x1.tQ );
+	EXPECT_EQ( y1.tQ, t );
+	EXPECT_EQ( y2.x1( t ), x2.x1( t ) );
+	EXPECT_EQ( y2.x2( t ), x2.x2( t ) );
+	EXPECT_EQ( y3.x1( t ), x3.x1( t ) );
+	EXPECT_EQ( y3.x2( t ), x3.x2( t ) );
+	EXPECT_EQ( y2.tE, x2.tE );
+	EXPECT_EQ( y3.tE, x3.tE );
+
+	// Outside a pass the outputs evaluate directly
+	double d( 0.0 );
+	EXPECT_FALSE( batch.cached( 1u, t, d ) );
+	EXPECT_DOUBLE_EQ( -x1.q( t ), x2.d().q( t ) );
+	events.clear();
+}
@@ -0,0 +1,91 @@
+// LTI Model File Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/mdl/LTI_file.hh>
+#include <QSS/dfn/mdl/Function_LTI.hh>
+#include <QSS/dfn/Variable_QSS.hh>
+#include <QSS/dfn/Variable_ZC.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+
+using namespace QSS;
+using namespace QSS::dfn;
+using namespace QSS::dfn::mdl;
+
+TEST( LTI_fileTest, Basic )
+{
+	EXPECT_TRUE( is_LTI_file( "model.lti" ) );
+	EXPECT_FALSE( is_LTI_file( "model.fmu" ) );
+	EXPECT_FALSE( is_LTI_file( ".lti" ) );
+
+	std::string const path( "LTI_fileTest.lti" );
+	{
+		std::ofstream file( path );
+		file << "# Test model\n";
+		file << "var x1 0.0\n";
+		file << "var x2 2.0 QSS3 1e-5 1e-7\n";
+		file << "inp u step 0.0 1.0 2.0\n";
+		file << "der x1 1.0 -0.5 x1 1.5 x2 # Trailing comment\n";
+		file << "\n";
+		file << "der x2 0.0 -1.0 x1\n";
+		file << "term x2 2.0 u\n";
+		file << "zc z Dn -1.0 1.0 x1\n";
+		file << "reset z x2 0.0 5.0";
+	}
+	Parameters params;
+	params.rTol = 1.0e-3; // Default for x1
+	Variables vars;
+	LTI_file( vars, path, params );
+	std::remove( path.c_str() );
+	ASSERT_EQ( 4u, vars.size() );
+	EXPECT_EQ( "x1", vars[ 0 ]->name );
+	EXPECT_EQ( "x2", vars[ 1 ]->name );
+	EXPECT_EQ( "u", vars[ 2 ]->name );
+	EXPECT_EQ( "z", vars[ 3 ]->name );
+	EXPECT_EQ( 1.0e-3, vars[ 0 ]->rTol );
+	EXPECT_EQ( 2.0, vars[ 1 ]->xIni );
+	EXPECT_EQ( 3, vars[ 1 ]->order() );
+	EXPECT_EQ( 1.0e-5, vars[ 1 ]->rTol );
+	EXPECT_EQ( 1.0e-7, vars[ 1 ]->aTol );
+	EXPECT_TRUE( vars[ 2 ]->is_Input() );
+	EXPECT_TRUE( vars[ 3 ]->is_ZC() );
+	for ( auto var : vars ) delete var;
+}
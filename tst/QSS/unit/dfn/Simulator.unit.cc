@@ -0,0 +1,470 @@
+// Simulator Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/Simulator.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <stdexcept>
+
+using namespace QSS;
+using namespace QSS::dfn;
+
+namespace {
+
+// No Trajectory Outputs Scope
+struct NoOutputs
+{
+	NoOutputs() :
+	 t( options::output::t ),
+	 r( options::output::r ),
+	 s( options::output::s )
+	{
+		options::output::t = options::output::r = options::output::s = false;
+	}
+
+	~NoOutputs()
+	{
+		options::output::t = t;
+		options::output::r = r;
+		options::output::s = s;
+	}
+
+	bool const t, r, s;
+};
+
+} // Internal
+
+TEST( SimulatorTest, Incremental )
+{
+	NoOutputs const no_outputs;
+	Simulator::Options opts;
+	opts.model = "achilles";
+	opts.tEnd = 2.0;
+	Simulator whole( opts );
+	Simulator steps( opts );
+	EXPECT_FALSE( whole.initialized() );
+	whole.init();
+	steps.init();
+	EXPECT_TRUE( whole.initialized() );
+	ASSERT_EQ( 2u, whole.vars().size() );
+	EXPECT_DOUBLE_EQ( 0.0, whole.x( "x1" ) );
+	EXPECT_DOUBLE_EQ( 2.0, whole.x( "x2" ) );
+
+	// Interleaved steps each use their own event queue
+	for ( int k = 1; k <= 8; ++k ) {
+		steps.advance_to( 0.25 * k );
+		EXPECT_DOUBLE_EQ( 0.25 * k, steps.t() );
+		if ( k == 4 ) whole.advance_to( 5.0 ); // Clipped to end time
+	}
+	EXPECT_DOUBLE_EQ( 2.0, whole.t() );
+	EXPECT_DOUBLE_EQ( whole.x( "x1" ), steps.x( "x1" ) );
+	EXPECT_DOUBLE_EQ( whole.x( "x2" ), steps.x( "x2" ) );
+	EXPECT_DOUBLE_EQ( whole.q( "x1" ), steps.q( "x1" ) );
+	EXPECT_EQ( whole.results().n_QSS_events, steps.results().n_QSS_events );
+	EXPECT_LT( 0u, steps.results().n_QSS_events );
+	EXPECT_FALSE( whole.finished() );
+	whole.finish();
+	steps.finish();
+	EXPECT_TRUE( whole.finished() );
+}
+
+TEST( SimulatorTest, Variables )
+{
+	NoOutputs const no_outputs;
+	Simulator::Options opts;
+	opts.model = "bball";
+	opts.tEnd = 1.0;
+	Simulator sim( opts );
+	sim.init();
+	EXPECT_NE( nullptr, sim.var( "h" ) );
+	EXPECT_EQ( nullptr, sim.var( "none" ) );
+	EXPECT_THROW( sim.x( "none" ), std::invalid_argument );
+	sim.advance_to( 1.0 );
+	EXPECT_LT( 0u, sim.results().n_ZC_events );
+	sim.finish();
+}
+
+TEST( SimulatorTest, MethodSelectionResults )
+{
+	Simulator::Options opts;
+	opts.model = "achilles";
+	opts.tEnd = 2.0;
+	opts.outputs = false;
+	opts.report = false;
+	opts.out.include = { "x2" };
+	opts.qss = options::QSS::QSS1;
+	Simulator qss1( opts );
+	opts.qss = options::QSS::QSS3;
+	Simulator qss3( opts );
+	qss1.init();
+	qss3.init();
+	EXPECT_EQ( 1, qss1.var( "x1" )->order() );
+	EXPECT_EQ( 3, qss3.var( "x1" )->order() );
+	ASSERT_EQ( 1u, qss1.out_vars().size() );
+	EXPECT_EQ( "x2", qss1.out_vars()[ 0 ]->name );
+	qss1.advance_to( 2.0 );
+	qss3.advance_to( 2.0 );
+	EXPECT_LT( qss3.results().n_QSS_events, qss1.results().n_QSS_events );
+	qss1.finish();
+	qss3.finish();
+
+	// Final values of the output variables
+	ASSERT_EQ( 1u, qss3.results().x.size() );
+	ASSERT_EQ( 1u, qss3.results().q.count( "x2" ) );
+	EXPECT_EQ( qss3.x( "x2" ), qss3.results().x.at( "x2" ) );
+	EXPECT_EQ( qss3.q( "x2" ), qss3.results().q.at( "x2" ) );
+	EXPECT_NEAR( qss1.results().x.at( "x2" ), qss3.results().x.at( "x2" ), 1.0e-2 );
+}
+
+TEST( SimulatorTest, ParallelObservers )
+{
+	NoOutputs const no_outputs;
+	Simulator::Options opts;
+	opts.model = "gen_star";
+	opts.size = 200u;
+	opts.tEnd = 0.5;
+	opts.outputs = false;
+	opts.report = false;
+	opts.fanout = 0u;
+	Simulator serial( opts );
+	opts.fanout = 16u;
+	opts.threads = 3u;
+	Simulator parallel( opts );
+	serial.init();
+	parallel.init();
+	ASSERT_EQ( 200u, parallel.vars().size() );
+	EXPECT_TRUE( parallel.vars()[ 0 ]->parallel_observers() ); // Hub
+	EXPECT_FALSE( parallel.vars()[ 1 ]->parallel_observers() );
+	EXPECT_FALSE( serial.vars()[ 0 ]->parallel_observers() );
+
+	// Interleaved steps: Bit-identical to the serial observer advance
+	for ( int k = 1; k <= 4; ++k ) {
+		serial.advance_to( 0.125 * k );
+		parallel.advance_to( 0.125 * k );
+		for ( Variable const * var : serial.vars() ) {
+			EXPECT_EQ( var->x( serial.t() ), parallel.x( var->name ) );
+			EXPECT_EQ( var->tE, parallel.var( var->name )->tE );
+		}
+	}
+	EXPECT_EQ( serial.results().n_QSS_events, parallel.results().n_QSS_events );
+	EXPECT_LT( 0u, parallel.results().n_QSS_events );
+	serial.finish();
+	parallel.finish();
+}
+
+TEST( SimulatorTest, ParallelStages )
+{
+	NoOutputs const no_outputs;
+	double const dtMax( options::dtMax );
+	options::dtMax = 0.01; // Aligned requantizations give large simultaneous passes
+	Simulator::Options opts;
+	opts.model = "gen_random";
+	opts.size = 100u;
+	opts.qss = options::QSS::QSS3;
+	opts.tEnd = 0.2;
+	opts.outputs = false;
+	opts.report = false;
+	opts.fanout = 0u;
+	Simulator serial( opts );
+	opts.fanout = 4u;
+	opts.threads = 3u;
+	Simulator parallel( opts );
+	serial.init();
+	parallel.init();
+	serial.advance_to( opts.tEnd );
+	parallel.advance_to( opts.tEnd );
+	options::dtMax = dtMax;
+
+	// LTI derivatives: Identical to the serial stages
+	EXPECT_LT( 0u, parallel.results().n_QSS_simultaneous_events );
+	EXPECT_EQ( serial.results().n_QSS_simultaneous_events, parallel.results().n_QSS_simultaneous_events );
+	EXPECT_EQ( serial.results().n_QSS_events, parallel.results().n_QSS_events );
+	for ( Variable const * var : serial.vars() ) {
+		EXPECT_EQ( var->x( serial.t() ), parallel.x( var->name ) );
+		EXPECT_EQ( var->q( serial.t() ), parallel.q( var->name ) );
+	}
+	serial.finish();
+	parallel.finish();
+}
+
+TEST( SimulatorTest, ParallelInit )
+{
+	NoOutputs const no_outputs;
+	double const dtMax( options::dtMax );
+	options::dtMax = 0.01; // Equal event times: Queue ties must keep the serial order
+	for ( options::QSS const qss : { options::QSS::QSS2, options::QSS::QSS3, options::QSS::LIQSS2 } ) { // Stages that publish quantized coefficients
+		Simulator::Options opts;
+		opts.model = "gen_random";
+		opts.size = 200u;
+		opts.qss = qss;
+		opts.tEnd = 0.2;
+		opts.outputs = false;
+		opts.report = false;
+		opts.fanout = 0u;
+		Simulator serial( opts );
+		opts.fanout = 1u;
+		opts.threads = 3u;
+		Simulator parallel( opts );
+		serial.init();
+		parallel.init();
+
+		// Same initial state and observers in the serial registration order
+		for ( Variable const * var : serial.vars() ) {
+			Variable const * par( parallel.var( var->name ) );
+			EXPECT_EQ( var->q( 0.0 ), par->q( 0.0 ) );
+			EXPECT_EQ( var->q1( 0.0 ), par->q1( 0.0 ) );
+			EXPECT_EQ( var->x1( 0.0 ), par->x1( 0.0 ) );
+			EXPECT_EQ( var->x2( 0.0 ), par->x2( 0.0 ) );
+			EXPECT_EQ( var->tE, par->tE );
+			ASSERT_EQ( var->observers().size(), par->observers().size() );
+			for ( Variable::size_type i = 0, n = var->observers().size(); i < n; ++i ) {
+				EXPECT_EQ( var->observers()[ i ]->name, par->observers()[ i ]->name );
+			}
+			EXPECT_EQ( var->sums().size(), par->sums().size() );
+		}
+
+		serial.advance_to( opts.tEnd );
+		parallel.advance_to( opts.tEnd );
+		EXPECT_EQ( serial.results().n_QSS_simultaneous_events, parallel.results().n_QSS_simultaneous_events );
+		EXPECT_EQ( serial.results().n_QSS_events, parallel.results().n_QSS_events );
+		for ( Variable const * var : serial.vars() ) {
+			EXPECT_EQ( var->x( serial.t() ), parallel.x( var->name ) );
+		}
+		serial.finish();
+		parallel.finish();
+	}
+	options::dtMax = dtMax;
+}
+
+TEST( SimulatorTest, Deterministic )
+{
+	NoOutputs const no_outputs;
+	double const dtMax( options::dtMax );
+	options::dtMax = 0.01;
+	Simulator::Options opts;
+	opts.model = "gen_random";
+	opts.size = 100u;
+	opts.qss = options::QSS::QSS3;
+	opts.tEnd = 0.2;
+	opts.outputs = false;
+	opts.report = false;
+	opts.fanout = 4u;
+	opts.deterministic = true;
+	opts.threads = 1u;
+	Simulator one( opts );
+	opts.threads = 4u;
+	Simulator four( opts );
+	one.init();
+	four.init();
+	one.advance_to( opts.tEnd );
+	four.advance_to( opts.tEnd );
+	options::dtMax = dtMax;
+
+	// Same results for any thread count
+	EXPECT_LT( 0u, four.results().n_QSS_simultaneous_events );
+	EXPECT_EQ( one.results().n_QSS_simultaneous_events, four.results().n_QSS_simultaneous_events );
+	EXPECT_EQ( one.results().n_QSS_events, four.results().n_QSS_events );
+	for ( Variable const * var : one.vars() ) {
+		EXPECT_EQ( var->x( one.t() ), four.x( var->name ) );
+		EXPECT_EQ( var->tE, four.var( var->name )->tE );
+	}
+	one.finish();
+	four.finish();
+}
+
+TEST( SimulatorTest, Clusters )
+{
+	NoOutputs const no_outputs;
+	double const dtMin( options::dtMin );
+	options::dtMin = 1.0e-5; // Conservative synchronization lookahead
+	Simulator::Options opts;
+	opts.model = "gen_grid2d";
+	opts.size = 400u;
+	opts.tEnd = 0.5;
+	opts.outputs = false;
+	opts.report = false;
+	opts.clusters = 0u;
+	Simulator serial( opts );
+	opts.clusters = 4u;
+	opts.threads = 3u;
+	Simulator partitioned( opts );
+	serial.init();
+	partitioned.init();
+	options::dtMin = dtMin;
+	EXPECT_FALSE( serial.partitioned() );
+	ASSERT_TRUE( partitioned.partitioned() );
+	ASSERT_EQ( 4u, partitioned.clusters().size() );
+	std::size_t n_vars( 0u );
+	for ( auto const & cluster : partitioned.clusters() ) {
+		EXPECT_LT( 0u, cluster->boundary().size() );
+		EXPECT_LT( 0u, cluster->n_ghosts() );
+		n_vars += cluster->vars().size();
+	}
+	EXPECT_EQ( 400u, n_vars );
+
+	// Interleaved steps: Identical to the serial simulation without cross-cluster simultaneous requantizations
+	for ( int k = 1; k <= 4; ++k ) {
+		serial.advance_to( 0.125 * k );
+		partitioned.advance_to( 0.125 * k );
+		EXPECT_EQ( serial.t(), partitioned.t() );
+		for ( Variable const * var : serial.vars() ) {
+			EXPECT_EQ( var->x( serial.t() ), partitioned.x( var->name ) );
+			EXPECT_EQ( var->tE, partitioned.var( var->name )->tE );
+		}
+	}
+	EXPECT_EQ( serial.results().n_QSS_events, partitioned.results().n_QSS_events );
+	EXPECT_LT( 0u, partitioned.results().n_QSS_events );
+	serial.finish();
+	partitioned.finish();
+
+	// Conservative synchronization without a lookahead runs unpartitioned
+	Simulator no_lookahead( opts );
+	no_lookahead.init();
+	EXPECT_FALSE( no_lookahead.partitioned() );
+	no_lookahead.finish();
+
+	// Models with other than LTI QSS variables run unpartitioned
+	opts.model = "bball";
+	Simulator other( opts );
+	other.init();
+	EXPECT_FALSE( other.partitioned() );
+	other.finish();
+}
+
+TEST( SimulatorTest, ClustersOptimistic )
+{
+	NoOutputs const no_outputs;
+	double const dtMin( options::dtMin );
+	options::dtMin = 1.0e-5; // Conservative synchronization lookahead
+	Simulator::Options opts;
+	opts.model = "gen_grid2d";
+	opts.size = 400u;
+	opts.tEnd = 0.5;
+	opts.outputs = false;
+	opts.report = false;
+	opts.clusters = 4u;
+	opts.threads = 3u;
+	opts.optimism = 0u;
+	Simulator conservative( opts );
+	opts.optimism = 8u;
+	Simulator optimistic( opts );
+	conservative.init();
+	optimistic.init();
+	options::dtMin = dtMin;
+	ASSERT_TRUE( optimistic.partitioned() );
+	for ( auto const & cluster : optimistic.clusters() ) {
+		EXPECT_TRUE( cluster->optimistic() );
+	}
+
+	// Rolled back items leave the same results as conservative synchronization
+	for ( int k = 1; k <= 4; ++k ) {
+		conservative.advance_to( 0.125 * k );
+		optimistic.advance_to( 0.125 * k );
+		EXPECT_EQ( conservative.t(), optimistic.t() );
+		for ( Variable const * var : conservative.vars() ) {
+			EXPECT_EQ( conservative.x( var->name ), optimistic.x( var->name ) );
+			EXPECT_EQ( conservative.var( var->name )->tE, optimistic.var( var->name )->tE );
+		}
+	}
+	EXPECT_EQ( conservative.results().n_QSS_events, optimistic.results().n_QSS_events );
+	std::size_t n_passes( 0u );
+	std::size_t n_processed( 0u );
+	std::size_t n_undone( 0u );
+	std::size_t n_messages( 0u );
+	std::size_t n_messages_conservative( 0u );
+	for ( auto const & cluster : optimistic.clusters() ) {
+		n_passes += cluster->n_QSS_events();
+		n_processed += cluster->n_processed();
+		n_undone += cluster->n_undone();
+		n_messages += cluster->n_messages();
+	}
+	for ( auto const & cluster : conservative.clusters() ) {
+		n_messages_conservative += cluster->n_messages();
+	}
+	EXPECT_LT( 0u, n_undone );
+	EXPECT_EQ( n_passes + n_messages, n_processed - n_undone );
+	EXPECT_EQ( n_messages_conservative, n_messages );
+	conservative.finish();
+	optimistic.finish();
+}
+
+TEST( SimulatorTest, ClustersSimultaneous )
+{
+	NoOutputs const no_outputs;
+	double const dtMin( options::dtMin );
+	options::dtMin = 1.0e-4; // Aligns requantizations across clusters
+	Simulator::Options opts;
+	opts.model = "gen_grid2d";
+	opts.size = 400u;
+	opts.tEnd = 0.1;
+	opts.outputs = false;
+	opts.report = false;
+	opts.clusters = 0u;
+	Simulator serial( opts );
+	opts.clusters = 4u;
+	opts.threads = 3u;
+	opts.optimism = 0u;
+	Simulator conservative( opts );
+	opts.optimism = 8u;
+	Simulator optimistic( opts );
+	serial.init();
+	conservative.init();
+	optimistic.init();
+	options::dtMin = dtMin;
+
+	// Passes at the same superdense time in different clusters are one pass as in the serial loop
+	serial.advance_to( opts.tEnd );
+	conservative.advance_to( opts.tEnd );
+	optimistic.advance_to( opts.tEnd );
+	EXPECT_LT( 0u, serial.results().n_QSS_simultaneous_events );
+	EXPECT_EQ( serial.results().n_QSS_events, conservative.results().n_QSS_events );
+	EXPECT_EQ( serial.results().n_QSS_simultaneous_events, conservative.results().n_QSS_simultaneous_events );
+	EXPECT_EQ( serial.results().n_QSS_events, optimistic.results().n_QSS_events );
+	EXPECT_EQ( serial.results().n_QSS_simultaneous_events, optimistic.results().n_QSS_simultaneous_events );
+	for ( Variable const * var : serial.vars() ) {
+		EXPECT_EQ( var->x( serial.t() ), conservative.x( var->name ) );
+		EXPECT_EQ( var->x( serial.t() ), optimistic.x( var->name ) );
+		EXPECT_EQ( var->tE, conservative.var( var->name )->tE );
+		EXPECT_EQ( var->tE, optimistic.var( var->name )->tE );
+	}
+	serial.finish();
+	conservative.finish();
+	optimistic.finish();
+}
@@ -0,0 +1,112 @@
+// QSS::dfn::Sum_LTI Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/Sum_LTI.hh>
+
+// C++ Headers
+#include <cmath>
+
+using namespace QSS;
+using namespace QSS::dfn;
+
+TEST( Sum_LTITest, Basic )
+{
+	Sum_LTI sum;
+	EXPECT_EQ( 0u, sum.add( 2.0 ) );
+	EXPECT_EQ( 1u, sum.add( -3.0 ) );
+	EXPECT_EQ( 2u, sum.add( 0.5 ) );
+	EXPECT_EQ( 3u, sum.size() );
+	EXPECT_FALSE( sum.built() );
+
+	sum.set( 0, 0.0, 1.0, 2.0 );
+	sum.set( 1, 0.0, 4.0 );
+	sum.set( 2, 0.0, -1.0, 1.0, 3.0 );
+	sum.build( 0.0 );
+	EXPECT_TRUE( sum.built() );
+	EXPECT_DOUBLE_EQ( 2.0 - 12.0 - 0.5, sum.q( 0.0 ) );
+	EXPECT_DOUBLE_EQ( 2.0 * 5.0 - 12.0 + 0.5 * ( -1.0 + 2.0 + 12.0 ), sum.q( 2.0 ) );
+	EXPECT_DOUBLE_EQ( 4.0 + 0.5 * ( 1.0 + 12.0 ), sum.q1( 2.0 ) );
+	EXPECT_DOUBLE_EQ( 3.0, sum.q2( 2.0 ) );
+
+	// Term 1 requantizes
+	sum.update( 1, 1.0, 5.0, -1.0 );
+	EXPECT_DOUBLE_EQ( 2.0 * 5.0 - 3.0 * 4.0 + 0.5 * ( -1.0 + 2.0 + 12.0 ), sum.q( 2.0 ) );
+	EXPECT_DOUBLE_EQ( 4.0 + 3.0 + 0.5 * ( 1.0 + 12.0 ), sum.q1( 2.0 ) );
+
+	// Term 2 requantizes
+	sum.update( 2, 1.5, 2.0 );
+	EXPECT_DOUBLE_EQ( 2.0 * 5.0 - 3.0 * 4.0 + 0.5 * 2.0, sum.q( 2.0 ) );
+	EXPECT_DOUBLE_EQ( 4.0 + 3.0, sum.q1( 2.0 ) );
+	EXPECT_DOUBLE_EQ( 0.0, sum.q2( 2.0 ) );
+
+	// Term 0 requantizes: Triggers full recomputation
+	sum.update( 0, 2.0, 3.0, 1.0 );
+	EXPECT_DOUBLE_EQ( 2.0 * 4.0 - 3.0 * 3.0 + 0.5 * 2.0, sum.q( 3.0 ) );
+	EXPECT_DOUBLE_EQ( 2.0 + 3.0, sum.q1( 3.0 ) );
+
+	sum.clear();
+	EXPECT_EQ( 0u, sum.size() );
+	EXPECT_FALSE( sum.built() );
+}
+
+TEST( Sum_LTITest, Kernels )
+{
+	Sum_LTI sum;
+	Sum_LTI::size_type const n( 37u ); // Not a block multiple
+	double v( 0.0 ), v1( 0.0 ), v2( 0.0 );
+	double const t( 1.5 );
+	for ( Sum_LTI::size_type i = 0; i < n; ++i ) {
+		double const c( i % 2 == 0 ? 1.0 : -0.5 );
+		double const tQ( 0.1 * i );
+		double const q_0( 1.0 + i ), q_1( 0.5 * i ), q_2( 0.25 );
+		sum.set( sum.add( c ), tQ, q_0, q_1, q_2 );
+		double const d( t - tQ );
+		v += c * ( q_0 + ( ( q_1 + ( q_2 * d ) ) * d ) );
+		v1 += c * ( q_1 + ( 2.0 * q_2 * d ) );
+		v2 += c * 2.0 * q_2;
+	}
+	EXPECT_NEAR( v, sum.q_sum( t ), 1e-12 * std::abs( v ) );
+	EXPECT_NEAR( v1, sum.q1_sum( t ), 1e-12 * std::abs( v1 ) );
+	EXPECT_NEAR( v2, sum.q2_sum(), 1e-12 * std::abs( v2 ) );
+	sum.build( t );
+	EXPECT_NEAR( v, sum.q( t ), 1e-12 * std::abs( v ) );
+	EXPECT_NEAR( v1, sum.q1( t ), 1e-12 * std::abs( v1 ) );
+	EXPECT_NEAR( v2, sum.q2( t ), 1e-12 * std::abs( v2 ) );
+	EXPECT_TRUE( sum.isa() != nullptr );
+}
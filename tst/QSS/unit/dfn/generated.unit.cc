@@ -0,0 +1,111 @@
+// Generated Model Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017 Objexx Engineerinc, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dfn/mdl/generated.hh>
+#include <QSS/dfn/Variable.hh>
+
+using namespace QSS;
+using namespace QSS::dfn;
+using namespace QSS::dfn::mdl;
+
+TEST( generatedTest, Names )
+{
+	EXPECT_TRUE( is_generated( "gen_grid1d" ) );
+	EXPECT_TRUE( is_generated( "gen_grid2d" ) );
+	EXPECT_TRUE( is_generated( "gen_grid3d" ) );
+	EXPECT_TRUE( is_generated( "gen_random" ) );
+	EXPECT_TRUE( is_generated( "gen_chain" ) );
+	EXPECT_TRUE( is_generated( "gen_star" ) );
+	EXPECT_TRUE( is_generated( "gen_thermostat" ) );
+	EXPECT_FALSE( is_generated( "gen_" ) );
+	EXPECT_FALSE( is_generated( "stiff" ) );
+}
+
+TEST( generatedTest, Sizes )
+{
+	Parameters params;
+	params.size = 100u;
+	Variables vars;
+
+	generated( vars, "gen_grid1d", params );
+	EXPECT_EQ( 100u, vars.size() );
+	for ( auto var : vars ) delete var;
+
+	generated( vars, "gen_grid2d", params );
+	EXPECT_EQ( 100u, vars.size() );
+	for ( auto var : vars ) delete var;
+
+	generated( vars, "gen_grid3d", params ); // Side 5
+	EXPECT_EQ( 125u, vars.size() );
+	for ( auto var : vars ) delete var;
+
+	generated( vars, "gen_thermostat", params ); // Room, heater, and 2 zero-crossings per cell
+	ASSERT_EQ( 400u, vars.size() );
+	EXPECT_EQ( "T0", vars[ 0 ]->name );
+	EXPECT_EQ( "h0", vars[ 1 ]->name );
+	EXPECT_TRUE( vars[ 399 ]->is_ZC() );
+	for ( auto var : vars ) delete var;
+}
+
+TEST( generatedTest, Seed )
+{
+	Parameters params;
+	params.size = 50u;
+	params.degree = 60u; // Capped at size - 1
+	params.power = true;
+	params.seed = 7u;
+	params.tEnd_set = false;
+	Variables vars1, vars2, vars3;
+	generated( vars1, "gen_random", params );
+	generated( vars2, "gen_random", params );
+	EXPECT_EQ( 1.0, params.tEnd ); // Model default
+	params.seed = 8u;
+	generated( vars3, "gen_random", params );
+	ASSERT_EQ( 50u, vars1.size() );
+	ASSERT_EQ( vars1.size(), vars2.size() );
+	for ( std::size_t i = 0; i < vars1.size(); ++i ) {
+		EXPECT_EQ( vars1[ i ]->xIni, vars2[ i ]->xIni );
+		EXPECT_LE( 0.0, vars1[ i ]->xIni );
+		EXPECT_GT( 1.0, vars1[ i ]->xIni );
+	}
+	EXPECT_NE( vars1[ 0 ]->xIni, vars3[ 0 ]->xIni );
+	for ( auto var : vars1 ) delete var;
+	for ( auto var : vars2 ) delete var;
+	for ( auto var : vars3 ) delete var;
+}